@@ -0,0 +1,9 @@
+# Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+# SPDX-License-Identifier: Apache-2.0
+
+cmake_minimum_required(VERSION 3.23)
+
+if(ERBSLAND_CONFIGURATION_ENABLE_BENCHMARKS)
+    # The benchmark suite measures the throughput of the individual parser stages with synthetic documents.
+    add_subdirectory(test/benchmark)
+endif()
@@ -18,6 +18,11 @@ if(ERBSLAND_CONFIGURATION_ENABLE_TESTS)
             ERBSLAND_CONF_VR_RE_STD=1)
     erbsland_set_required_compiler_options(erbsland-configuration-parser-for-test)
     erbsland_enable_debug_warnings(erbsland-configuration-parser-for-test)
+    if(ERBSLAND_CONFIGURATION_ENABLE_TSAN)
+        # Build the library and all tests with ThreadSanitizer, to check the concurrency tests for data races.
+        target_compile_options(erbsland-configuration-parser-for-test PUBLIC -fsanitize=thread -g)
+        target_link_options(erbsland-configuration-parser-for-test PUBLIC -fsanitize=thread)
+    endif()
 
     # Add the test subdirectory.
     add_subdirectory(test)
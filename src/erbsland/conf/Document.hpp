@@ -5,6 +5,8 @@
 
 #include "impl/value/Value.hpp"
 
+#include <map>
+
 
 namespace erbsland::conf {
 
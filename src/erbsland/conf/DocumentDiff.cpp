@@ -0,0 +1,31 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "DocumentDiff.hpp"
+
+
+#include "impl/value/ValueTreeDiff.hpp"
+
+#include <algorithm>
+
+
+namespace erbsland::conf {
+
+
+auto DocumentDiff::compare(const ConstValuePtr &oldValue, const ConstValuePtr &newValue) -> DocumentDiff {
+    impl::ValueTreeDiff valueTreeDiff;
+    return DocumentDiff{valueTreeDiff.compare(oldValue, newValue)};
+}
+
+
+auto DocumentDiff::affects(const NamePathLike &namePath) const -> bool {
+    const auto path = toNamePath(namePath);
+    return std::ranges::any_of(_entries, [&](const Entry &entry) -> bool {
+        // One path is a prefix of the other.
+        const auto commonSize = std::min(path.size(), entry.namePath.size());
+        return std::ranges::equal(path.view().first(commonSize), entry.namePath.view().first(commonSize));
+    });
+}
+
+
+}
+
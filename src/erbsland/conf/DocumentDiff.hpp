@@ -0,0 +1,127 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "NamePath.hpp"
+#include "Value.hpp"
+
+#include <cstdint>
+#include <vector>
+
+
+namespace erbsland::conf {
+
+
+/// The structural differences between two configuration documents.
+///
+/// Use `DocumentDiff::compare()` to compare an old and a new version of a document, e.g. after a configuration was
+/// reloaded. Both value trees are walked in parallel. Sections are matched by name, elements of section lists by
+/// their index. Each difference is reported once, at the highest level where it occurs:
+///
+/// - If a section or value exists only in the new document, it is reported as *added*, without its children.
+/// - If a section or value exists only in the old document, it is reported as *removed*, without its children.
+/// - If a value has a different type or content, it is reported as *changed*. Value lists are compared as a
+///   whole, like a single value.
+///
+/// The entries are sorted in the order of the new document, followed by the removed values of each section.
+/// Locations, validation rules and default-value flags are not compared. Values are compared using their cached
+/// `Value::contentHash()`, so subtrees that did not change are skipped without visiting their values.
+///
+/// @code
+/// const auto diff = DocumentDiff::compare(oldDocument, newDocument);
+/// if (diff.affects(u8"server.network")) {
+///     restartNetwork(newDocument);
+/// }
+/// @endcode
+///
+/// *Multithreading*: Comparing documents is thread-safe, as long as the documents are not modified at the same time.
+///
+/// @tested `DocumentDiffTest`
+///
+class DocumentDiff final {
+public:
+    /// The kind of change.
+    ///
+    enum class Change : uint8_t {
+        Added, ///< The value only exists in the new document.
+        Removed, ///< The value only exists in the old document.
+        Changed, ///< The value exists in both documents but has a different type or content.
+    };
+
+    /// A single difference between the documents.
+    ///
+    struct Entry {
+        Change change; ///< The kind of change.
+        NamePath namePath; ///< The name-path of the value.
+        ConstValuePtr oldValue; ///< The value in the old document, or `nullptr` if it was added.
+        ConstValuePtr newValue; ///< The value in the new document, or `nullptr` if it was removed.
+    };
+
+    /// The list of differences.
+    using EntryList = std::vector<Entry>;
+
+public:
+    /// Create an empty result.
+    DocumentDiff() = default;
+
+    /// Create a result from a list of differences.
+    ///
+    /// @param entries The list of differences.
+    ///
+    explicit DocumentDiff(EntryList entries) noexcept : _entries{std::move(entries)} {}
+
+    // defaults
+    ~DocumentDiff() = default;
+    DocumentDiff(const DocumentDiff&) = default;
+    DocumentDiff(DocumentDiff&&) noexcept = default;
+    auto operator=(const DocumentDiff&) -> DocumentDiff& = default;
+    auto operator=(DocumentDiff&&) noexcept -> DocumentDiff& = default;
+
+public:
+    /// Compare two documents, or two sections of documents.
+    ///
+    /// @param oldValue The old document, or `nullptr` for an empty document.
+    /// @param newValue The new document, or `nullptr` for an empty document.
+    /// @return The differences between both documents.
+    ///
+    [[nodiscard]] static auto compare(const ConstValuePtr &oldValue, const ConstValuePtr &newValue) -> DocumentDiff;
+
+public:
+    /// Test if both documents are equal.
+    ///
+    [[nodiscard]] auto empty() const noexcept -> bool { return _entries.empty(); }
+
+    /// The number of differences.
+    ///
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return _entries.size(); }
+
+    /// Access all differences.
+    ///
+    [[nodiscard]] auto entries() const noexcept -> const EntryList& { return _entries; }
+
+    /// Iterate over all differences.
+    ///
+    [[nodiscard]] auto begin() const noexcept -> EntryList::const_iterator { return _entries.begin(); }
+
+    /// Iterate over all differences.
+    ///
+    [[nodiscard]] auto end() const noexcept -> EntryList::const_iterator { return _entries.end(); }
+
+    /// Test if a value or one of its children is affected by a difference.
+    ///
+    /// This is the case if there is a difference at the name-path itself, at one of its children, or at one
+    /// of its parents.
+    ///
+    /// @param namePath The name-path of the value to test.
+    /// @return `true` if the value is affected.
+    ///
+    [[nodiscard]] auto affects(const NamePathLike &namePath) const -> bool;
+
+private:
+    EntryList _entries; ///< The list of differences.
+};
+
+
+}
+
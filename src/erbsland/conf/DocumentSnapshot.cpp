@@ -0,0 +1,144 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "DocumentSnapshot.hpp"
+
+
+#include "Error.hpp"
+
+#include "impl/constants/Defaults.hpp"
+#include "impl/crypto/ShaHash.hpp"
+#include "impl/parser/CachedSource.hpp"
+#include "impl/source/MappedFile.hpp"
+#include "impl/value/SnapshotReader.hpp"
+#include "impl/value/SnapshotWriter.hpp"
+
+#include <array>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+
+namespace erbsland::conf {
+
+
+namespace {
+
+
+/// The number of bytes read to get the source digest from a file. Source digests are far smaller.
+constexpr std::size_t cHeaderReadSize = 0x1000;
+
+
+[[nodiscard]] auto fileLocation(const std::filesystem::path &path) -> Location {
+    return Location{SourceIdentifier::createForFile(String{path.string()})};
+}
+
+
+[[noreturn]] void throwFileError(const std::u8string_view message, const std::filesystem::path &path) {
+    throw Error(ErrorCategory::IO, String{message}, fileLocation(path), path);
+}
+
+
+}
+
+
+auto DocumentSnapshot::toBytes(const DocumentPtr &document, const Bytes &sourceDigest) -> Bytes {
+    if (document == nullptr) {
+        throw std::invalid_argument("The document must not be null.");
+    }
+    impl::SnapshotWriter writer;
+    return writer.write(*document, sourceDigest);
+}
+
+
+void DocumentSnapshot::writeFile(
+    const std::filesystem::path &path,
+    const DocumentPtr &document,
+    const Bytes &sourceDigest) {
+
+    const auto data = toBytes(document, sourceDigest);
+    auto temporaryPath = path;
+    temporaryPath += ".tmp";
+    {
+        std::ofstream stream{temporaryPath, std::ios::binary | std::ios::trunc};
+        if (!stream.is_open()) {
+            throwFileError(u8"Could not create the snapshot file.", temporaryPath);
+        }
+        stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        stream.close();
+        if (stream.fail()) {
+            std::error_code ignored;
+            std::filesystem::remove(temporaryPath, ignored);
+            throwFileError(u8"Could not write the snapshot file.", temporaryPath);
+        }
+    }
+    std::error_code errorCode;
+    std::filesystem::rename(temporaryPath, path, errorCode);
+    if (errorCode) {
+        std::error_code ignored;
+        std::filesystem::remove(temporaryPath, ignored);
+        throwFileError(u8"Could not replace the snapshot file.", path);
+    }
+}
+
+
+auto DocumentSnapshot::fromBytes(const std::span<const std::byte> data) -> DocumentSnapshot {
+    impl::SnapshotReader reader{data, Location{SourceIdentifier::createForText()}};
+    reader.read();
+    return DocumentSnapshot{reader.document(), reader.sourceDigest()};
+}
+
+
+auto DocumentSnapshot::fromFile(const std::filesystem::path &path) -> DocumentSnapshot {
+    std::filesystem::path canonicalPath;
+    std::uintmax_t fileSize = 0;
+    try {
+        canonicalPath = std::filesystem::canonical(path);
+        fileSize = std::filesystem::file_size(canonicalPath);
+    } catch (const std::filesystem::filesystem_error&) {
+        throwFileError(u8"Could not read the snapshot file.", path);
+    }
+    const auto location = fileLocation(canonicalPath);
+    impl::MappedFile mappedFile;
+    // An empty file can't be mapped, the reader reports it as invalid snapshot.
+    if (fileSize > 0) {
+        mappedFile.map(canonicalPath, static_cast<std::size_t>(fileSize), location);
+    }
+    impl::SnapshotReader reader{mappedFile.bytes(), location};
+    reader.read();
+    return DocumentSnapshot{reader.document(), reader.sourceDigest()};
+}
+
+
+auto DocumentSnapshot::readSourceDigest(const std::filesystem::path &path) -> Bytes {
+    std::ifstream stream{path, std::ios::binary};
+    if (!stream.is_open()) {
+        throwFileError(u8"Could not read the snapshot file.", path);
+    }
+    std::array<std::byte, cHeaderReadSize> buffer{};
+    stream.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    if (stream.bad()) {
+        throwFileError(u8"Could not read the snapshot file.", path);
+    }
+    const auto data = std::span{buffer}.first(static_cast<std::size_t>(stream.gcount()));
+    impl::SnapshotReader reader{data, fileLocation(path)};
+    return reader.readSourceDigest();
+}
+
+
+auto DocumentSnapshot::calculateSourceDigest(const std::vector<std::filesystem::path> &paths) -> Bytes {
+    impl::crypto::ShaHash hash{impl::defaults::documentHashAlgorithm};
+    for (const auto &path : paths) {
+        const auto contentHash = impl::CachedSource::readContentHash(path);
+        if (!contentHash.has_value()) {
+            throwFileError(u8"Could not read the source file.", path);
+        }
+        const auto pathText = path.generic_u8string();
+        hash.update(std::as_bytes(std::span{pathText.data(), pathText.size() + 1})); // including the terminator.
+        hash.update(std::as_bytes(std::span{contentHash->data(), contentHash->size()}));
+    }
+    return hash.digest();
+}
+
+
+}
+
@@ -0,0 +1,156 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "Bytes.hpp"
+#include "Document.hpp"
+
+#include <filesystem>
+#include <span>
+#include <vector>
+
+
+namespace erbsland::conf {
+
+
+/// A binary snapshot of a parsed document.
+///
+/// A snapshot stores the value tree of a document in a compact binary format, including the names, locations
+/// and default-value flags of all values. Loading a snapshot rebuilds the value tree directly, without reading
+/// and parsing the original configuration files. This is useful for large configurations that are loaded
+/// frequently, but change rarely, e.g. when a command line tool starts.
+///
+/// Each snapshot carries a *source digest*, that you provide when you write the snapshot. Compare it with the
+/// digest of the current sources, to detect outdated snapshots. `calculateSourceDigest()` creates a digest from
+/// the contents of a list of files, and `readSourceDigest()` reads the digest from a snapshot file without
+/// loading the document.
+///
+/// Validation rules are not stored in a snapshot. Values that were added by validation rules are kept and are
+/// still marked as default values, but `wasValidated()` returns `false` for all values of a loaded document.
+/// The snapshot format is versioned: snapshots written by a different version of the format are rejected with an
+/// `Unsupported` error, so they can be replaced.
+///
+/// @code
+/// const auto digest = DocumentSnapshot::calculateSourceDigest({configPath});
+/// DocumentPtr document;
+/// if (std::filesystem::exists(snapshotPath) && DocumentSnapshot::readSourceDigest(snapshotPath) == digest) {
+///     document = DocumentSnapshot::fromFile(snapshotPath).document();
+/// } else {
+///     document = parser.parseOrThrow(Source::fromFile(configPath));
+///     DocumentSnapshot::writeFile(snapshotPath, document, digest);
+/// }
+/// @endcode
+///
+/// *Multithreading*: All static methods are thread-safe, as long as the written document is not modified at the
+/// same time.
+///
+/// @tested `DocumentSnapshotTest`
+///
+class DocumentSnapshot final {
+public:
+    /// Create an empty snapshot.
+    ///
+    DocumentSnapshot() = default;
+
+    /// Create a snapshot from a loaded document.
+    ///
+    /// @param document The document.
+    /// @param sourceDigest The source digest of the document.
+    ///
+    DocumentSnapshot(DocumentPtr document, Bytes sourceDigest) noexcept
+        : _document{std::move(document)}, _sourceDigest{std::move(sourceDigest)} {}
+
+    // defaults
+    ~DocumentSnapshot() = default;
+    DocumentSnapshot(const DocumentSnapshot&) = default;
+    DocumentSnapshot(DocumentSnapshot&&) noexcept = default;
+    auto operator=(const DocumentSnapshot&) -> DocumentSnapshot& = default;
+    auto operator=(DocumentSnapshot&&) noexcept -> DocumentSnapshot& = default;
+
+public: // writing
+    /// Write a document into a snapshot.
+    ///
+    /// @param document The document to write.
+    /// @param sourceDigest The digest of the sources, that is stored with the snapshot.
+    /// @return The snapshot data.
+    /// @throws std::invalid_argument If `document` is `nullptr`.
+    ///
+    [[nodiscard]] static auto toBytes(const DocumentPtr &document, const Bytes &sourceDigest = {}) -> Bytes;
+
+    /// Write a document into a snapshot file.
+    ///
+    /// The snapshot is first written to a temporary file, which replaces the target file, so concurrent
+    /// readers never see a partially written snapshot.
+    ///
+    /// @param path The path of the snapshot file.
+    /// @param document The document to write.
+    /// @param sourceDigest The digest of the sources, that is stored with the snapshot.
+    /// @throws Error (IO) If the file can't be written.
+    /// @throws std::invalid_argument If `document` is `nullptr`.
+    ///
+    static void writeFile(
+        const std::filesystem::path &path,
+        const DocumentPtr &document,
+        const Bytes &sourceDigest = {});
+
+public: // reading
+    /// Load a snapshot from data in memory.
+    ///
+    /// @param data The snapshot data.
+    /// @return The loaded snapshot.
+    /// @throws Error (Unsupported) If the data is no snapshot, or the snapshot has an unsupported version.
+    /// @throws Error (Syntax) If the snapshot is corrupted.
+    ///
+    [[nodiscard]] static auto fromBytes(std::span<const std::byte> data) -> DocumentSnapshot;
+
+    /// Load a snapshot file.
+    ///
+    /// The file is mapped into memory while the document is rebuilt.
+    ///
+    /// @param path The path of the snapshot file.
+    /// @return The loaded snapshot.
+    /// @throws Error (IO) If the file can't be read.
+    /// @throws Error (Unsupported) If the file is no snapshot, or the snapshot has an unsupported version.
+    /// @throws Error (Syntax) If the snapshot is corrupted.
+    ///
+    [[nodiscard]] static auto fromFile(const std::filesystem::path &path) -> DocumentSnapshot;
+
+    /// Read only the source digest from a snapshot file.
+    ///
+    /// This reads only the header of the file, without verifying or loading the document.
+    ///
+    /// @param path The path of the snapshot file.
+    /// @return The source digest stored in the snapshot.
+    /// @throws Error (IO) If the file can't be read.
+    /// @throws Error (Unsupported) If the file is no snapshot, or the snapshot has an unsupported version.
+    ///
+    [[nodiscard]] static auto readSourceDigest(const std::filesystem::path &path) -> Bytes;
+
+    /// Calculate a source digest from the contents of files.
+    ///
+    /// The digest covers the paths and the contents of all files, in the given order.
+    ///
+    /// @param paths The paths of all files the document is read from.
+    /// @return The source digest.
+    /// @throws Error (IO) If one of the files can't be read.
+    ///
+    [[nodiscard]] static auto calculateSourceDigest(const std::vector<std::filesystem::path> &paths) -> Bytes;
+
+public: // accessors
+    /// The loaded document, or `nullptr` for an empty snapshot.
+    ///
+    [[nodiscard]] auto document() const noexcept -> const DocumentPtr& { return _document; }
+
+    /// The source digest stored with the snapshot.
+    ///
+    [[nodiscard]] auto sourceDigest() const noexcept -> const Bytes& { return _sourceDigest; }
+
+private:
+    DocumentPtr _document; ///< The loaded document.
+    Bytes _sourceDigest; ///< The source digest.
+};
+
+
+}
+
@@ -0,0 +1,110 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+namespace erbsland::conf {
+
+
+/// A read-only view to a list of values, that either borrows or owns its values.
+///
+/// Borrowed views point to the packed storage of a value list in a document. They are created without copying
+/// the values, but they are only valid as long as the value list exists. Keep a `DocumentPtr` or `ValuePtr` to the
+/// value list while you use a borrowed view. Views that own their values stay valid on their own.
+///
+/// @tested `ValuePackedListTest`
+template<typename T>
+class ListView final {
+public:
+    /// The iterator type.
+    using const_iterator = typename std::span<const T>::iterator;
+
+public:
+    /// Create an empty view.
+    ListView() = default;
+
+    /// Create a view that borrows the values.
+    /// @param values The borrowed values.
+    explicit ListView(const std::span<const T> values) noexcept : _view{values}, _isBorrowed{true} {}
+
+    /// Create a view that owns the values.
+    /// @param values The values.
+    explicit ListView(std::vector<T> values) noexcept : _storage{std::move(values)}, _view{_storage} {}
+
+    /// Copy a view.
+    ///
+    /// A copy of a borrowing view borrows the same values, a copy of an owning view owns a copy of the values.
+    ListView(const ListView &other) : _storage{other._storage}, _isBorrowed{other._isBorrowed} {
+        _view = _isBorrowed ? other._view : std::span<const T>{_storage};
+    }
+
+    /// Move a view.
+    ListView(ListView &&other) noexcept : _storage{std::move(other._storage)}, _isBorrowed{other._isBorrowed} {
+        _view = _isBorrowed ? other._view : std::span<const T>{_storage};
+        other._view = {};
+    }
+
+    /// Copy a view.
+    auto operator=(const ListView &other) -> ListView& {
+        if (this != &other) {
+            *this = ListView{other};
+        }
+        return *this;
+    }
+
+    /// Move a view.
+    auto operator=(ListView &&other) noexcept -> ListView& {
+        if (this != &other) {
+            _storage = std::move(other._storage);
+            _isBorrowed = other._isBorrowed;
+            _view = _isBorrowed ? other._view : std::span<const T>{_storage};
+            other._view = {};
+        }
+        return *this;
+    }
+
+    ~ListView() = default;
+
+public:
+    /// Test if this view borrows the values from a document, without a copy.
+    [[nodiscard]] auto isBorrowed() const noexcept -> bool { return _isBorrowed; }
+
+    /// Access the values as span.
+    [[nodiscard]] auto span() const noexcept -> std::span<const T> { return _view; }
+
+    /// The number of values.
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return _view.size(); }
+
+    /// Test if this view is empty.
+    [[nodiscard]] auto empty() const noexcept -> bool { return _view.empty(); }
+
+    /// Access the values.
+    [[nodiscard]] auto data() const noexcept -> const T* { return _view.data(); }
+
+    /// Access a value without bounds check.
+    [[nodiscard]] auto operator[](const std::size_t index) const noexcept -> const T& { return _view[index]; }
+
+    /// Iterate over the values.
+    [[nodiscard]] auto begin() const noexcept -> const_iterator { return _view.begin(); }
+
+    /// Iterate over the values.
+    [[nodiscard]] auto end() const noexcept -> const_iterator { return _view.end(); }
+
+    /// Copy the values into a vector.
+    [[nodiscard]] auto toVector() const -> std::vector<T> { return {_view.begin(), _view.end()}; }
+
+private:
+    std::vector<T> _storage; ///< The owned values.
+    std::span<const T> _view; ///< The view to the borrowed or owned values.
+    bool _isBorrowed{false}; ///< If the values are borrowed.
+};
+
+
+}
+
@@ -0,0 +1,123 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "ListView.hpp"
+#include "Matrix.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+namespace erbsland::conf {
+
+
+/// A read-only view to a matrix of values, that either borrows or owns its values.
+///
+/// The values of all rows are stored one after the other. Each row can have a different number of columns,
+/// like the nested value lists in the configuration document. Borrowed views have the same lifetime rules
+/// as `ListView`.
+///
+/// @tested `ValuePackedListTest`
+template<typename T>
+requires std::default_initializable<T>
+class MatrixView final {
+public:
+    /// Create an empty view.
+    MatrixView() = default;
+
+    /// Create a view from values and row offsets.
+    /// @param values The values of all rows.
+    /// @param rowOffsets The start of each row in the values, followed by the total number of values.
+    ///     If empty, each value is a row with a single column.
+    /// @param columnCount The maximum number of columns in a row.
+    MatrixView(ListView<T> values, ListView<std::size_t> rowOffsets, const std::size_t columnCount) noexcept
+        : _values{std::move(values)}, _rowOffsets{std::move(rowOffsets)}, _columnCount{columnCount} {
+    }
+
+public: // access
+    /// Test if this view borrows the values from a document, without a copy.
+    [[nodiscard]] auto isBorrowed() const noexcept -> bool { return _values.isBorrowed(); }
+
+    /// Get the number of rows in this matrix.
+    [[nodiscard]] auto rowCount() const noexcept -> std::size_t {
+        if (_rowOffsets.empty()) {
+            return _values.size();
+        }
+        return _rowOffsets.size() - 1;
+    }
+
+    /// Get the number of columns in this matrix.
+    [[nodiscard]] auto columnCount() const noexcept -> std::size_t { return _columnCount; }
+
+    /// Get the actual column count for the given row.
+    /// @param row The row index.
+    /// @return The number of columns defined in the row.
+    [[nodiscard]] auto actualColumnCount(const std::size_t row) const noexcept -> std::size_t {
+        return this->row(row).size();
+    }
+
+    /// Access the values of a row.
+    /// @param row The row index.
+    /// @return The values of the row, or an empty span if the row is outside the matrix.
+    [[nodiscard]] auto row(const std::size_t row) const noexcept -> std::span<const T> {
+        if (row >= rowCount()) {
+            return {};
+        }
+        if (_rowOffsets.empty()) {
+            return _values.span().subspan(row, 1);
+        }
+        return _values.span().subspan(_rowOffsets[row], _rowOffsets[row + 1] - _rowOffsets[row]);
+    }
+
+    /// Test if a value was defined in the original nested list.
+    /// @param row The row index.
+    /// @param column The column index.
+    /// @return `true` if the value was defined.
+    [[nodiscard]] auto isDefined(const std::size_t row, const std::size_t column) const noexcept -> bool {
+        return column < actualColumnCount(row);
+    }
+
+    /// Access a value by row and column.
+    /// @param row The row index.
+    /// @param column The column index.
+    /// @param defaultValue The default value for missing cells.
+    /// @return The value or the default value if it was not defined.
+    [[nodiscard]] auto value(
+        const std::size_t row,
+        const std::size_t column,
+        const T &defaultValue = {}) const noexcept -> const T& {
+
+        const auto rowValues = this->row(row);
+        if (column >= rowValues.size()) {
+            return defaultValue;
+        }
+        return rowValues[column];
+    }
+
+    /// Access all values, row by row.
+    [[nodiscard]] auto values() const noexcept -> std::span<const T> { return _values.span(); }
+
+    /// Copy the values into a matrix.
+    [[nodiscard]] auto toMatrix() const -> Matrix<T> {
+        Matrix<T> result{rowCount(), _columnCount};
+        for (std::size_t rowIndex = 0; rowIndex < rowCount(); ++rowIndex) {
+            const auto rowValues = row(rowIndex);
+            result.setRow(rowIndex, std::vector<T>{rowValues.begin(), rowValues.end()});
+        }
+        return result;
+    }
+
+private:
+    ListView<T> _values; ///< The values of all rows.
+    ListView<std::size_t> _rowOffsets; ///< The row offsets, or empty for single-column rows.
+    std::size_t _columnCount{0}; ///< The maximum number of columns in a row.
+};
+
+
+}
+
@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
@@ -20,6 +20,9 @@ namespace erbsland::conf {
 /// - A text-name is kept as is.
 /// - An index-name is neither normalized nor range checked.
 ///
+/// The hash of a name is calculated once when the name is created and copied with the name. Therefore,
+/// `hash()` is a constant time operation, and names with different hashes are compared without looking at their text.
+///
 /// @tested `NameTest`
 class Name {
 public:
@@ -60,11 +63,11 @@ public:
     template<typename StorageFwd>
     requires std::is_convertible_v<StorageFwd, Storage>
     Name(const NameType type, StorageFwd &&storage, impl::PrivateTag /*pt*/) noexcept
-        : _type{type}, _value{std::forward<StorageFwd>(storage)} {
+        : _type{type}, _value{std::forward<StorageFwd>(storage)}, _hash{calculateHash(_type, _value)} {
     }
 
     /// Default constructor.
-    Name() = default;
+    Name() noexcept : _hash{calculateHash(_type, _value)} {}
     /// Default destructor.
     ~Name() = default;
 
@@ -110,7 +113,9 @@ public: // operators
     /// Test two names for equality.
     /// @param other The other name to compare.
     /// @return `true` if both names compare equal.
-    auto operator==(const Name &other) const -> bool = default;
+    auto operator==(const Name &other) const noexcept -> bool {
+        return _hash == other._hash && _type == other._type && _value == other._value;
+    }
 
 public: // accessors
     /// Get the type of this name.
@@ -161,10 +166,7 @@ public: // accessors
 
     /// Get a hash value for this name.
     [[nodiscard]] auto hash() const noexcept -> std::size_t {
-        std::size_t result = 0;
-        impl::hashCombine(result, _type);
-        impl::hashCombine(result, _value);
-        return result;
+        return _hash;
     }
 
 public: // validation rules
@@ -218,6 +220,14 @@ private:
     /// Get the decimal digit-count of the index.
     [[nodiscard]] auto indexDigitCount() const noexcept -> std::size_t;
 
+    /// Calculate the hash for a name.
+    [[nodiscard]] static auto calculateHash(const NameType type, const Storage &value) noexcept -> std::size_t {
+        std::size_t result = 0;
+        impl::hashCombine(result, type);
+        impl::hashCombine(result, value);
+        return result;
+    }
+
 public:
 #ifdef ERBSLAND_CONF_INTERNAL_VIEWS
     friend auto internalView(const Name &object) -> impl::InternalViewPtr;
@@ -226,6 +236,7 @@ public:
 private:
     NameType _type{NameType::Regular}; ///< The type of this name
     Storage _value; ///< The value, depending on the type.
+    std::size_t _hash; ///< The hash of the type and value.
 };
 
 
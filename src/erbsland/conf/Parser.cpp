@@ -1,4 +1,4 @@
-// Copyright (c) 2024-2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2024-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #include "Parser.hpp"
 
@@ -24,6 +24,21 @@ void Parser::setSignatureValidator(const SignatureValidatorPtr &signatureValidat
 }
 
 
+void Parser::setArenaAllocation(const bool enabled) noexcept {
+    _settings.arenaAllocation = enabled;
+}
+
+
+void Parser::setParallelIncludes(const std::size_t threadCount) noexcept {
+    _settings.includeThreadCount = threadCount;
+}
+
+
+void Parser::setCache(const ParserCachePtr &cache) noexcept {
+    _settings.cache = cache;
+}
+
+
 auto Parser::parseOrThrow(const SourcePtr &source) -> DocumentPtr  {
     _lastError = std::nullopt;
     impl::Parser parserImplementation(source, _settings);
@@ -1,10 +1,11 @@
-// Copyright (c) 2024-2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2024-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
 
 #include "AccessCheck.hpp"
 #include "Document.hpp"
+#include "ParserCache.hpp"
 #include "SignatureValidator.hpp"
 #include "Source.hpp"
 #include "SourceResolver.hpp"
@@ -24,7 +25,7 @@ namespace erbsland::conf {
 /// thread uses an individual instance of the parser.
 ///
 /// @tested `ParserAccessTest`, `ParserBasicTest`, `ParserComplianceTest`, `ParserErrorClassTest`,
-///     `ParserIncludeTest`, `ParserSignatureTest`
+///     `ParserCacheTest`, `ParserIncludeTest`, `ParserParallelIncludeTest`, `ParserSignatureTest`
 ///
 class Parser final {
 public:
@@ -63,6 +64,47 @@ public:
     ///
     void setSignatureValidator(const SignatureValidatorPtr &signatureValidator) noexcept;
 
+    /// Enable or disable arena allocation for parsed documents.
+    ///
+    /// If enabled, all values of a parsed document, and the document itself, are placed in a few large chunks of
+    /// memory, instead of allocating each value individually on the heap. This reduces the number of allocations
+    /// and the fragmentation of the heap when large documents are parsed. The memory is released at once when the
+    /// last value of the document is released. Values added later, e.g. by a validation, are always allocated on
+    /// the heap.
+    ///
+    /// By default, arena allocation is disabled.
+    ///
+    /// @param enabled `true` to enable arena allocation.
+    ///
+    void setArenaAllocation(bool enabled) noexcept;
+
+    /// Read included sources in parallel.
+    ///
+    /// If enabled, an `\@include` that resolves to more than one source, e.g. using a wildcard, reads and decodes
+    /// these sources on a pool of worker threads. The parser merges the values in include order, so the resulting
+    /// document and the reported errors are the same as with sequential parsing. The source resolver, access
+    /// check and signature validator are still called from the thread that calls `parse()`. The `open()`,
+    /// `readLine()` and `close()` methods of the included sources are called from the worker threads.
+    ///
+    /// By default, all sources are read sequentially.
+    ///
+    /// @param threadCount The number of worker threads, e.g. `std::thread::hardware_concurrency()`, or zero to
+    ///     read all sources sequentially.
+    ///
+    void setParallelIncludes(std::size_t threadCount) noexcept;
+
+    /// Set a cache to reuse the assignments of unchanged files.
+    ///
+    /// If a cache is set, the parser keeps the assignments it read from each file in the cache. When a
+    /// configuration is parsed again, e.g. to reload it, files that did not change are not read again, and the
+    /// document is built from the cached assignments. See `ParserCache` for details.
+    ///
+    /// By default, no cache is used.
+    ///
+    /// @param cache The cache, or `nullptr` to parse all sources.
+    ///
+    void setCache(const ParserCachePtr &cache) noexcept;
+
     /// Parse the given source into a configuration document and throw an exception on any error.
     ///
     /// @param source The source to parse. Should be closed.
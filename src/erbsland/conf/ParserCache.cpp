@@ -0,0 +1,109 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "ParserCache.hpp"
+
+
+namespace erbsland::conf {
+
+
+auto ParserCache::create() -> ParserCachePtr {
+    return std::make_shared<ParserCache>();
+}
+
+
+void ParserCache::clear() noexcept {
+    std::lock_guard lock{_mutex};
+    _entries.clear();
+}
+
+
+auto ParserCache::size() const noexcept -> std::size_t {
+    std::lock_guard lock{_mutex};
+    return _entries.size();
+}
+
+
+auto ParserCache::reusedSourceCount() const noexcept -> std::size_t {
+    std::lock_guard lock{_mutex};
+    return _reusedSourceCount;
+}
+
+
+auto ParserCache::parsedSourceCount() const noexcept -> std::size_t {
+    std::lock_guard lock{_mutex};
+    return _parsedSourceCount;
+}
+
+
+auto ParserCache::find(const SourceIdentifier &sourceIdentifier) -> Lookup {
+    const auto path = filePath(sourceIdentifier);
+    if (!path.has_value()) {
+        return {};
+    }
+    const auto fileState = impl::CachedSource::readFileState(*path);
+    if (!fileState.has_value()) {
+        return {};
+    }
+    Entry entry;
+    {
+        std::lock_guard lock{_mutex};
+        const auto it = _entries.find(sourceIdentifier.path());
+        if (it == _entries.end()) {
+            return {.fileState = fileState};
+        }
+        entry = it->second;
+    }
+    if (entry.fileState.size != fileState->size) {
+        return {.fileState = fileState};
+    }
+    if (entry.fileState.modificationTime != fileState->modificationTime ||
+        entry.fileState.isModificationTimeAmbiguous()) {
+        // The file was touched, or it could have been rewritten in the same time-stamp interval after it was read.
+        // Only reuse it if the contents did not change.
+        const auto contentHash = impl::CachedSource::readContentHash(*path);
+        if (!contentHash.has_value() || *contentHash != entry.contentHash ||
+            impl::CachedSource::readFileState(*path) != fileState) {
+            return {.fileState = fileState};
+        }
+    }
+    std::lock_guard lock{_mutex};
+    if (const auto it = _entries.find(sourceIdentifier.path()); it != _entries.end() && it->second.source == entry.source) {
+        it->second.fileState = *fileState;
+    }
+    _reusedSourceCount += 1;
+    return {.source = entry.source};
+}
+
+
+void ParserCache::store(
+    const SourceIdentifier &sourceIdentifier,
+    const impl::FileState &fileState,
+    impl::CachedSourcePtr source) {
+
+    const auto path = filePath(sourceIdentifier);
+    if (!path.has_value()) {
+        return;
+    }
+    // The hash was calculated from the bytes the lexer read. Make sure the file did not change while it was parsed.
+    if (source->contentHash().empty() || impl::CachedSource::readFileState(*path) != fileState) {
+        return;
+    }
+    std::lock_guard lock{_mutex};
+    _entries.insert_or_assign(sourceIdentifier.path(), Entry{
+        .fileState = fileState,
+        .contentHash = source->contentHash(),
+        .source = std::move(source)});
+    _parsedSourceCount += 1;
+}
+
+
+auto ParserCache::filePath(const SourceIdentifier &sourceIdentifier) -> std::optional<std::filesystem::path> {
+    if (sourceIdentifier.name() != u8"file" || sourceIdentifier.path().empty()) {
+        return std::nullopt;
+    }
+    return std::filesystem::path{sourceIdentifier.path().raw()};
+}
+
+
+}
+
@@ -0,0 +1,144 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "SourceIdentifier.hpp"
+#include "String.hpp"
+
+#include "impl/parser/CachedSource.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+
+namespace erbsland::conf::impl {
+class Parser;
+}
+
+
+namespace erbsland::conf {
+
+
+class ParserCache;
+using ParserCachePtr = std::shared_ptr<ParserCache>;
+
+
+/// A cache to reload configurations that include many files quickly.
+///
+/// If a parser uses this cache, it keeps the assignments it read from each file, together with the size,
+/// the modification time and a hash of the file contents. The hash is calculated from the bytes the parser
+/// read. When the same file is parsed again, and neither its size nor its modification time changed, the parser
+/// skips reading the file and builds the document from the kept assignments. If only the modification time
+/// changed, the file is read to compare the hash of its contents, but it is only parsed again if the contents
+/// changed. The hash is also compared if the file was modified shortly before it was read, because a rewrite
+/// in the same time-stamp interval does not change the modification time. This way, the time to reload a
+/// configuration depends on the size of the changed files.
+///
+/// Only file sources are cached. Include directives are resolved again on each run, so new or removed files
+/// that match a wildcard include are detected. Access checks and signature verifications are also done for
+/// each run.
+///
+/// The cache keeps the entries for all files that were parsed, until `clear()` is called.
+///
+/// @code
+/// auto cache = ParserCache::create();
+/// Parser parser;
+/// parser.setCache(cache);
+/// auto document = parser.parseFileOrThrow(path);
+/// // ...later, e.g. on a reload request.
+/// document = parser.parseFileOrThrow(path);
+/// @endcode
+///
+/// *Multithreading*: The methods of this class are thread-safe. One cache can be shared between multiple
+/// parsers that run in different threads.
+///
+/// @tested `ParserCacheTest`
+///
+class ParserCache final {
+public:
+    /// Create an empty cache.
+    ///
+    ParserCache() = default;
+
+    // defaults and deletions
+    ~ParserCache() = default;
+    ParserCache(const ParserCache&) = delete;
+    auto operator=(const ParserCache&) -> ParserCache& = delete;
+
+public:
+    /// Create a new shared cache.
+    ///
+    [[nodiscard]] static auto create() -> ParserCachePtr;
+
+public:
+    /// Remove all entries from the cache.
+    ///
+    void clear() noexcept;
+
+    /// The number of cached files.
+    ///
+    [[nodiscard]] auto size() const noexcept -> std::size_t;
+
+    /// The number of times a file was built from the cache, since the cache was created.
+    ///
+    [[nodiscard]] auto reusedSourceCount() const noexcept -> std::size_t;
+
+    /// The number of times a file was parsed and added to the cache, since the cache was created.
+    ///
+    [[nodiscard]] auto parsedSourceCount() const noexcept -> std::size_t;
+
+private:
+    /// The result of a lookup.
+    ///
+    struct Lookup {
+        impl::CachedSourcePtr source; ///< The cached source, or `nullptr` if the file must be parsed.
+        std::optional<impl::FileState> fileState; ///< The file state before the file is parsed, if it can be cached.
+    };
+
+    /// A cached file.
+    ///
+    struct Entry {
+        impl::FileState fileState; ///< The state of the file when it was read.
+        Bytes contentHash; ///< The hash of the file contents.
+        impl::CachedSourcePtr source; ///< The assignments of the file.
+    };
+
+    /// Look up a source in the cache.
+    ///
+    /// @param sourceIdentifier The identifier of the source.
+    /// @return The cached source if it can be used, otherwise the file state to store the parsed source.
+    ///
+    [[nodiscard]] auto find(const SourceIdentifier &sourceIdentifier) -> Lookup;
+
+    /// Store the assignments of a parsed source.
+    ///
+    /// The source is only stored if the file did not change while it was parsed.
+    ///
+    /// @param sourceIdentifier The identifier of the source.
+    /// @param fileState The state of the file, read before the file was parsed.
+    /// @param source The assignments of the source.
+    ///
+    void store(const SourceIdentifier &sourceIdentifier, const impl::FileState &fileState, impl::CachedSourcePtr source);
+
+    /// Get the path for a source identifier.
+    ///
+    /// @return The path, or no value if the source is not a file.
+    ///
+    [[nodiscard]] static auto filePath(const SourceIdentifier &sourceIdentifier) -> std::optional<std::filesystem::path>;
+
+private:
+    mutable std::mutex _mutex; ///< The mutex to protect all members.
+    std::unordered_map<String, Entry> _entries; ///< The cached files, by their path.
+    std::size_t _reusedSourceCount{0}; ///< The number of sources built from the cache.
+    std::size_t _parsedSourceCount{0}; ///< The number of sources that were added to the cache.
+
+    friend class impl::Parser;
+};
+
+
+}
+
@@ -1,9 +1,10 @@
-// Copyright (c) 2024-2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2024-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #include "Source.hpp"
 
 
 #include "impl/source/FileSource.hpp"
+#include "impl/source/MappedFileSource.hpp"
 #include "impl/source/StringSource.hpp"
 
 
@@ -20,6 +21,16 @@ auto Source::fromFile(const std::filesystem::path &path) noexcept -> SourcePtr {
 }
 
 
+auto Source::fromMappedFile(const String &path) noexcept -> SourcePtr {
+    return std::make_shared<impl::MappedFileSource>(std::filesystem::path{path.toCharString()});
+}
+
+
+auto Source::fromMappedFile(const std::filesystem::path &path) noexcept -> SourcePtr {
+    return std::make_shared<impl::MappedFileSource>(path);
+}
+
+
 auto Source::fromString(const String &text) noexcept -> SourcePtr {
     return std::make_shared<impl::StringSource>(text);
 }
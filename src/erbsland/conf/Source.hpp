@@ -1,4 +1,4 @@
-// Copyright (c) 2024-2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2024-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
@@ -107,6 +107,30 @@ public: // working with the source.
     ///
     [[nodiscard]] virtual auto readLine(std::span<std::byte> lineBuffer) -> std::size_t = 0;
 
+    /// Test if this source can provide views to its lines.
+    ///
+    /// Sources that keep the whole document in memory can return `true` and implement `readLineView()`.
+    /// The character stream then decodes the lines in place, without copying them into its line buffer.
+    ///
+    /// @return `true` if `readLineView()` is supported, `false` otherwise.
+    ///
+    [[nodiscard]] virtual auto supportsLineViews() const noexcept -> bool { return false; }
+
+    /// Read a line from the source as a view into memory owned by the source.
+    ///
+    /// Works like `readLine()`, but instead of copying the line into a buffer, a view to the data is returned.
+    /// The returned view must stay valid until the source is closed or destroyed.
+    ///
+    /// @return A view to the line, including the newline sequence if there is any, or an empty span if no
+    ///     more data was available.
+    ///
+    /// @throws Error (IO) If an error occurs while reading the line.
+    /// @throws Error (Internal) If this source does not support line views.
+    ///
+    [[nodiscard]] virtual auto readLineView() -> std::span<const std::byte> {
+        throw Error{ErrorCategory::Internal, u8"This source does not support line views.", Location{identifier()}};
+    }
+
     /// Closes the source.
     ///
     /// Closes the source and releases any system resources associated with the source.
@@ -126,6 +150,18 @@ public:
     /// @copydoc fromFile(const String&)
     [[nodiscard]] static auto fromFile(const std::filesystem::path &path) noexcept -> SourcePtr;
 
+    /// Create a source for a file path that maps the file into memory.
+    ///
+    /// Instead of reading the file through a stream, the file is mapped into memory when the source is
+    /// opened, and the lines are decoded directly from the mapping. Use this source for large documents,
+    /// where copying the data is noticeable. The source identifier is the same as for `fromFile()`.
+    ///
+    /// @param path The path to the file.
+    ///
+    [[nodiscard]] static auto fromMappedFile(const String &path) noexcept -> SourcePtr;
+    /// @copydoc fromMappedFile(const String&)
+    [[nodiscard]] static auto fromMappedFile(const std::filesystem::path &path) noexcept -> SourcePtr;
+
     /// Create a source from the given UTF-8 encoded string.
     ///
     /// @param text The string with the text. A copy of the string is stored in the source.
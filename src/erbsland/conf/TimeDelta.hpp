@@ -7,8 +7,9 @@
 #include "TimeUnit.hpp"
 
 #include <algorithm>
-#include <map>
-#include <ranges>
+#include <array>
+#include <bit>
+#include <cstdint>
 
 
 namespace erbsland::conf {
@@ -22,6 +23,9 @@ namespace erbsland::conf {
 /// converting it to seconds. If you alter a date using this time delta, it is best to add years and months first
 /// before adding other units.
 ///
+/// The counts are stored inline in a fixed array that is indexed by the time unit, therefore, creating and
+/// copying a time delta never allocates memory.
+///
 /// @tested `TimeDeltaTest`
 ///
 class TimeDelta final {
@@ -33,7 +37,7 @@ public:
 public:
     /// Create a time delta with a single unit.
     ///
-    TimeDelta(TimeUnit unit, Count count) noexcept : _counts{std::pair{unit, count}} {};
+    TimeDelta(TimeUnit unit, Count count) noexcept { setCount(unit, count); };
 
     /// Default constructor.
     TimeDelta() = default;
@@ -128,8 +132,8 @@ public: // accessors
     /// Test if this time delta is zero.
     ///
     [[nodiscard]] auto isZero() const noexcept -> bool {
-        return _counts.empty() || std::ranges::all_of(_counts, [](const auto &pair) {
-            return pair.second == 0;
+        return std::ranges::all_of(_counts, [](const Count count) {
+            return count == 0;
         });
     }
 
@@ -137,11 +141,11 @@ public: // accessors
     ///
     /// This is the case if the time delta is default constructed and contains no counts.
     ///
-    [[nodiscard]] auto empty() const noexcept -> bool { return _counts.empty(); }
+    [[nodiscard]] auto empty() const noexcept -> bool { return _definedUnits == 0; }
 
     /// Test if this time delta combines multiple counts.
     ///
-    [[nodiscard]] auto hasMultipleCounts() const noexcept -> bool { return _counts.size() > 1; }
+    [[nodiscard]] auto hasMultipleCounts() const noexcept -> bool { return std::popcount(_definedUnits) > 1; }
 
     /// Get the count for a specific time unit.
     ///
@@ -150,7 +154,7 @@ public: // accessors
     ///
     template<TimeUnit::Enum tUnit>
     [[nodiscard]] auto count() const noexcept -> Count {
-        return _counts.contains(tUnit) ? _counts.at(tUnit) : 0;
+        return _counts[tUnit];
     }
 
     /// Get the count for a specific time unit.
@@ -159,7 +163,7 @@ public: // accessors
     /// @return The count for the specified unit, or zero if not set.
     ///
     [[nodiscard]] auto count(TimeUnit unit) const noexcept -> Count {
-        return _counts.contains(unit) ? _counts.at(unit) : 0;
+        return _counts[toIndex(unit)];
     }
 
     /// Set the count for a specific time unit.
@@ -170,6 +174,7 @@ public: // accessors
     template<TimeUnit::Enum tUnit>
     void setCount(Count count) noexcept {
         _counts[tUnit] = count;
+        _definedUnits |= unitBit(tUnit);
     }
 
     /// Set the count for a specific time unit.
@@ -178,16 +183,19 @@ public: // accessors
     /// @param count The count to set for the unit.
     ///
     void setCount(TimeUnit unit, Count count) noexcept {
-        _counts[unit] = count;
+        _counts[toIndex(unit)] = count;
+        _definedUnits |= unitBit(toIndex(unit));
     }
 
     /// Get all times units that are defined for this delta.
     ///
     [[nodiscard]] auto units() const noexcept -> std::vector<TimeUnit> {
         std::vector<TimeUnit> result;
-        result.reserve(_counts.size());
-        for (const auto &unit : _counts | std::views::keys) {
-            result.push_back(unit);
+        result.reserve(static_cast<std::size_t>(std::popcount(_definedUnits)));
+        for (const auto unit : TimeUnit::all()) {
+            if ((_definedUnits & unitBit(toIndex(unit))) != 0) {
+                result.push_back(unit);
+            }
         }
         return result;
     }
@@ -343,7 +351,19 @@ public: // conversion
     [[nodiscard]] auto toText() const -> String;
 
 private:
-    std::map<TimeUnit, Count> _counts;
+    /// The number of time units.
+    static constexpr std::size_t cUnitCount = static_cast<std::size_t>(TimeUnit::Years) + 1;
+
+    [[nodiscard]] static constexpr auto toIndex(const TimeUnit unit) noexcept -> std::size_t {
+        return static_cast<std::size_t>(static_cast<TimeUnit::Enum>(unit));
+    }
+    [[nodiscard]] static constexpr auto unitBit(const std::size_t index) noexcept -> uint16_t {
+        return static_cast<uint16_t>(1U << index);
+    }
+
+private:
+    std::array<Count, cUnitCount> _counts{}; ///< The count for each unit, zero for undefined units.
+    uint16_t _definedUnits{0}; ///< A bit mask with the units that were set.
 };
 
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2024-2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2024-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #include "Value.hpp"
 
@@ -146,6 +146,29 @@ auto Value::lastValue() const noexcept -> ValuePtr {
 }
 
 
+auto Value::value(const ValueHandle &handle) const noexcept -> ValuePtr {
+    return handle.resolve(*this);
+}
+
+
+auto Value::valueOrThrow(const ValueHandle &handle) const -> ValuePtr {
+    auto valuePtr = handle.resolve(*this);
+    if (valuePtr == nullptr) {
+        impl::Value::throwValueNotFound(*this, handle.namePath());
+    }
+    return valuePtr;
+}
+
+
+auto Value::typedValueOrThrow(const ValueHandle &handle, const ValueType expectedType) const -> ValuePtr {
+    auto valuePtr = valueOrThrow(handle);
+    if (valuePtr->type() != expectedType) {
+        impl::Value::throwTypeMismatch(*this, expectedType, valuePtr->type(), handle.namePath());
+    }
+    return valuePtr;
+}
+
+
 auto Value::getInteger(const NamePathLike &namePath, const Integer defaultValue) const noexcept -> Integer {
     return impl::Value::valueGetter<Integer>(*this, namePath, defaultValue);
 }
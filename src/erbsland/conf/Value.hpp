@@ -1,4 +1,4 @@
-// Copyright (c) 2024-2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2024-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
@@ -9,13 +9,16 @@
 #include "Float.hpp"
 #include "fwd.hpp"
 #include "Integer.hpp"
+#include "ListView.hpp"
 #include "Location.hpp"
+#include "MatrixView.hpp"
 #include "NamePath.hpp"
 #include "RegEx.hpp"
 #include "StringConvertible.hpp"
 #include "TestFormat.hpp"
 #include "Time.hpp"
 #include "TimeDelta.hpp"
+#include "ValueHandle.hpp"
 #include "ValueIterator.hpp"
 #include "ValueList.hpp"
 #include "ValueMatrix.hpp"
@@ -24,6 +27,12 @@
 #include "impl/utf8/U8Format.hpp"
 #include "impl/utilities/SaturationMath.hpp"
 #include "impl/utilities/TypeTraits.hpp"
+#include "impl/value/PackedValues.hpp"
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <string_view>
 
 
 namespace erbsland::conf {
@@ -57,6 +66,12 @@ public: // basic properties.
     [[nodiscard]] virtual auto parent() const noexcept -> ValuePtr = 0;
     /// The type of this value.
     [[nodiscard]] virtual auto type() const noexcept -> ValueType = 0;
+    /// A hash of the type, name and content of this value, including all children.
+    /// The hash is calculated on the first call and cached until the document is modified, e.g. by a
+    /// validation. Values with the same name and content have the same hash, independent of their location
+    /// and of the order of the values in a section. Use it to quickly detect equal values or subtrees.
+    /// @return The 64-bit content hash.
+    [[nodiscard]] virtual auto contentHash() const noexcept -> uint64_t = 0;
 
 public: // location
     /// Test if this value has location info.
@@ -101,6 +116,16 @@ public: // lists
     /// @return The child value.
     /// @throws Error (NotFound, Syntax) if the value does not exist or the name-path contains syntax errors.
     [[nodiscard]] virtual auto valueOrThrow(const NamePathLike &namePath) const -> ValuePtr = 0;
+    /// Get the child-value for a precompiled value handle.
+    /// The handle caches the resolved value, so repeated lookups do not walk the name-path.
+    /// @param handle The value handle, relative to this value.
+    /// @return The child value, or `nullptr` if there is no value at the name-path of the handle.
+    [[nodiscard]] auto value(const ValueHandle &handle) const noexcept -> ValuePtr;
+    /// Get the child-value for a precompiled value handle.
+    /// @param handle The value handle, relative to this value.
+    /// @return The child value.
+    /// @throws Error (NotFound) if the value does not exist.
+    [[nodiscard]] auto valueOrThrow(const ValueHandle &handle) const -> ValuePtr;
     /// Get an iterator to the first child value.
     /// @return The value iterator.
     [[nodiscard]] virtual auto begin() const noexcept -> ValueIterator = 0;
@@ -108,6 +133,58 @@ public: // lists
     /// @return The value iterator.
     [[nodiscard]] virtual auto end() const noexcept -> ValueIterator = 0;
 
+public: // borrowed access
+    /// @name Borrowed Access
+    ///
+    /// These methods return references and views to the data stored in this value, instead of copies.
+    /// They do not allocate memory and do not change reference counts, which makes them suitable for
+    /// loops over many values.
+    ///
+    /// A returned reference or view is only valid as long as this value exists and is not modified. Values
+    /// are only modified while a document is built or validated. Therefore, keep a `DocumentPtr` or `ValuePtr`
+    /// to the value while you use the borrowed data, and do not keep it after a document was validated again.
+    ///
+    /// @{
+
+    /// Access the name without a copy.
+    /// @return A reference to the name, or an empty name for the document.
+    [[nodiscard]] virtual auto nameRef() const noexcept -> const Name& = 0;
+    /// Access the location without a copy.
+    /// @return A reference to the location, which is undefined if this value has no location.
+    [[nodiscard]] virtual auto locationRef() const noexcept -> const Location& = 0;
+    /// Access the text of a text value without a copy.
+    /// @return A view to the text, or an empty view if this is no text value.
+    [[nodiscard]] virtual auto textView() const noexcept -> std::u8string_view = 0;
+    /// Access the data of a bytes value without a copy.
+    /// @return A view to the bytes, or an empty view if this is no bytes value.
+    [[nodiscard]] virtual auto bytesView() const noexcept -> std::span<const std::byte> = 0;
+
+    /// Call a function for each element of the name-path of this value.
+    ///
+    /// The function is called with the same names, and in the same order as the elements of `namePath()`,
+    /// starting with the top-most section. No name-path is built, instead, the parents are visited
+    /// recursively. This does not allocate memory, but it locks each parent for the duration of the call.
+    ///
+    /// @tparam Fn A function with the signature `void(const Name&)`.
+    /// @param fn The function to call. The name reference is only valid during the call.
+    ///
+    template<typename Fn>
+    void forEachNamePathElement(Fn &&fn) const {
+        if (isRoot()) {
+            return; // The document has an empty name-path.
+        }
+        if (const auto parentValue = parent(); parentValue != nullptr) {
+            parentValue->forEachNamePathElement(fn);
+        }
+        fn(nameRef());
+    }
+
+    /// Access the packed storage of a homogeneous value list.
+    /// @private
+    /// @return The packed values, or `nullptr` if this is no value list.
+    [[nodiscard]] virtual auto packedValues() const noexcept -> const impl::PackedValues* { return nullptr; }
+    /// @}
+
 public: // conversions
     /// @name Access as Typed Value
     /// These methods return the contained value if it has the requested type. Otherwise, a default-constructed
@@ -260,6 +337,32 @@ public: // conversions
     [[nodiscard]] auto asMatrixOrThrow() const -> Matrix<T>;
     /// @}
 
+    /// @name Access as Packed Lists and Matrices
+    ///
+    /// - Access uniform lists and matrices of integer or float values, without a `ValuePtr` per element.
+    /// - If this is a value list with values of the requested type, the returned view borrows the packed storage
+    ///   of the list without a copy. Keep a `DocumentPtr` or `ValuePtr` to this value while you use the view.
+    /// - In all other cases, the values are converted like `asList()` and `asMatrix()` do, and the returned
+    ///   view owns the converted values.
+    ///
+    /// @{
+
+    /// @return A view to the values, or an empty view on any problem.
+    template<typename T> requires std::same_as<T, Integer> || std::same_as<T, Float>
+    [[nodiscard]] auto asSpan() const noexcept -> ListView<T>;
+    /// @return A view to the values.
+    /// @throws Error (TypeMismatch) if this is no list of values of this type.
+    template<typename T> requires std::same_as<T, Integer> || std::same_as<T, Float>
+    [[nodiscard]] auto asSpanOrThrow() const -> ListView<T>;
+    /// @return A view to the matrix, or an empty view on any problem.
+    template<typename T> requires std::same_as<T, Integer> || std::same_as<T, Float>
+    [[nodiscard]] auto asMatrixView() const noexcept -> MatrixView<T>;
+    /// @return A view to the matrix.
+    /// @throws Error (TypeMismatch) if this is no matrix of values of this type.
+    template<typename T> requires std::same_as<T, Integer> || std::same_as<T, Float>
+    [[nodiscard]] auto asMatrixViewOrThrow() const -> MatrixView<T>;
+    /// @}
+
     /// Convert this value to a value list.
     /// In contrast with `asValueList`, this method will not only return a value list if this *is* a value list,
     /// but also if this is a scalar value (Text, Integer, Float, Boolean, Date, Time, Date-Time, Bytes, TimeDelta, RegEx).
@@ -353,6 +456,20 @@ public: // Convenience methods.
     [[nodiscard]] auto getOrThrow(const NamePathLike &namePath) const -> tExpectedType {
         return static_cast<tExpectedType>(getFloatOrThrow(namePath));
     }
+    /// @param handle A precompiled value handle, relative to this value.
+    /// @param defaultValue The default value returned if the value can't be resolved.
+    /// @tparam tExpectedType The type to expect, e.g. `String`, `Integer`.
+    /// @return the requested value or `defaultValue`.
+    template<typename tExpectedType>
+    [[nodiscard]] auto get(const ValueHandle &handle, impl::value_get_default_param_t<tExpectedType> defaultValue = {}) const noexcept -> tExpectedType;
+    /// @param handle A precompiled value handle, relative to this value.
+    /// @throws Error If the value does not exist or has the wrong type.
+    /// @tparam tExpectedType The type to expect, e.g. `String`, `Integer`.
+    /// @return The requested value.
+    template<typename tExpectedType>
+    [[nodiscard]] auto getOrThrow(const ValueHandle &handle) const -> tExpectedType;
+    /// @private
+    [[nodiscard]] auto typedValueOrThrow(const ValueHandle &handle, ValueType expectedType) const -> ValuePtr;
     /// @param namePath The name path, name or index to resolve, relative to this value.
     /// @param defaultValue The default value returned if the value can't be resolved.
     /// @return The value or `defaultValue` if there is no matching value at `namePath`.
@@ -520,4 +637,5 @@ public: // Convenience methods.
 #include "Value_get.tpp"
 #include "Value_list.tpp"
 #include "Value_matrix.tpp"
+#include "Value_span.tpp"
 
@@ -0,0 +1,93 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "ValueHandle.hpp"
+
+
+#include "Value.hpp"
+
+#include "impl/value/ValueTreeGeneration.hpp"
+
+
+namespace erbsland::conf {
+
+
+ValueHandle::ValueHandle(const NamePathLike &namePath) : _namePath{toNamePath(namePath)} {
+}
+
+
+ValueHandle::ValueHandle(const ValueHandle &other) : _namePath{other._namePath}, _cache{other.cacheCopy()} {
+}
+
+
+ValueHandle::ValueHandle(ValueHandle &&other) noexcept
+    : _namePath{std::move(other._namePath)}, _cache{other.cacheCopy()} {
+}
+
+
+auto ValueHandle::operator=(const ValueHandle &other) -> ValueHandle& {
+    if (this != &other) {
+        auto cache = other.cacheCopy();
+        _namePath = other._namePath;
+        std::scoped_lock lock{_cacheMutex};
+        _cache = std::move(cache);
+    }
+    return *this;
+}
+
+
+auto ValueHandle::operator=(ValueHandle &&other) noexcept -> ValueHandle& {
+    if (this != &other) {
+        auto cache = other.cacheCopy();
+        _namePath = std::move(other._namePath);
+        std::scoped_lock lock{_cacheMutex};
+        _cache = std::move(cache);
+    }
+    return *this;
+}
+
+
+auto ValueHandle::resolve(const Value &base) const noexcept -> ValuePtr {
+    const auto generation = impl::ValueTreeGeneration::currentFor(base);
+    std::weak_ptr<Value> cachedValue;
+    {
+        std::scoped_lock lock{_cacheMutex};
+        if (_cache.base == &base && _cache.generation == generation && !_cache.baseRef.expired()) {
+            if (_cache.isMissing) {
+                return {};
+            }
+            cachedValue = _cache.value;
+        }
+    }
+    if (auto value = cachedValue.lock(); value != nullptr) {
+        return value;
+    }
+    auto value = _namePath.empty() ? ValuePtr{} : base.value(_namePath);
+    auto baseRef = base.weak_from_this();
+    if (baseRef.expired()) {
+        return value; // Only cache values from shared base values.
+    }
+    std::scoped_lock lock{_cacheMutex};
+    _cache = Cache{
+        .base = &base,
+        .baseRef = std::move(baseRef),
+        .value = value,
+        .generation = generation,
+        .isMissing = (value == nullptr)};
+    return value;
+}
+
+
+void ValueHandle::reset() noexcept {
+    std::scoped_lock lock{_cacheMutex};
+    _cache = {};
+}
+
+
+auto ValueHandle::cacheCopy() const noexcept -> Cache {
+    std::scoped_lock lock{_cacheMutex};
+    return _cache;
+}
+
+
+}
+
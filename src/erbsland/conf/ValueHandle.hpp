@@ -0,0 +1,97 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "fwd.hpp"
+#include "NamePath.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+
+namespace erbsland::conf {
+
+
+/// A precompiled name-path, that caches the value it resolves to.
+///
+/// Use a value handle for values that are accessed repeatedly, e.g. on a hot path of a service. The name-path
+/// is parsed once when the handle is created. The first lookup resolves the value and stores a weak reference
+/// to it. Later lookups from the same base value return the cached value without walking the name-path.
+/// Values that do not exist are cached as well.
+///
+/// The cache is discarded if the handle is used with a different base value, if the base value was destroyed,
+/// or if the document of the base value was modified by a validation since the value was resolved.
+///
+/// ```cpp
+/// static const auto poolSize = ValueHandle{u8"server.pool.size"};
+/// const auto size = doc->get<int>(poolSize, 8);
+/// ```
+///
+/// *Multithreading*: A handle can be shared and used from multiple threads at the same time. The cache is
+/// protected by a mutex, so threads that use the same handle on a hot path wait for each other briefly.
+/// Give each thread its own copy of the handle if this is a concern.
+///
+/// @tested `ValueHandleTest`
+///
+class ValueHandle final {
+public:
+    /// Create a new value handle.
+    ///
+    /// @param namePath A name-path, name, or index, relative to the base value.
+    /// @throws Error (Syntax) if the name-path contains syntax errors.
+    ///
+    explicit ValueHandle(const NamePathLike &namePath);
+
+    /// Copy the name-path and the cached value.
+    ValueHandle(const ValueHandle &other);
+    /// Move the name-path and the cached value.
+    ValueHandle(ValueHandle &&other) noexcept;
+    /// Default destructor.
+    ~ValueHandle() = default;
+    /// Copy the name-path and the cached value.
+    auto operator=(const ValueHandle &other) -> ValueHandle&;
+    /// Move the name-path and the cached value.
+    auto operator=(ValueHandle &&other) noexcept -> ValueHandle&;
+
+public:
+    /// Get the parsed name-path of this handle.
+    ///
+    [[nodiscard]] auto namePath() const noexcept -> const NamePath& {
+        return _namePath;
+    }
+
+    /// Resolve the value relative to the given base value.
+    ///
+    /// @param base The base value, e.g. the document.
+    /// @return The resolved value, or `nullptr` if there is no value at the name-path.
+    ///
+    [[nodiscard]] auto resolve(const Value &base) const noexcept -> ValuePtr;
+
+    /// Discard the cached value.
+    ///
+    void reset() noexcept;
+
+private:
+    /// The result of the last lookup.
+    struct Cache {
+        const Value *base{nullptr}; ///< The base value of the cached lookup.
+        std::weak_ptr<const Value> baseRef; ///< A reference to detect if the base value was destroyed.
+        std::weak_ptr<Value> value; ///< The resolved value.
+        uint64_t generation{0}; ///< The value-tree generation of the cached lookup.
+        bool isMissing{false}; ///< If the cached lookup found no value.
+    };
+
+    /// Get a copy of the cache.
+    [[nodiscard]] auto cacheCopy() const noexcept -> Cache;
+
+private:
+    NamePath _namePath; ///< The parsed name-path.
+    mutable std::mutex _cacheMutex; ///< The mutex to protect the cache.
+    mutable Cache _cache; ///< The cached lookup.
+};
+
+
+}
+
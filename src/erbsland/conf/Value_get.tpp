@@ -34,6 +34,26 @@ auto Value::get(const NamePathLike &namePath, tExpectedType defaultValue) const
 }
 
 
+template<typename tExpectedType>
+auto Value::get(
+    const ValueHandle &handle,
+    impl::value_get_default_param_t<tExpectedType> defaultValue) const noexcept -> tExpectedType {
+
+    const auto valuePtr = value(handle);
+    if (valuePtr == nullptr || valuePtr->type() != ValueType::from<tExpectedType>()) {
+        return defaultValue;
+    }
+    return valuePtr->template asType<tExpectedType>();
+}
+
+
+template<typename tExpectedType>
+auto Value::getOrThrow(const ValueHandle &handle) const -> tExpectedType {
+    const auto valuePtr = typedValueOrThrow(handle, ValueType::from<tExpectedType>());
+    return valuePtr->template asTypeOrThrow<tExpectedType>();
+}
+
+
 template<typename tDefaultString>
 requires StringLike<tDefaultString>
 [[nodiscard]] auto Value::getText(
@@ -0,0 +1,64 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+namespace erbsland::conf {
+
+
+template <typename T> requires std::same_as<T, Integer> || std::same_as<T, Float>
+auto Value::asSpanOrThrow() const -> ListView<T> {
+    if (const auto *packed = packedValues(); packed != nullptr && packed->isPacked<T>() && !packed->isNested()) {
+        return ListView<T>{packed->values<T>()};
+    }
+    return ListView<T>{asListOrThrow<T>()};
+}
+
+
+template <typename T> requires std::same_as<T, Integer> || std::same_as<T, Float>
+auto Value::asSpan() const noexcept -> ListView<T> {
+    try {
+        return asSpanOrThrow<T>();
+    } catch (const Error &) {
+        return {};
+    }
+}
+
+
+template <typename T> requires std::same_as<T, Integer> || std::same_as<T, Float>
+auto Value::asMatrixViewOrThrow() const -> MatrixView<T> {
+    if (const auto *packed = packedValues(); packed != nullptr && packed->isPacked<T>()) {
+        return MatrixView<T>{
+            ListView<T>{packed->values<T>()},
+            ListView<std::size_t>{packed->rowOffsets()},
+            packed->columnCount()};
+    }
+    const auto matrix = asMatrixOrThrow<T>();
+    std::vector<T> values;
+    std::vector<std::size_t> rowOffsets;
+    rowOffsets.reserve(matrix.rowCount() + 1);
+    for (std::size_t row = 0; row < matrix.rowCount(); ++row) {
+        rowOffsets.push_back(values.size());
+        for (std::size_t column = 0; column < matrix.actualColumnCount(row); ++column) {
+            values.push_back(matrix.value(row, column));
+        }
+    }
+    rowOffsets.push_back(values.size());
+    return MatrixView<T>{
+        ListView<T>{std::move(values)},
+        ListView<std::size_t>{std::move(rowOffsets)},
+        matrix.columnCount()};
+}
+
+
+template <typename T> requires std::same_as<T, Integer> || std::same_as<T, Float>
+auto Value::asMatrixView() const noexcept -> MatrixView<T> {
+    try {
+        return asMatrixViewOrThrow<T>();
+    } catch (const Error &) {
+        return {};
+    }
+}
+
+
+}
@@ -14,6 +14,8 @@
 #include "DateTime.hpp"
 #include "Document.hpp"
 #include "DocumentBuilder.hpp"
+#include "DocumentDiff.hpp"
+#include "DocumentSnapshot.hpp"
 #include "Error.hpp"
 #include "ErrorCategory.hpp"
 #include "EscapeMode.hpp"
@@ -21,12 +23,15 @@
 #include "FileSourceResolver.hpp"
 #include "Float.hpp"
 #include "Integer.hpp"
+#include "ListView.hpp"
 #include "Location.hpp"
 #include "Matrix.hpp"
+#include "MatrixView.hpp"
 #include "Name.hpp"
 #include "NamePath.hpp"
 #include "NameType.hpp"
 #include "Parser.hpp"
+#include "ParserCache.hpp"
 #include "Position.hpp"
 #include "RegEx.hpp"
 #include "SignatureSigner.hpp"
@@ -48,6 +53,7 @@
 #include "TimeOffset.hpp"
 #include "TimeUnit.hpp"
 #include "Value.hpp"
+#include "ValueHandle.hpp"
 #include "ValueIterator.hpp"
 #include "ValueList.hpp"
 #include "ValueMatrix.hpp"
@@ -24,40 +24,44 @@ AssignmentStream::AssignmentStream(LexerPtr lexer, PrivateTag)
 
 
 auto AssignmentStream::assignments() -> AssignmentGenerator {
-    initialize();
-    // Read tokens until the end of the document is reached.
-    while (token().type() != TokenType::EndOfData) {
-        switch (token().type().raw()) {
-        case TokenType::LineBreak:
-        case TokenType::Indentation:
-        case TokenType::Spacing:
-        case TokenType::Comment:
-            next(); // Consume empty lines, comments, indentation and spacing.
-            break;
-        case TokenType::MetaName:
-            co_yield handleMetaValue();
-            break;
-        case TokenType::RegularName:
-        case TokenType::TextName:
-            co_yield handleValue();
-            break;
-        case TokenType::SectionMapOpen:
-        case TokenType::SectionListOpen:
-            co_yield handleSection();
-            break;
-        default:
-            // Coverage: The lexer catches most errors, probably never used.
-            throwSyntaxError(u8"Expected a section or named value, but got something else.");
-        }
+    initialize(TokenSource::Generator);
+    Assignment assignment;
+    while (readAssignment(assignment)) {
+        co_yield std::move(assignment);
     }
     co_yield Assignment{}; // signal the end of the document.
     co_return;
 }
 
 
-void AssignmentStream::initialize() {
+auto AssignmentStream::nextAssignment(Assignment &assignment) -> bool {
+    if (_tokenSource == TokenSource::None) {
+        initialize(TokenSource::StateMachine);
+    } else if (_tokenSource != TokenSource::StateMachine) {
+        throw Error(ErrorCategory::Internal, u8"The assignment stream was already started as generator.");
+    }
+    if (_isEndOfDocument) {
+        return false;
+    }
+    if (!readAssignment(assignment)) {
+        assignment = Assignment{}; // signal the end of the document.
+        _isEndOfDocument = true;
+    }
+    return true;
+}
+
+
+void AssignmentStream::initialize(const TokenSource tokenSource) {
+    _tokenSource = tokenSource;
     _documentArea = DocumentArea::Root; // make it explicit.
     _currentSectionPath = {};
+    if (_tokenSource == TokenSource::StateMachine) {
+        // Start with the first token from the lexer.
+        if (!_lexer->nextToken(_token)) {
+            _token = LexerToken{TokenType::EndOfData};
+        }
+        return;
+    }
     _lexerGenerator = _lexer->tokens();
     _tokenIterator = _lexerGenerator.begin();
     _tokenIteratorEnd = _lexerGenerator.end();
@@ -72,7 +76,47 @@ void AssignmentStream::initialize() {
 }
 
 
+auto AssignmentStream::readAssignment(Assignment &assignment) -> bool {
+    // Read tokens until the next assignment, or the end of the document is reached.
+    while (token().type() != TokenType::EndOfData) {
+        switch (token().type().raw()) {
+        case TokenType::LineBreak:
+        case TokenType::Indentation:
+        case TokenType::Spacing:
+        case TokenType::Comment:
+            next(); // Consume empty lines, comments, indentation and spacing.
+            break;
+        case TokenType::MetaName:
+            assignment = handleMetaValue();
+            return true;
+        case TokenType::RegularName:
+        case TokenType::TextName:
+            assignment = handleValue();
+            return true;
+        case TokenType::SectionMapOpen:
+        case TokenType::SectionListOpen:
+            assignment = handleSection();
+            return true;
+        default:
+            // Coverage: The lexer catches most errors, probably never used.
+            throwSyntaxError(u8"Expected a section or named value, but got something else.");
+        }
+    }
+    return false;
+}
+
+
 void AssignmentStream::next() {
+    if (_tokenSource == TokenSource::StateMachine) {
+        // The token is moved into the existing slot, without creating a copy.
+        while (_lexer->nextToken(_token)) {
+            if (_token.type() != TokenType::Spacing && _token.type() != TokenType::Comment) {
+                return; // Found a meaningful token.
+            }
+        }
+        _token = LexerToken{TokenType::EndOfData};
+        return;
+    }
     while (_tokenIterator != _tokenIteratorEnd) {
         _token = *_tokenIterator;
         ++_tokenIterator;
@@ -244,7 +288,7 @@ auto AssignmentStream::handleValue() -> Assignment {
         if (valueList.size() == 1) {
             return createAssignment(std::move(valueList.front()));
         }
-        auto value = Value::createValueList(std::move(valueList));
+        auto value = Value::createValueList(std::move(valueList), _valueArena);
         return createAssignment(std::move(value));
     }
     case TokenType::MultiLineValueListSeparator: {
@@ -252,23 +296,23 @@ auto AssignmentStream::handleValue() -> Assignment {
         if (valueList.size() == 1) {
             return createAssignment(std::move(valueList.front()));
         }
-        auto value = Value::createValueList(std::move(valueList));
+        auto value = Value::createValueList(std::move(valueList), _valueArena);
         return createAssignment(std::move(value));
     }
     case TokenType::MultiLineTextOpen:
     case TokenType::MultiLineCodeOpen: {
         auto text = handleMultiLineText();
-        auto value = Value::createText(std::move(text));
+        auto value = Value::createText(std::move(text), _valueArena);
         return createAssignment(std::move(value));
     }
     case TokenType::MultiLineRegexOpen: {
         auto text = handleMultiLineRegEx();
-        auto value = Value::createRegEx(RegEx{std::move(text), true});
+        auto value = Value::createRegEx(RegEx{std::move(text), true}, _valueArena);
         return createAssignment(std::move(value));
     }
     case TokenType::MultiLineBytesOpen: {
         auto data = handleMultiLineBytes();
-        auto value = Value::createBytes(std::move(data));
+        auto value = Value::createBytes(std::move(data), _valueArena);
         return createAssignment(std::move(value));
     }
     default:
@@ -283,35 +327,35 @@ auto AssignmentStream::handleValueOrValueList() -> std::vector<ValuePtr> {
     while (!(token().type() == TokenType::LineBreak || token().type() == TokenType::EndOfData)) {
         switch (token().type().raw()) {
         case TokenType::Integer:
-            value = Value::createInteger(std::get<Integer>(token().content()));
+            value = Value::createInteger(std::get<Integer>(token().content()), _valueArena);
             break;
         case TokenType::Float:
-            value = Value::createFloat(std::get<Float>(token().content()));
+            value = Value::createFloat(std::get<Float>(token().content()), _valueArena);
             break;
         case TokenType::Boolean:
-            value = Value::createBoolean(std::get<bool>(token().content()));
+            value = Value::createBoolean(std::get<bool>(token().content()), _valueArena);
             break;
         case TokenType::Text:
         case TokenType::Code:
-            value = Value::createText(std::get<String>(token().content()));
+            value = Value::createText(std::get<String>(token().content()), _valueArena);
             break;
         case TokenType::RegEx:
-            value = Value::createRegEx(RegEx{std::get<String>(token().content()), false});
+            value = Value::createRegEx(RegEx{std::get<String>(token().content()), false}, _valueArena);
             break;
         case TokenType::Date:
-            value = Value::createDate(std::get<Date>(token().content()));
+            value = Value::createDate(std::get<Date>(token().content()), _valueArena);
             break;
         case TokenType::DateTime:
-            value = Value::createDateTime(std::get<DateTime>(token().content()));
+            value = Value::createDateTime(std::get<DateTime>(token().content()), _valueArena);
             break;
         case TokenType::Time:
-            value = Value::createTime(std::get<Time>(token().content()));
+            value = Value::createTime(std::get<Time>(token().content()), _valueArena);
             break;
         case TokenType::TimeDelta:
-            value = Value::createTimeDelta(std::get<TimeDelta>(token().content()));
+            value = Value::createTimeDelta(std::get<TimeDelta>(token().content()), _valueArena);
             break;
         case TokenType::Bytes:
-            value = Value::createBytes(std::get<Bytes>(token().content()));
+            value = Value::createBytes(std::get<Bytes>(token().content()), _valueArena);
             break;
         default:
             throw Error(ErrorCategory::Internal, u8"Unexpected token type for value.");
@@ -338,7 +382,7 @@ auto AssignmentStream::handleMultiLineValueList() -> std::vector<ValuePtr> {
         if (subValueList.size() == 1) {
             value = subValueList.front();
         } else {
-            value = Value::createValueList(std::move(subValueList));
+            value = Value::createValueList(std::move(subValueList), _valueArena);
         }
         value->setLocation(bulletLocation);
         valueList.emplace_back(std::move(value));
@@ -431,7 +475,7 @@ auto AssignmentStream::handleMultiLineBytes() -> Bytes {
     // Consume the open sequence and expect, skip the format and expect an empty line or indentation.
     expectNext(TokenType::LineBreak, TokenType::MultiLineBytesFormat);
     if (token().type() == TokenType::MultiLineBytesFormat) {
-        expectNext(TokenType::LineBreak); // Consume the format (ignored, as only hex is supported).
+        expectNext(TokenType::LineBreak); // Consume the format (ignored, the lexer already decoded the bytes).
     }
     expectNext(TokenType::Indentation, TokenType::LineBreak);
     Bytes result;
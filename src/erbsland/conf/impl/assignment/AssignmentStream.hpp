@@ -7,8 +7,10 @@
 #include "AssignmentGenerator.hpp"
 
 #include "../lexer/Lexer.hpp"
+#include "../value/ValueArena.hpp"
 
 #include <cassert>
+#include <utility>
 
 
 namespace erbsland::conf::impl {
@@ -61,6 +63,17 @@ class AssignmentStream final {
         AfterSection,
     };
 
+    /// The source of the lexer tokens.
+    ///
+    enum class TokenSource : uint8_t {
+        /// The stream was not started yet.
+        None,
+        /// The tokens are read from the coroutine generator `Lexer::tokens()`.
+        Generator,
+        /// The tokens are read using the state machine with `Lexer::nextToken()`.
+        StateMachine,
+    };
+
 public:
     /// Create a new assignment stream.
     ///
@@ -87,10 +100,42 @@ public:
     ///
     auto assignments() -> AssignmentGenerator;
 
+    /// Read the next assignment from the document.
+    ///
+    /// This is the alternative to `assignments()` that reads the tokens using `Lexer::nextToken()`, without
+    /// any coroutines. It returns the same sequence of assignments. Only one of the two methods can be used
+    /// for a stream.
+    ///
+    /// @param assignment The slot that receives the next assignment.
+    /// @return `true` if an assignment was moved into the slot. `false` if the last `EndOfDocument` assignment
+    ///     was already read.
+    /// @throws Error For any problems while parsing the document.
+    ///
+    auto nextAssignment(Assignment &assignment) -> bool;
+
+    /// Set the arena for the values created by this stream.
+    ///
+    /// Meta-values are always allocated on the heap, as they are not added to the document.
+    ///
+    /// @param valueArena The arena, or `nullptr` to allocate all values on the heap.
+    ///
+    void setValueArena(ValueArenaPtr valueArena) noexcept {
+        _valueArena = std::move(valueArena);
+    }
+
 private:
-    /// Initialize the token generator and the iterators to process the tokens.
+    /// Initialize the token source and read the first token.
+    ///
+    /// @param tokenSource The source of the tokens.
+    ///
+    void initialize(TokenSource tokenSource);
+
+    /// Read tokens until the next assignment is complete.
+    ///
+    /// @param assignment The slot that receives the assignment.
+    /// @return `true` if an assignment was read, `false` at the end of the document.
     ///
-    void initialize();
+    auto readAssignment(Assignment &assignment) -> bool;
 
     /// Read the next non-spacing token.
     ///
@@ -186,6 +231,9 @@ private:
 
 private:
     LexerPtr _lexer; ///< The lexer instance passed to this assignment stream.
+    ValueArenaPtr _valueArena; ///< The arena for new values, or `nullptr` to use the heap.
+    TokenSource _tokenSource{TokenSource::None}; ///< The source of the tokens.
+    bool _isEndOfDocument{false}; ///< If the end-of-document assignment was read using `nextAssignment()`.
     TokenGenerator _lexerGenerator; ///< The token generator.
     TokenGenerator::iterator _tokenIterator; ///< The current token iterator.
     TokenGenerator::iterator _tokenIteratorEnd; ///< The end iterator for the token stream.
@@ -0,0 +1,306 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "AsciiScan.hpp"
+
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ERBSLAND_CONF_ASCII_SCAN_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define ERBSLAND_CONF_ASCII_SCAN_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace erbsland::conf::impl {
+
+
+namespace {
+
+
+/// The number of bytes tested at once.
+constexpr std::size_t cBlockSize = 16;
+
+
+/// Test if a single byte is a valid ASCII character.
+///
+[[nodiscard]] constexpr auto isValidAscii(const std::byte byte) noexcept -> bool {
+    const auto value = static_cast<uint8_t>(byte);
+    return (value >= 0x20U && value < 0x7fU) || value == 0x09U || value == 0x0aU || value == 0x0dU;
+}
+
+
+/// Continue the scan byte by byte.
+///
+[[nodiscard]] auto countValidAsciiScalar(
+    const std::span<const std::byte> data,
+    std::size_t index) noexcept -> std::size_t {
+    while (index < data.size() && isValidAscii(data[index])) {
+        index += 1;
+    }
+    return index;
+}
+
+
+/// Test if a byte is one of the stop bytes.
+///
+[[nodiscard]] auto isStopByte(const std::byte byte, const std::span<const std::byte> stopBytes) noexcept -> bool {
+    return std::ranges::find(stopBytes, byte) != stopBytes.end();
+}
+
+
+/// Get the value of a hex digit, or -1 if the byte is no hex digit.
+///
+[[nodiscard]] constexpr auto hexDigitValue(const std::byte byte) noexcept -> int {
+    const auto value = static_cast<uint8_t>(byte);
+    if (value >= '0' && value <= '9') {
+        return value - '0';
+    }
+    const auto lowerCaseValue = static_cast<uint8_t>(value | 0x20U);
+    if (lowerCaseValue >= 'a' && lowerCaseValue <= 'f') {
+        return lowerCaseValue - 'a' + 10;
+    }
+    return -1;
+}
+
+
+/// The values of all base64 digits, or -1 for all other bytes.
+///
+constexpr auto cBase64DigitValues = []() -> std::array<int8_t, 256> {
+    std::array<int8_t, 256> result{};
+    result.fill(-1);
+    for (int i = 0; i < 26; ++i) {
+        result[static_cast<std::size_t>('A' + i)] = static_cast<int8_t>(i);
+        result[static_cast<std::size_t>('a' + i)] = static_cast<int8_t>(26 + i);
+    }
+    for (int i = 0; i < 10; ++i) {
+        result[static_cast<std::size_t>('0' + i)] = static_cast<int8_t>(52 + i);
+    }
+    result['+'] = 62;
+    result['/'] = 63;
+    return result;
+}();
+
+
+}
+
+
+auto countValidAsciiPrefix(const std::span<const std::byte> data) noexcept -> std::size_t {
+    std::size_t index = 0;
+#if defined(ERBSLAND_CONF_ASCII_SCAN_SSE2)
+    const auto lowLimit = _mm_set1_epi8(0x20);
+    const auto deleteChar = _mm_set1_epi8(0x7f);
+    const auto tab = _mm_set1_epi8(0x09);
+    const auto newline = _mm_set1_epi8(0x0a);
+    const auto carriageReturn = _mm_set1_epi8(0x0d);
+    for (; index + cBlockSize <= data.size(); index += cBlockSize) {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + index));
+        // The comparison is signed, so all bytes from 0x80 are less than 0x20 as well.
+        const auto invalid = _mm_or_si128(_mm_cmplt_epi8(block, lowLimit), _mm_cmpeq_epi8(block, deleteChar));
+        const auto allowed = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(block, tab), _mm_cmpeq_epi8(block, newline)),
+            _mm_cmpeq_epi8(block, carriageReturn));
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_andnot_si128(allowed, invalid)));
+        if (mask != 0) {
+            return index + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+#elif defined(ERBSLAND_CONF_ASCII_SCAN_NEON)
+    const auto lowLimit = vdupq_n_u8(0x20U);
+    const auto deleteChar = vdupq_n_u8(0x7fU);
+    const auto tab = vdupq_n_u8(0x09U);
+    const auto newline = vdupq_n_u8(0x0aU);
+    const auto carriageReturn = vdupq_n_u8(0x0dU);
+    for (; index + cBlockSize <= data.size(); index += cBlockSize) {
+        const auto block = vld1q_u8(reinterpret_cast<const uint8_t*>(data.data() + index));
+        // Everything from 0x7f is invalid, including all bytes of multi-byte sequences.
+        const auto invalid = vorrq_u8(vcltq_u8(block, lowLimit), vcgeq_u8(block, deleteChar));
+        const auto allowed = vorrq_u8(
+            vorrq_u8(vceqq_u8(block, tab), vceqq_u8(block, newline)),
+            vceqq_u8(block, carriageReturn));
+        if (vmaxvq_u8(vbicq_u8(invalid, allowed)) != 0) {
+            break; // The scalar scan locates the exact byte in this block.
+        }
+    }
+#endif
+    return countValidAsciiScalar(data, index);
+}
+
+
+auto countAsciiPrefix(const std::span<const std::byte> data) noexcept -> std::size_t {
+    std::size_t index = 0;
+#if defined(ERBSLAND_CONF_ASCII_SCAN_SSE2)
+    for (; index + cBlockSize <= data.size(); index += cBlockSize) {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + index));
+        // The most significant bit is only set for bytes outside the 7-bit range.
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(block));
+        if (mask != 0) {
+            return index + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+#elif defined(ERBSLAND_CONF_ASCII_SCAN_NEON)
+    for (; index + cBlockSize <= data.size(); index += cBlockSize) {
+        const auto block = vld1q_u8(reinterpret_cast<const uint8_t*>(data.data() + index));
+        if (vmaxvq_u8(block) >= 0x80U) {
+            break; // The scalar scan locates the exact byte in this block.
+        }
+    }
+#endif
+    while (index < data.size() && static_cast<uint8_t>(data[index]) < 0x80U) {
+        index += 1;
+    }
+    return index;
+}
+
+
+auto countBytesBeforeAny(
+    const std::span<const std::byte> data,
+    const std::span<const std::byte> stopBytes) noexcept -> std::size_t {
+
+    assert(stopBytes.size() <= cMaxStopBytes);
+    std::size_t index = 0;
+#if defined(ERBSLAND_CONF_ASCII_SCAN_SSE2)
+    __m128i stopVectors[cMaxStopBytes]{}; // NOLINT(*-avoid-c-arrays): std::array drops the vector attributes.
+    for (std::size_t i = 0; i < stopBytes.size(); ++i) {
+        stopVectors[i] = _mm_set1_epi8(static_cast<char>(stopBytes[i]));
+    }
+    for (; index + cBlockSize <= data.size(); index += cBlockSize) {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + index));
+        auto hits = _mm_setzero_si128();
+        for (std::size_t i = 0; i < stopBytes.size(); ++i) {
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, stopVectors[i]));
+        }
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+        if (mask != 0) {
+            return index + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+#elif defined(ERBSLAND_CONF_ASCII_SCAN_NEON)
+    uint8x16_t stopVectors[cMaxStopBytes]{}; // NOLINT(*-avoid-c-arrays): std::array drops the vector attributes.
+    for (std::size_t i = 0; i < stopBytes.size(); ++i) {
+        stopVectors[i] = vdupq_n_u8(static_cast<uint8_t>(stopBytes[i]));
+    }
+    for (; index + cBlockSize <= data.size(); index += cBlockSize) {
+        const auto block = vld1q_u8(reinterpret_cast<const uint8_t*>(data.data() + index));
+        auto hits = vdupq_n_u8(0U);
+        for (std::size_t i = 0; i < stopBytes.size(); ++i) {
+            hits = vorrq_u8(hits, vceqq_u8(block, stopVectors[i]));
+        }
+        if (vmaxvq_u8(hits) != 0) {
+            break; // The scalar scan locates the exact byte in this block.
+        }
+    }
+#endif
+    while (index < data.size() && !isStopByte(data[index], stopBytes)) {
+        index += 1;
+    }
+    return index;
+}
+
+
+auto decodeHexDigitPairs(
+    const std::span<const std::byte> data,
+    const std::span<std::byte> output) noexcept -> std::size_t {
+
+    std::size_t index = 0;
+    std::size_t count = 0;
+#if defined(ERBSLAND_CONF_ASCII_SCAN_SSE2)
+    const auto digitZero = _mm_set1_epi8('0');
+    const auto letterA = _mm_set1_epi8('a');
+    const auto lowerCaseBit = _mm_set1_epi8(0x20);
+    const auto maximumDigit = _mm_set1_epi8(9);
+    const auto maximumLetter = _mm_set1_epi8(5);
+    const auto letterOffset = _mm_set1_epi8(10);
+    const auto lowByteMask = _mm_set1_epi16(0x00ff);
+    for (; index + cBlockSize <= data.size() && count + cBlockSize / 2 <= output.size();
+        index += cBlockSize, count += cBlockSize / 2) {
+
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + index));
+        // After the subtraction, valid digits and letters are in the ranges 0-9 and 0-5, all other bytes are larger.
+        const auto digits = _mm_sub_epi8(block, digitZero);
+        const auto letters = _mm_sub_epi8(_mm_or_si128(block, lowerCaseBit), letterA);
+        const auto isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digits, maximumDigit), digits);
+        const auto isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letters, maximumLetter), letters);
+        if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xffff) {
+            break; // The scalar decoder stops at the exact pair in this block.
+        }
+        const auto nibbles = _mm_or_si128(
+            _mm_and_si128(isDigit, digits),
+            _mm_and_si128(isLetter, _mm_add_epi8(letters, letterOffset)));
+        // Each 16-bit lane holds the high nibble in the low byte, and the low nibble in the high byte.
+        const auto pairs = _mm_or_si128(
+            _mm_slli_epi16(_mm_and_si128(nibbles, lowByteMask), 4),
+            _mm_srli_epi16(nibbles, 8));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output.data() + count), _mm_packus_epi16(pairs, pairs));
+    }
+#elif defined(ERBSLAND_CONF_ASCII_SCAN_NEON)
+    const auto digitZero = vdupq_n_u8('0');
+    const auto letterA = vdupq_n_u8('a');
+    const auto lowerCaseBit = vdupq_n_u8(0x20U);
+    const auto maximumDigit = vdupq_n_u8(9U);
+    const auto maximumLetter = vdupq_n_u8(5U);
+    const auto letterOffset = vdupq_n_u8(10U);
+    const auto lowByteMask = vdupq_n_u16(0x00ffU);
+    for (; index + cBlockSize <= data.size() && count + cBlockSize / 2 <= output.size();
+        index += cBlockSize, count += cBlockSize / 2) {
+
+        const auto block = vld1q_u8(reinterpret_cast<const uint8_t*>(data.data() + index));
+        // After the subtraction, valid digits and letters are in the ranges 0-9 and 0-5, all other bytes are larger.
+        const auto digits = vsubq_u8(block, digitZero);
+        const auto letters = vsubq_u8(vorrq_u8(block, lowerCaseBit), letterA);
+        const auto isDigit = vcleq_u8(digits, maximumDigit);
+        const auto isLetter = vcleq_u8(letters, maximumLetter);
+        if (vminvq_u8(vorrq_u8(isDigit, isLetter)) == 0) {
+            break; // The scalar decoder stops at the exact pair in this block.
+        }
+        const auto nibbles = vreinterpretq_u16_u8(vorrq_u8(
+            vandq_u8(isDigit, digits),
+            vandq_u8(isLetter, vaddq_u8(letters, letterOffset))));
+        // Each 16-bit lane holds the high nibble in the low byte, and the low nibble in the high byte.
+        const auto pairs = vorrq_u16(vshlq_n_u16(vandq_u16(nibbles, lowByteMask), 4), vshrq_n_u16(nibbles, 8));
+        vst1_u8(reinterpret_cast<uint8_t*>(output.data() + count), vmovn_u16(pairs));
+    }
+#endif
+    for (; index + 2 <= data.size() && count < output.size(); index += 2, count += 1) {
+        const auto high = hexDigitValue(data[index]);
+        const auto low = hexDigitValue(data[index + 1]);
+        if (high < 0 || low < 0) {
+            break;
+        }
+        output[count] = static_cast<std::byte>((high << 4) | low);
+    }
+    return count;
+}
+
+
+auto decodeBase64Groups(
+    const std::span<const std::byte> data,
+    const std::span<std::byte> output) noexcept -> std::size_t {
+
+    std::size_t count = 0;
+    for (std::size_t index = 0; index + 4 <= data.size() && count + 3 <= output.size(); index += 4, count += 3) {
+        uint32_t group = 0;
+        bool isValid = true;
+        for (std::size_t i = 0; i < 4; ++i) {
+            const auto value = cBase64DigitValues[static_cast<uint8_t>(data[index + i])];
+            isValid &= (value >= 0);
+            group = (group << 6) | static_cast<uint32_t>(value & 0x3f);
+        }
+        if (!isValid) {
+            break;
+        }
+        output[count] = static_cast<std::byte>(group >> 16);
+        output[count + 1] = static_cast<std::byte>(group >> 8);
+        output[count + 2] = static_cast<std::byte>(group);
+    }
+    return count;
+}
+
+
+}
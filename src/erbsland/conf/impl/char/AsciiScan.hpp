@@ -0,0 +1,95 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include <cstddef>
+#include <span>
+
+
+namespace erbsland::conf::impl {
+
+
+/// Count the leading bytes that are valid ASCII characters for a configuration document.
+///
+/// Valid are all printable ASCII characters (0x20-0x7e), tab, newline and carriage return. This matches
+/// `CharClass::ValidLang` for all characters in the 7-bit range. The scan stops at the first byte that is either
+/// a control character or not part of the 7-bit range. On x86-64 and ARM64, 16 bytes are tested at once.
+///
+/// @param data The data to scan.
+/// @return The number of valid ASCII bytes at the start of `data`.
+///
+/// @tested `AsciiScanTest`
+///
+[[nodiscard]] auto countValidAsciiPrefix(std::span<const std::byte> data) noexcept -> std::size_t;
+
+
+/// Count the leading bytes in the 7-bit ASCII range.
+///
+/// Unlike `countValidAsciiPrefix()`, control characters are counted as well. The scan stops at the first byte
+/// from 0x80, which is part of a multi-byte UTF-8 sequence. On x86-64 and ARM64, 16 bytes are tested at once.
+///
+/// @param data The data to scan.
+/// @return The number of ASCII bytes at the start of `data`.
+///
+/// @tested `AsciiScanTest`
+///
+[[nodiscard]] auto countAsciiPrefix(std::span<const std::byte> data) noexcept -> std::size_t;
+
+
+/// The maximum number of stop bytes for `countBytesBeforeAny()`.
+constexpr std::size_t cMaxStopBytes = 8;
+
+
+/// Count the leading bytes that are none of the given stop bytes.
+///
+/// This locates the end of a run of regular characters in a line, like the terminator or escape character
+/// of a text. On x86-64 and ARM64, 16 bytes are tested at once.
+///
+/// @param data The data to scan.
+/// @param stopBytes The bytes that end the run. At most `cMaxStopBytes` bytes.
+/// @return The number of bytes before the first stop byte, or the size of `data` if there is no stop byte.
+///
+/// @tested `AsciiScanTest`
+///
+[[nodiscard]] auto countBytesBeforeAny(
+    std::span<const std::byte> data,
+    std::span<const std::byte> stopBytes) noexcept -> std::size_t;
+
+
+/// Decode a run of hex digit pairs into bytes.
+///
+/// Each pair of hex digits (`0-9`, `a-f`, `A-F`) is decoded into one byte, with the first digit as the high nibble.
+/// The decoding stops at the first pair that is incomplete or contains another character, or if the output is full.
+/// On x86-64 and ARM64, 16 digits are decoded at once.
+///
+/// @param data The hex digits to decode.
+/// @param output The buffer for the decoded bytes.
+/// @return The number of decoded bytes. Twice this number of digits were consumed.
+///
+/// @tested `AsciiScanTest`
+///
+[[nodiscard]] auto decodeHexDigitPairs(
+    std::span<const std::byte> data,
+    std::span<std::byte> output) noexcept -> std::size_t;
+
+
+/// Decode a run of complete base64 groups into bytes.
+///
+/// Each group of four base64 digits (`A-Z`, `a-z`, `0-9`, `+`, `/`) is decoded into three bytes. The decoding stops
+/// at the first group that is incomplete or contains another character, including the padding character `=`,
+/// or if the output has no space for three more bytes.
+///
+/// @param data The base64 digits to decode.
+/// @param output The buffer for the decoded bytes.
+/// @return The number of decoded bytes, always a multiple of three. For every three bytes, four digits were consumed.
+///
+/// @tested `AsciiScanTest`
+///
+[[nodiscard]] auto decodeBase64Groups(
+    std::span<const std::byte> data,
+    std::span<std::byte> output) noexcept -> std::size_t;
+
+
+}
+
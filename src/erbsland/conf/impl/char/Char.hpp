@@ -228,6 +228,27 @@ public: // Conversion
         return 0;
     }
 
+    /// Convert a base64 digit to a numerical value.
+    ///
+    [[nodiscard]] auto toBase64DigitValue() const noexcept -> uint8_t {
+        if (_unicode >= UcA && _unicode <= UcZ) {
+            return static_cast<uint8_t>(_unicode - UcA);
+        }
+        if (_unicode >= LcA && _unicode <= LcZ) {
+            return static_cast<uint8_t>(_unicode - LcA + 26U);
+        }
+        if (_unicode >= Digit0 && _unicode <= Digit9) {
+            return static_cast<uint8_t>(_unicode - Digit0 + 52U);
+        }
+        if (_unicode == Plus) {
+            return 62U;
+        }
+        if (_unicode == Slash) {
+            return 63U;
+        }
+        return 0;
+    }
+
 public: // Tests
     /// Test if the Unicode value is in the valid range.
     ///
@@ -287,6 +308,8 @@ public:
             return isInRange(Digit0, Digit9);
         case CharClass::HexDigit:
             return isInRange(Digit0, Digit9) || isInRange(LcA, LcF) || isInRange(UcA, UcF);
+        case CharClass::Base64Digit:
+            return isInRange(UcA, UcZ) || isInRange(LcA, LcZ) || isInRange(Digit0, Digit9) || isChar(Plus, Slash);
         case CharClass::NameValueSeparator:
             return isChar(Colon, Equal);
         case CharClass::OpeningBracket:
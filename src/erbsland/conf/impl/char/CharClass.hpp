@@ -21,6 +21,7 @@ enum class CharClass : uint8_t {
     LetterOrDigit,          ///< Either a letter (a-z) or digit (0-9).
     DecimalDigit,           ///< A decimal digit (0-9).
     HexDigit,               ///< A hexadecimal digit (0-9, a-f, A-F).
+    Base64Digit,            ///< A base64 digit (A-Z, a-z, 0-9, + or /).
     NameValueSeparator,     ///< A value separator (either : or =).
     OpeningBracket,         ///< Any opening bracket of the language (", `, /, <).
     SectionStart,           ///< Any character that may start a section (- *, [).
@@ -0,0 +1,104 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "CharSet.hpp"
+
+
+#include "AsciiScan.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+
+namespace erbsland::conf::impl {
+
+
+namespace {
+
+
+/// The number of ASCII bytes tested for their set membership at once.
+constexpr std::size_t cBlockSize = 16;
+
+
+}
+
+
+CharSet::CharSet(const CharRanges &ranges) {
+    for (const auto &range : ranges) {
+        auto first = range.first().raw();
+        const auto last = range.last().raw();
+        for (; first <= last && first < cAsciiLimit; ++first) {
+            _asciiBitmap[first >> 6U] |= uint64_t{1} << (first & 0x3fU);
+        }
+        if (first <= last) {
+            _nonAsciiRanges.push_back(Range{.first = first, .last = last});
+        }
+    }
+    if (_nonAsciiRanges.empty()) {
+        return;
+    }
+    // Sort and merge overlapping or adjacent ranges, so the binary search finds a single candidate.
+    std::ranges::sort(_nonAsciiRanges, {}, &Range::first);
+    std::size_t merged = 0;
+    for (std::size_t index = 1; index < _nonAsciiRanges.size(); ++index) {
+        auto &current = _nonAsciiRanges[merged];
+        const auto &next = _nonAsciiRanges[index];
+        if (next.first <= current.last + 1) {
+            current.last = std::max(current.last, next.last);
+        } else {
+            merged += 1;
+            _nonAsciiRanges[merged] = next;
+        }
+    }
+    _nonAsciiRanges.resize(merged + 1);
+    _nonAsciiRanges.shrink_to_fit();
+}
+
+
+auto CharSet::containsNonAscii(const char32_t unicode) const noexcept -> bool {
+    // Find the last range that starts at or before the code point.
+    const auto it = std::ranges::upper_bound(_nonAsciiRanges, unicode, {}, &Range::first);
+    if (it == _nonAsciiRanges.begin()) {
+        return false;
+    }
+    return unicode <= std::prev(it)->last;
+}
+
+
+auto CharSet::countAsciiPrefix(const std::span<const std::byte> data, const bool expected) const noexcept
+    -> std::size_t {
+
+    const auto asciiCount = impl::countAsciiPrefix(data);
+    std::size_t index = 0;
+    for (; index + cBlockSize <= asciiCount; index += cBlockSize) {
+        const auto matchCount = countAsciiBlock(data.data() + index, cBlockSize, expected);
+        if (matchCount < cBlockSize) {
+            return index + matchCount;
+        }
+    }
+    return index + countAsciiBlock(data.data() + index, asciiCount - index, expected);
+}
+
+
+auto CharSet::countAsciiBlock(
+    const std::byte *data,
+    const std::size_t size,
+    const bool expected) const noexcept -> std::size_t {
+
+    // Test all bytes without branching first, as in most cases, all characters are valid.
+    bool allMatch = true;
+    for (std::size_t index = 0; index < size; ++index) {
+        allMatch &= containsAscii(static_cast<uint8_t>(data[index])) == expected;
+    }
+    if (allMatch) {
+        return size;
+    }
+    std::size_t index = 0;
+    while (containsAscii(static_cast<uint8_t>(data[index])) == expected) {
+        index += 1;
+    }
+    return index;
+}
+
+
+}
+
@@ -0,0 +1,101 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "CharRanges.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+namespace erbsland::conf::impl {
+
+
+/// A compiled set of characters for fast membership tests.
+///
+/// The set is created once from a list of character ranges. ASCII characters are stored in a 128-bit bitmap,
+/// all other characters in a sorted list of merged ranges that is searched using a binary search.
+///
+/// @tested `CharSetTest`
+///
+class CharSet final {
+public:
+    /// A range of non-ASCII code points.
+    ///
+    struct Range {
+        char32_t first; ///< The first code point in the range.
+        char32_t last; ///< The last code point in the range.
+    };
+
+    using RangeList = std::vector<Range>;
+
+public:
+    /// Create an empty set.
+    ///
+    CharSet() = default;
+
+    /// Compile a set from character ranges.
+    ///
+    /// @param ranges The ranges, in any order. Overlapping ranges are merged.
+    ///
+    explicit CharSet(const CharRanges &ranges);
+
+public:
+    /// Test if the set contains a character.
+    ///
+    [[nodiscard]] auto contains(const Char character) const noexcept -> bool {
+        const auto unicode = character.raw();
+        if (unicode < cAsciiLimit) {
+            return containsAscii(static_cast<uint8_t>(unicode));
+        }
+        return containsNonAscii(unicode);
+    }
+
+    /// Count the leading ASCII bytes, where the set membership matches the expected value.
+    ///
+    /// The scan stops at the first byte that is not in the 7-bit range, or for which `contains()` does not
+    /// return `expected`. As each ASCII byte is one character, the result is also the number of characters.
+    /// On x86-64 and ARM64, blocks of 16 bytes are tested for non-ASCII bytes at once.
+    ///
+    /// @param data The UTF-8 encoded text to scan.
+    /// @param expected `true` to count the characters in the set, `false` for the ones not in the set.
+    /// @return The number of matching ASCII bytes at the start of `data`.
+    ///
+    [[nodiscard]] auto countAsciiPrefix(std::span<const std::byte> data, bool expected) const noexcept -> std::size_t;
+
+    /// Access the sorted and merged non-ASCII ranges.
+    ///
+    [[nodiscard]] auto nonAsciiRanges() const noexcept -> const RangeList& { return _nonAsciiRanges; }
+
+private:
+    /// Test if an ASCII character is in the set.
+    ///
+    [[nodiscard]] auto containsAscii(const uint8_t value) const noexcept -> bool {
+        return ((_asciiBitmap[value >> 6U] >> (value & 0x3fU)) & 1U) != 0;
+    }
+
+    /// Test if a non-ASCII character is in the set.
+    ///
+    [[nodiscard]] auto containsNonAscii(char32_t unicode) const noexcept -> bool;
+
+    /// Test the bytes of a block, that only contains ASCII characters.
+    ///
+    [[nodiscard]] auto countAsciiBlock(
+        const std::byte *data,
+        std::size_t size,
+        bool expected) const noexcept -> std::size_t;
+
+private:
+    constexpr static char32_t cAsciiLimit = 0x80U; ///< The first code point that is not ASCII.
+
+    std::array<uint64_t, 2> _asciiBitmap{}; ///< One bit for each ASCII character.
+    RangeList _nonAsciiRanges; ///< The sorted and merged non-ASCII ranges.
+};
+
+
+}
+
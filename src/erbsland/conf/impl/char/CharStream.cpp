@@ -3,8 +3,12 @@
 #include "CharStream.hpp"
 
 
+#include "AsciiScan.hpp"
+
 #include "../utf8/U8Decoder.hpp"
 
+#include <algorithm>
+#include <array>
 #include <utility>
 
 
@@ -31,6 +35,12 @@ auto CharStream::next() -> DecodedChar {
     } else {
         _position.nextColumn();
     }
+    if (_lineCurrentIndex < _lineAsciiLength) {
+        // Fast path: This character was already validated when the line was read.
+        const auto unicode = static_cast<char32_t>(_lineData[_lineCurrentIndex]);
+        _lineCharacterStartIndex = std::exchange(_lineCurrentIndex, _lineCurrentIndex + 1);
+        return DecodedChar{unicode, _lineCharacterStartIndex, _position};
+    }
     auto result = decodeNext();
     if (result == Char::ByteOrderMark) {
         if (_position.line() == 1 && _position.column() == 1) {
@@ -48,9 +58,76 @@ auto CharStream::next() -> DecodedChar {
 }
 
 
+auto CharStream::skipCharacterRun(const std::u8string_view stopChars) noexcept -> std::size_t {
+    assert(stopChars.size() + 2 <= cMaxStopBytes);
+    std::array<std::byte, cMaxStopBytes> stopByteBuffer{std::byte{'\n'}, std::byte{'\r'}};
+    std::ranges::transform(stopChars, stopByteBuffer.begin() + 2, [](const char8_t c) -> std::byte {
+        return static_cast<std::byte>(c);
+    });
+    const auto stopBytes = std::span{stopByteBuffer}.first(stopChars.size() + 2);
+    std::size_t count = 0;
+    auto index = _lineCurrentIndex;
+    auto characterStartIndex = _lineCharacterStartIndex;
+    while (index < _lineLength) {
+        if (index < _lineAsciiLength) {
+            // Fast path: All characters in the ASCII prefix were already validated when the line was read.
+            const auto runLength = countBytesBeforeAny(
+                _lineData.subspan(index, _lineAsciiLength - index), stopBytes);
+            if (runLength == 0) {
+                break;
+            }
+            index += runLength;
+            count += runLength;
+            characterStartIndex = index - 1;
+            continue;
+        }
+        if (std::ranges::find(stopBytes, _lineData[index]) != stopBytes.end()) {
+            break;
+        }
+        auto nextIndex = index;
+        Char character;
+        try {
+            character = U8Decoder<const std::byte>::decodeChar(_lineData, nextIndex);
+        } catch (const Error&) {
+            break; // Leave the error to `next()`, that reports it at the correct position.
+        }
+        if (character == Char::ByteOrderMark || character != CharClass::ValidLang) {
+            break;
+        }
+        characterStartIndex = index;
+        index = nextIndex;
+        count += 1;
+    }
+    if (count > 0) {
+        _lineCurrentIndex = index;
+        _lineCharacterStartIndex = characterStartIndex;
+        _position = Position{_position.line(), _position.column() + static_cast<int>(count)};
+    }
+    return count;
+}
+
+
+void CharStream::skipAsciiCharacters(const std::size_t count) noexcept {
+    assert(_lineCurrentIndex + count <= _lineLength);
+    if (count == 0) {
+        return;
+    }
+    _lineCurrentIndex += count;
+    _lineCharacterStartIndex = _lineCurrentIndex - 1;
+    _position = Position{_position.line(), _position.column() + static_cast<int>(count)};
+}
+
+
 void CharStream::readNextLine() {
-    // Fill the buffer with the next chunk of line data.
-    _lineLength = _source->readLine(_line);
+    if (_useLineViews) {
+        // Decode the line in place, without copying it.
+        _lineData = _source->readLineView();
+        _lineLength = _lineData.size();
+    } else {
+        // Fill the buffer with the next chunk of line data.
+        _lineLength = _source->readLine(_line);
+        _lineData = std::span{_line.data(), _lineLength};
+    }
     // Important: As the char stream is not only used to verify, but also to create document signatures,
     // `_hashEnabled` can be set manually. In these cases, when re-signing a document that already has a
     // `\@signature` line - the first line must be skipped when building the hash.
@@ -60,8 +137,12 @@ void CharStream::readNextLine() {
         // 2. Also, skipping this line for hash-calculation.
         _hashEnabled = true;
     } else if (_hashEnabled && _lineLength > 0) {
-        _hash.update(std::span(_line.begin(), _lineLength));
+        _hash.update(_lineData);
     }
+    if (_contentHash.has_value() && _lineLength > 0) {
+        _contentHash->update(_lineData);
+    }
+    _lineAsciiLength = countValidAsciiPrefix(_lineData);
     _lineCurrentIndex = 0;
     _lineCharacterStartIndex = 0;
     _captureStartLine = static_cast<std::size_t>(_position.line()) + 1U; // will be increased after this call.
@@ -72,7 +153,7 @@ void CharStream::readNextLine() {
 auto CharStream::decodeNext() -> DecodedChar {
     _lineCharacterStartIndex = _lineCurrentIndex;
     try {
-        const auto character = U8Decoder<std::byte>::decodeChar(_line, _lineCurrentIndex);
+        const auto character = U8Decoder<const std::byte>::decodeChar(_lineData, _lineCurrentIndex);
         return DecodedChar{character, _lineCharacterStartIndex, _position};
     } catch (const Error &error) {
         throw Error{ErrorCategory::Encoding, error.message(), Location{_source->identifier(), _position}};
@@ -89,9 +170,13 @@ auto CharStream::createEndOfData() noexcept -> DecodedChar {
             _position.nextColumn();
         }
         _endOfData = true;
-        if (_hashEnabled) {
+        // The end of the data can be read again after a rewind, yet the digest is only finalized once.
+        if (_hashEnabled && _digest.empty()) {
             _digest = _hash.digest();
         }
+        if (_contentHash.has_value() && _contentDigest.empty()) {
+            _contentDigest = _contentHash->digest();
+        }
     }
     return DecodedChar{Char::EndOfData, _lineCurrentIndex, _position};
 }
@@ -125,7 +210,7 @@ auto CharStream::isSignatureLine() const noexcept -> bool {
     // Skip any BOM that may be present in the first line of the document.
     std::size_t startIndex = 0;
     constexpr std::size_t bomSize = 3;
-    if (_lineLength >= bomSize && _line[0] == std::byte{0xEFU} && _line[1] == std::byte{0xBBU} && _line[2] == std::byte{0xBFU}) {
+    if (_lineLength >= bomSize && _lineData[0] == std::byte{0xEFU} && _lineData[1] == std::byte{0xBBU} && _lineData[2] == std::byte{0xBFU}) {
         startIndex = 3;
     }
     if (_lineLength < (signatureLowerCase.size() + startIndex)) {
@@ -133,7 +218,7 @@ auto CharStream::isSignatureLine() const noexcept -> bool {
     }
     // Scan for a signature value name at the start of the line.
     for (std::size_t i = 0; i < signatureLowerCase.size(); ++i) {
-        if (signatureLowerCase[i] != _line[startIndex + i] && signatureUpperCase[i] != _line[startIndex + i]) {
+        if (signatureLowerCase[i] != _lineData[startIndex + i] && signatureUpperCase[i] != _lineData[startIndex + i]) {
             return false;
         }
     }
@@ -146,8 +231,10 @@ auto internalView(const CharStream &object) -> InternalViewPtr {
     auto result = InternalView::create();
     result->setValue("source", *object._source);
     result->setValue("endOfData", object._endOfData);
+    result->setValue("useLineViews", object._useLineViews);
     result->setValue("line", std::format("array(size={})", limits::maxLineLength + 1));
     result->setValue("lineLength", object._lineLength);
+    result->setValue("lineAsciiLength", object._lineAsciiLength);
     result->setValue("lineCurrentIndex", object._lineCurrentIndex);
     result->setValue("lineCharacterStartIndex", object._lineCharacterStartIndex);
     result->setValue("captureStartLine", object._captureStartLine);
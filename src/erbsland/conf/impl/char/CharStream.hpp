@@ -12,6 +12,7 @@
 #include "../../Source.hpp"
 
 #include <cassert>
+#include <optional>
 
 
 namespace erbsland::conf::impl {
@@ -26,11 +27,24 @@ using CharStreamPtr = std::shared_ptr<CharStream>;
 /// - Reads the lines from the source.
 /// - Keeps track of the location.
 /// - Decodes and verifies the UTF-8 input.
+/// - Pre-validates the ASCII part of each line, to skip decoding and checks for these characters.
 /// - Handles end of a file.
 ///
 /// @tested `DecoderTest`
 ///
 class CharStream final {
+public:
+    /// A saved read position in the current line.
+    ///
+    /// Used to rewind the stream to a previously decoded character in the same line.
+    ///
+    struct ReadPosition final {
+        std::size_t lineCurrentIndex; ///< The line buffer index.
+        std::size_t lineCharacterStartIndex; ///< The index, where the last read character started.
+        Position position; ///< The position of the last read character.
+        bool endOfData; ///< If the end of the data was reached.
+    };
+
 public:
     static auto create(SourcePtr source) noexcept -> CharStreamPtr {
         assert(source != nullptr);
@@ -38,6 +52,7 @@ public:
     }
     explicit CharStream(SourcePtr source) noexcept : _source{std::move(source)} {
         assert(_source != nullptr);
+        _useLineViews = _source->supportsLineViews();
     }
     ~CharStream() = default;
 
@@ -58,16 +73,63 @@ public:
             throwInternalError("Invalid capture position. End before start index.");
         }
         const auto startPosition = std::exchange(_captureStartIndex, endPosition);
-        return String{std::span{_line.begin() + startPosition, _line.begin() + endPosition}, PrivateTag{}};
+        return String{_lineData.subspan(startPosition, endPosition - startPosition), PrivateTag{}};
     }
 
     /// Capture everything up to the end of the line.
     ///
     [[nodiscard]] auto captureToEndOfLine() noexcept -> String {
         const auto startPosition = std::exchange(_captureStartIndex, _lineLength);
-        return String{std::span{_line.begin() + startPosition, _line.begin() + _lineLength}, PrivateTag{}};
+        return String{_lineData.subspan(startPosition, _lineLength - startPosition), PrivateTag{}};
+    }
+
+    /// Get the current read position.
+    ///
+    /// @return The read position after the last decoded character.
+    ///
+    [[nodiscard]] auto readPosition() const noexcept -> ReadPosition {
+        return ReadPosition{_lineCurrentIndex, _lineCharacterStartIndex, _position, _endOfData};
     }
 
+    /// Rewind the stream to a previous read position in the current line.
+    ///
+    /// The characters after this position are decoded again on the next calls of `next()`.
+    ///
+    /// @param readPosition A read position, that was obtained in the current line.
+    ///
+    void rewind(const ReadPosition &readPosition) noexcept {
+        assert(readPosition.lineCurrentIndex <= _lineLength);
+        assert(readPosition.position.line() == _position.line());
+        _lineCurrentIndex = readPosition.lineCurrentIndex;
+        _lineCharacterStartIndex = readPosition.lineCharacterStartIndex;
+        _position = readPosition.position;
+        _endOfData = readPosition.endOfData;
+    }
+
+    /// Skip a run of regular characters in the current line.
+    ///
+    /// The run starts after the last decoded character and ends before the first stop character, line break,
+    /// or any character that would cause an error in `next()`. The skipped characters are validated like in `next()`,
+    /// but they are not decoded into single characters. Use the read position to access the skipped bytes.
+    ///
+    /// @param stopChars ASCII characters that end the run, in addition to the line breaks.
+    /// @return The number of skipped characters.
+    ///
+    [[nodiscard]] auto skipCharacterRun(std::u8string_view stopChars) noexcept -> std::size_t;
+
+    /// Skip ASCII characters in the current line, that were already decoded from the line data.
+    ///
+    /// Used after a run of characters was decoded in bulk from the line data, like the hex digits of bytes.
+    /// The skipped bytes must start after the last decoded character and must be printable ASCII characters.
+    ///
+    /// @param count The number of characters to skip.
+    ///
+    void skipAsciiCharacters(std::size_t count) noexcept;
+
+    /// Access the data of the current line.
+    ///
+    [[nodiscard]] auto lineData() const noexcept -> std::span<const std::byte> { return _lineData; }
+
     /// Access the source used by this decoder.
     ///
     [[nodiscard]] auto source() const noexcept -> const SourcePtr& { return _source; }
@@ -93,6 +155,22 @@ public:
     ///
     void enableHash() noexcept { _hashEnabled = true; }
 
+    /// Get the hash of all bytes that were read from the source.
+    ///
+    /// Call this function, *after* you received the end-of-document character. The hash is only available
+    /// if it was enabled before the first line was read.
+    ///
+    /// @return The hash, or empty if no hash was created.
+    ///
+    [[nodiscard]] auto contentHash() const noexcept -> Bytes { return _contentDigest; }
+
+    /// Enable the hash of all bytes that are read from the source.
+    ///
+    /// In contrast to the document digest, this hash includes the signature line. It is used by the parser
+    /// cache to detect changed files, without reading them a second time.
+    ///
+    void enableContentHash() { _contentHash.emplace(defaults::documentHashAlgorithm); }
+
     /// Determine whether the current line starts with a signature marker.
     ///
     /// @return `true` if a "@signature" value is detected.
@@ -102,6 +180,7 @@ public:
 private:
     /// Reads the next line from the source into the internal buffer.
     ///
+    /// - If the source supports line views, the line is decoded in place and not copied.
     /// - Resets the line's current index and its character start index.
     /// - Updates the capture-related metadata to prepare for further
     ///   data decoding.
@@ -160,8 +239,11 @@ public: // testing
 private:
     SourcePtr _source; ///< The input source.
     bool _endOfData{false}; ///< True, if the end of the data was reached.
+    bool _useLineViews{false}; ///< If the lines are decoded in place from views provided by the source.
     std::array<std::byte, limits::maxLineLength + 1> _line{}; ///< The line buffer.
+    std::span<const std::byte> _lineData; ///< The current line, either in the line buffer or in the source.
     std::size_t _lineLength{0}; ///< The line buffer length.
+    std::size_t _lineAsciiLength{0}; ///< The length of the line prefix with only valid ASCII characters.
     std::size_t _lineCurrentIndex{0}; ///< The line buffer index.
     std::size_t _lineCharacterStartIndex{0}; ///< The index, where the last read character started.
     std::size_t _captureStartLine{0}; ///< The capture start line (for integrity checks).
@@ -170,6 +252,8 @@ private:
     bool _hashEnabled{false}; ///< Set to `true` if a `\@signature` line is encountered.
     crypto::ShaHash _hash{defaults::documentHashAlgorithm}; ///< The hash function, used for signed documents.
     Bytes _digest; ///< The hash digest.
+    std::optional<crypto::ShaHash> _contentHash; ///< The hash of all read bytes, if enabled.
+    Bytes _contentDigest; ///< The digest of all read bytes.
 };
 
 
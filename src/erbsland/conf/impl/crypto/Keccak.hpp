@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
@@ -7,6 +7,7 @@
 #include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 
 namespace erbsland::conf::impl::crypto {
@@ -98,7 +99,10 @@ inline void keccakIota(KeccakF1600State &state, std::size_t round) {
 
 /// Apply the Keccak F1600 permutation to the state.
 ///
-inline void keccakF1600Permutation(KeccakF1600State &state) {
+/// This is the straightforward implementation of the specification, using the individual steps.
+/// It is kept as reference to verify `keccakF1600Permutation()`.
+///
+inline void keccakF1600PermutationReference(KeccakF1600State &state) {
     for (std::size_t round = 0; round < 24; ++round) {
         keccakTheta(state);
         KeccakF1600State b{};
@@ -109,4 +113,129 @@ inline void keccakF1600Permutation(KeccakF1600State &state) {
 }
 
 
+/// The lanes that are stored complemented while the permutation is running.
+///
+constexpr std::array<std::size_t, 6> cKeccakF1600ComplementedLanes = {1, 2, 8, 12, 17, 20};
+
+
+/// Complement the lanes in `cKeccakF1600ComplementedLanes`.
+///
+inline void keccakComplementLanes(KeccakF1600State &state) noexcept {
+    for (const auto index : cKeccakF1600ComplementedLanes) {
+        state[index] = ~state[index];
+    }
+}
+
+
+/// Apply the Keccak F1600 permutation to the state.
+///
+/// All steps of a round are combined and unrolled, and the state is kept in local variables. The lane names
+/// follow the reference code of the Keccak team: The first letter is the plane (`b`, `g`, `k`, `m`, `s` for
+/// y = 0 to 4), the second the column (`a`, `e`, `i`, `o`, `u` for x = 0 to 4).
+///
+/// While the permutation runs, six lanes are stored complemented ("lane complementing"). With the adapted
+/// chi-step, this replaces most of the NOT operations by a single one per plane.
+///
+inline void keccakF1600Permutation(KeccakF1600State &state) noexcept {
+    keccakComplementLanes(state);
+    uint64_t aba = state[0], abe = state[1], abi = state[2], abo = state[3], abu = state[4];
+    uint64_t aga = state[5], age = state[6], agi = state[7], ago = state[8], agu = state[9];
+    uint64_t aka = state[10], ake = state[11], aki = state[12], ako = state[13], aku = state[14];
+    uint64_t ama = state[15], ame = state[16], ami = state[17], amo = state[18], amu = state[19];
+    uint64_t asa = state[20], ase = state[21], asi = state[22], aso = state[23], asu = state[24];
+    for (const auto roundConstant : cKeccakF1600RoundConstants) {
+        // theta
+        const uint64_t c0 = aba ^ aga ^ aka ^ ama ^ asa;
+        const uint64_t c1 = abe ^ age ^ ake ^ ame ^ ase;
+        const uint64_t c2 = abi ^ agi ^ aki ^ ami ^ asi;
+        const uint64_t c3 = abo ^ ago ^ ako ^ amo ^ aso;
+        const uint64_t c4 = abu ^ agu ^ aku ^ amu ^ asu;
+        const uint64_t d0 = c4 ^ rotl64(c1, 1);
+        const uint64_t d1 = c0 ^ rotl64(c2, 1);
+        const uint64_t d2 = c1 ^ rotl64(c3, 1);
+        const uint64_t d3 = c2 ^ rotl64(c4, 1);
+        const uint64_t d4 = c3 ^ rotl64(c0, 1);
+        // rho, pi, chi and iota, for each plane of the new state.
+        uint64_t b0 = aba ^ d0;
+        uint64_t b1 = rotl64(age ^ d1, 44);
+        uint64_t b2 = rotl64(aki ^ d2, 43);
+        uint64_t b3 = rotl64(amo ^ d3, 21);
+        uint64_t b4 = rotl64(asu ^ d4, 14);
+        const uint64_t eba = b0 ^ (b1 | b2) ^ roundConstant;
+        const uint64_t ebe = b1 ^ (~b2 | b3);
+        const uint64_t ebi = b2 ^ (b3 & b4);
+        const uint64_t ebo = b3 ^ (b4 | b0);
+        const uint64_t ebu = b4 ^ (b0 & b1);
+        b0 = rotl64(abo ^ d3, 28);
+        b1 = rotl64(agu ^ d4, 20);
+        b2 = rotl64(aka ^ d0, 3);
+        b3 = rotl64(ame ^ d1, 45);
+        b4 = rotl64(asi ^ d2, 61);
+        const uint64_t ega = b0 ^ (b1 | b2);
+        const uint64_t ege = b1 ^ (b2 & b3);
+        const uint64_t egi = b2 ^ (b3 | ~b4);
+        const uint64_t ego = b3 ^ (b4 | b0);
+        const uint64_t egu = b4 ^ (b0 & b1);
+        b0 = rotl64(abe ^ d1, 1);
+        b1 = rotl64(agi ^ d2, 6);
+        b2 = rotl64(ako ^ d3, 25);
+        b3 = rotl64(amu ^ d4, 8);
+        b4 = rotl64(asa ^ d0, 18);
+        const uint64_t eka = b0 ^ (b1 | b2);
+        const uint64_t eke = b1 ^ (b2 & b3);
+        const uint64_t eki = b2 ^ (~b3 & b4);
+        const uint64_t eko = ~b3 ^ (b4 | b0);
+        const uint64_t eku = b4 ^ (b0 & b1);
+        b0 = rotl64(abu ^ d4, 27);
+        b1 = rotl64(aga ^ d0, 36);
+        b2 = rotl64(ake ^ d1, 10);
+        b3 = rotl64(ami ^ d2, 15);
+        b4 = rotl64(aso ^ d3, 56);
+        const uint64_t ema = b0 ^ (b1 & b2);
+        const uint64_t eme = b1 ^ (b2 | b3);
+        const uint64_t emi = b2 ^ (~b3 | b4);
+        const uint64_t emo = ~b3 ^ (b4 & b0);
+        const uint64_t emu = b4 ^ (b0 | b1);
+        b0 = rotl64(abi ^ d2, 62);
+        b1 = rotl64(ago ^ d3, 55);
+        b2 = rotl64(aku ^ d4, 39);
+        b3 = rotl64(ama ^ d0, 41);
+        b4 = rotl64(ase ^ d1, 2);
+        const uint64_t esa = b0 ^ (~b1 & b2);
+        const uint64_t ese = ~b1 ^ (b2 | b3);
+        const uint64_t esi = b2 ^ (b3 & b4);
+        const uint64_t eso = b3 ^ (b4 | b0);
+        const uint64_t esu = b4 ^ (b0 & b1);
+        aba = eba; abe = ebe; abi = ebi; abo = ebo; abu = ebu;
+        aga = ega; age = ege; agi = egi; ago = ego; agu = egu;
+        aka = eka; ake = eke; aki = eki; ako = eko; aku = eku;
+        ama = ema; ame = eme; ami = emi; amo = emo; amu = emu;
+        asa = esa; ase = ese; asi = esi; aso = eso; asu = esu;
+    }
+    state = {
+        aba, abe, abi, abo, abu,
+        aga, age, agi, ago, agu,
+        aka, ake, aki, ako, aku,
+        ama, ame, ami, amo, amu,
+        asa, ase, asi, aso, asu};
+    keccakComplementLanes(state);
+}
+
+
+/// Read a lane of the state from eight bytes in little-endian order.
+///
+[[nodiscard]] inline auto keccakLoadLane(const std::byte *data) noexcept -> uint64_t {
+    uint64_t lane = 0;
+    std::memcpy(&lane, data, sizeof(lane));
+    if constexpr (std::endian::native == std::endian::big) {
+        uint64_t swapped = 0;
+        for (std::size_t i = 0; i < sizeof(lane); ++i) {
+            swapped = (swapped << 8U) | ((lane >> (8U * i)) & 0xffU);
+        }
+        lane = swapped;
+    }
+    return lane;
+}
+
+
 }
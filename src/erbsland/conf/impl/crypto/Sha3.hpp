@@ -1,10 +1,12 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
 
 #include "Keccak.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <span>
 #include <stdexcept>
 
@@ -14,10 +16,15 @@ namespace erbsland::conf::impl::crypto {
 
 /// The SHA3 implementation for the hash algorithm.
 ///
-/// @tested
+/// Complete blocks are absorbed directly from the input, lane by lane. Only incomplete blocks at the start and
+/// the end of an update are collected in the buffer.
+///
+/// @tested `ShaHashTest`
 ///
 template <std::size_t tRateBytes, std::size_t tDigestBytes>
 class Sha3 final {
+    static_assert(tRateBytes % sizeof(uint64_t) == 0, "The rate must be a multiple of the lane size.");
+
 public:
     /// Create a new instance for the algorithm and initialize the state.
     ///
@@ -42,12 +49,28 @@ public:
         if (_hasDigest) {
             throw std::logic_error("Adding more data, via `update()` after calling `digest()` is not allowed.");
         }
-        for (std::byte dataByte : data) {
-            _buffer[_bufferPosition] = static_cast<uint8_t>(dataByte);
-            _bufferPosition += 1;
-            if (_bufferPosition == tRateBytes) {
-                absorbBlock();
+        if (data.empty()) {
+            return;
+        }
+        auto input = data;
+        if (_bufferPosition > 0) {
+            const auto count = std::min(input.size(), tRateBytes - _bufferPosition);
+            std::memcpy(_buffer.data() + _bufferPosition, input.data(), count);
+            _bufferPosition += count;
+            input = input.subspan(count);
+            if (_bufferPosition < tRateBytes) {
+                return;
             }
+            absorbBlock(_buffer.data());
+            _bufferPosition = 0;
+        }
+        while (input.size() >= tRateBytes) {
+            absorbBlock(input.data());
+            input = input.subspan(tRateBytes);
+        }
+        if (!input.empty()) {
+            std::memcpy(_buffer.data(), input.data(), input.size());
+            _bufferPosition = input.size();
         }
     }
 
@@ -71,13 +94,12 @@ private:
     ///
     void finalize() {
         // clear the remaining part of the buffer with zeros.
-        for (std::size_t i = _bufferPosition; i < tRateBytes; ++i) {
-            _buffer[i] = 0x00;
-        }
+        std::fill(_buffer.begin() + static_cast<std::ptrdiff_t>(_bufferPosition), _buffer.end(), std::byte{0});
         // Apply the padding.
-        _buffer[_bufferPosition] ^= 0x06;
-        _buffer[tRateBytes - 1] ^= 0x80;
-        absorbBlock();
+        _buffer[_bufferPosition] ^= std::byte{0x06};
+        _buffer[tRateBytes - 1] ^= std::byte{0x80};
+        absorbBlock(_buffer.data());
+        _bufferPosition = 0;
         std::size_t digestPosition = 0;
         while (digestPosition < tDigestBytes) {
             for (std::size_t i = 0; i < tRateBytes && digestPosition < tDigestBytes; ++i) {
@@ -89,19 +111,20 @@ private:
         _hasDigest = true;
     }
 
-    /// Absorbs a completed block from the buffer.
+    /// Absorbs a complete block.
     ///
-    void absorbBlock() {
-        for (std::size_t i = 0; i < tRateBytes; ++i) {
-            _state[i / 8] ^= static_cast<uint64_t>(_buffer[i]) << (8 * (i % 8));
+    /// @param block Pointer to a block with `tRateBytes` bytes.
+    ///
+    void absorbBlock(const std::byte *block) noexcept {
+        for (std::size_t lane = 0; lane < tRateBytes / sizeof(uint64_t); ++lane) {
+            _state[lane] ^= keccakLoadLane(block + lane * sizeof(uint64_t));
         }
         keccakF1600Permutation(_state);
-        _bufferPosition = 0;
     }
 
 private:
     KeccakF1600State _state{}; ///< The current state.
-    std::array<uint8_t, tRateBytes> _buffer{}; ///< The read buffer (uninitialized - will be overwritten)
+    std::array<std::byte, tRateBytes> _buffer{}; ///< The buffer for incomplete blocks.
     std::size_t _bufferPosition = 0; ///< The write-position in the buffer.
     std::array<std::byte, tDigestBytes> _digest{}; ///< A cache for the final digest.
     bool _hasDigest = false; ///< Flag that the digest was calculated and is ready to use.
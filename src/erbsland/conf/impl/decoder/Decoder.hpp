@@ -7,6 +7,7 @@
 
 #include "../char/Char.hpp"
 
+#include "../../Bytes.hpp"
 #include "../../Error.hpp"
 #include "../../Location.hpp"
 #include "../../String.hpp"
@@ -51,6 +52,45 @@ public:
     ///
     virtual void next() = 0;
 
+    /// Append the current character and the following run of regular characters to a string.
+    ///
+    /// The run ends before the first stop character, line break, or invalid character, which becomes the
+    /// new current character. The default implementation appends only the current character, decoders with access
+    /// to the raw line data append the whole run at once.
+    ///
+    /// @param target The string to append the characters to.
+    /// @param stopChars ASCII characters that end the run, in addition to the line breaks.
+    /// @throws Error (Encoding) In case of any encoding error.
+    ///
+    virtual void appendCharacterRun(String &target, [[maybe_unused]] const std::u8string_view stopChars) {
+        character().appendTo(target);
+        next();
+    }
+
+    /// Decode the current character and the following run of hex digit pairs into bytes.
+    ///
+    /// The run ends before the first pair that is incomplete or contains another character, which becomes the
+    /// new current character. The default implementation decodes nothing and leaves the decoding to the lexer,
+    /// decoders with access to the raw line data decode the whole run at once.
+    ///
+    /// @param target The bytes to append the decoded bytes to.
+    /// @return The number of decoded bytes.
+    ///
+    virtual auto appendHexDigitPairs([[maybe_unused]] Bytes &target) -> std::size_t {
+        return 0;
+    }
+
+    /// Decode the current character and the following run of complete base64 groups into bytes.
+    ///
+    /// Works like `appendHexDigitPairs()`, for groups of four base64 digits without padding.
+    ///
+    /// @param target The bytes to append the decoded bytes to.
+    /// @return The number of decoded bytes.
+    ///
+    virtual auto appendBase64Groups([[maybe_unused]] Bytes &target) -> std::size_t {
+        return 0;
+    }
+
 public: // Throwing common exceptions.
     /// Throw the given error.
     ///
@@ -1,39 +1,46 @@
-// Copyright (c) 2024-2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2024-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #include "TokenDecoder.hpp"
 
 
-#include <algorithm>
-#include <ranges>
+#include "../char/AsciiScan.hpp"
+#include "../utf8/U8Decoder.hpp"
+
+#include <array>
 
 
 namespace erbsland::conf::impl {
 
 
+namespace {
+
+
+/// The bytes that end a run of digits in bytes-data.
+constexpr auto cRunStopBytes = std::array{
+    std::byte{' '}, std::byte{'\t'}, std::byte{'>'}, std::byte{'#'}, std::byte{'\n'}, std::byte{'\r'}};
+
+
+}
+
+
 void TokenDecoder::next() {
     if (_currentCharacter == Char::Error) {
         throw std::logic_error("TokenDecoder: An error was not correctly handled.");
     }
     try {
-        // Capture and/or store the current character.
-        if (!_transactions.empty()) {
-            if (_currentCharacter == CharClass::LineBreakOrEnd) {
-                throwInternalError(u8"There is an open transaction at the end of the line.");
-            }
-            _transactionBuffer.emplace_back(_currentCharacter);
+        // Transactions are limited to the current line, as a rollback rewinds the char stream in the line.
+        if (!_transactions.empty() && _currentCharacter == CharClass::LineBreakOrEnd) {
+            throwInternalError(u8"There is an open transaction at the end of the line.");
         }
         // Read the next character.
-        if (_characterBuffer.empty()) {
-            _currentCharacter = _decoder->next();
-        } else {
-            _currentCharacter = _characterBuffer.back();
-            _characterBuffer.pop_back();
-        }
+        _currentCharacter = _decoder->next();
+        _characterCount += 1;
      } catch (const Error& error) {
          if (error.category() == ErrorCategory::Encoding || error.category() == ErrorCategory::Character) {
              // Delay encoding and (control-)character errors by setting the current character to the error mark.
              _hasUpcomingError = true;
              _currentCharacter = DecodedChar{Char::Error, _decoder->lastCharacterStartIndex(), error.location().position()};
+             _characterCount += 1;
              _currentError.category = error.category();
              _currentError.message = error.message();
              _currentError.location = error.location();
@@ -45,6 +52,28 @@ void TokenDecoder::next() {
 }
 
 
+void TokenDecoder::appendCharacterRun(String &target, const std::u8string_view stopChars) {
+    assert(_currentCharacter != Char::Error && _currentCharacter != CharClass::LineBreakOrEnd);
+    // The current character and the skipped run are in the current line and were already validated.
+    const auto startIndex = _currentCharacter.index();
+    _characterCount += _decoder->skipCharacterRun(stopChars);
+    const auto endIndex = _decoder->readPosition().lineCurrentIndex;
+    const auto run = _decoder->lineData().subspan(startIndex, endIndex - startIndex);
+    target.append(std::u8string_view{reinterpret_cast<const char8_t*>(run.data()), run.size()});
+    next();
+}
+
+
+auto TokenDecoder::appendHexDigitPairs(Bytes &target) -> std::size_t {
+    return appendDecodedRun(target, decodeHexDigitPairs, 2, 1);
+}
+
+
+auto TokenDecoder::appendBase64Groups(Bytes &target) -> std::size_t {
+    return appendDecodedRun(target, decodeBase64Groups, 4, 3);
+}
+
+
 void TokenDecoder::checkForErrorAndThrowIt() const {
     if (_hasUpcomingError) {
         throw Error{_currentError.category, _currentError.message, _currentError.location};
@@ -55,7 +84,8 @@ void TokenDecoder::checkForErrorAndThrowIt() const {
 auto TokenDecoder::startTransaction(Transaction *transaction) noexcept -> std::size_t {
     assert(transaction != nullptr);
     _transactions.push_back(transaction);
-    return _transactionBuffer.size();
+    _transactionBuffer.push_back(TokenTransactionStart{_currentCharacter, _decoder->readPosition(), _characterCount});
+    return _transactionBuffer.size() - 1;
 }
 
 
@@ -76,24 +106,14 @@ void TokenDecoder::rollbackTransaction(const Transaction *transaction) noexcept
     assert(!_transactions.empty());
     assert(_transactions.back() == transaction);
     assert(transaction->state() == Transaction::State::RolledBack);
-    // Push the current character to the stack, as it will be replaced with then one when the
-    // given transaction started.
-    _characterBuffer.push_back(_currentCharacter);
-    // Push all characters back into the buffer.
-    for (std::size_t i = _transactionBuffer.size(); i > transaction->transactionBufferStartIndex(); --i) {
-        _characterBuffer.emplace_back(_transactionBuffer.at(i - 1));
-    }
-    // Erase all characters from the buffer, that were stored in the given transaction.
-    assert(_transactionBuffer.size() >= transaction->transactionBufferStartIndex());
-    _transactionBuffer.erase(
-        _transactionBuffer.begin() + static_cast<TokenTransactionBuffer::difference_type>(transaction->transactionBufferStartIndex()),
-        _transactionBuffer.end());
+    assert(transaction->transactionBufferStartIndex() + 1 == _transactionBuffer.size());
+    // Restore the character from the start of the transaction and rewind the stream to the position after it.
+    const auto &start = _transactionBuffer.back();
+    _currentCharacter = start.character;
+    _characterCount = start.characterCount;
+    _decoder->rewind(start.readPosition);
     // Remove the now obsolete transaction.
     popTransaction();
-    // Replace the current character with the one on top of the stack.
-    // As we put the current character to the stack, we are sure there is at least one character on the stack.
-    _currentCharacter = _characterBuffer.back();
-    _characterBuffer.pop_back();
 }
 
 
@@ -101,7 +121,7 @@ auto TokenDecoder::transactionCapturedSize(const Transaction *transaction) noexc
     assert(transaction != nullptr);
     assert(!_transactions.empty());
     assert(transaction->state() == Transaction::State::Open);
-    return _transactionBuffer.size() - transaction->transactionBufferStartIndex();
+    return _characterCount - _transactionBuffer.at(transaction->transactionBufferStartIndex()).characterCount;
 }
 
 
@@ -113,9 +133,15 @@ auto TokenDecoder::captureTransactionContent(
     assert(captureFn != nullptr);
     assert(transaction != nullptr);
     assert(transaction->state() == Transaction::State::Open);
+    // All captured characters are in the current line and were already validated by the char stream.
+    const auto startIndex = _transactionBuffer.at(transaction->transactionBufferStartIndex()).character.index();
+    const auto endIndex = _currentCharacter.index();
     String result;
-    for (std::size_t i = transaction->transactionBufferStartIndex(); i < _transactionBuffer.size(); ++i) {
-        captureFn(result, _transactionBuffer.at(i));
+    if (startIndex < endIndex) {
+        U8Decoder<const std::byte>{_decoder->lineData().subspan(startIndex, endIndex - startIndex)}.decodeAll(
+            [&](const Char &character) {
+                captureFn(result, character);
+            });
     }
     return result;
 }
@@ -124,8 +150,39 @@ auto TokenDecoder::captureTransactionContent(
 void TokenDecoder::popTransaction() noexcept {
     assert(!_transactions.empty());
     _transactions.pop_back();
+    _transactionBuffer.pop_back();
 }
 
 
+auto TokenDecoder::appendDecodedRun(
+    Bytes &target,
+    const BulkDecodeFn decodeFn,
+    const std::size_t digitCount,
+    const std::size_t byteCount) -> std::size_t {
+
+    if (_currentCharacter == Char::Error || _currentCharacter == CharClass::LineBreakOrEnd) {
+        return 0;
+    }
+    // The current character and the rest of the line are in the line data of the char stream.
+    const auto lineData = _decoder->lineData().subspan(_currentCharacter.index());
+    // Bound the run before the next spacing, end of a value, comment or line break, that are never digits.
+    // Only the bytes for this run are allocated, as runs can be short and are followed by more runs in the line.
+    const auto data = lineData.first(countBytesBeforeAny(lineData, cRunStopBytes));
+    auto &bytes = target.raw();
+    const auto startSize = bytes.size();
+    bytes.resize(startSize + data.size() / digitCount * byteCount);
+    const auto decodedSize = decodeFn(data, std::span{bytes}.subspan(startSize));
+    bytes.resize(startSize + decodedSize);
+    if (decodedSize == 0) {
+        return 0;
+    }
+    // All decoded digits are ASCII characters, the current character was already read from the stream.
+    const auto skippedCount = decodedSize / byteCount * digitCount - 1;
+    _decoder->skipAsciiCharacters(skippedCount);
+    _characterCount += skippedCount;
+    next();
+    return decodedSize;
 }
 
+
+}
@@ -1,4 +1,4 @@
-// Copyright (c) 2024-2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2024-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
@@ -12,7 +12,6 @@
 #include "../lexer/LexerToken.hpp"
 
 #include <cassert>
-#include <deque>
 #include <memory>
 #include <vector>
 
@@ -26,16 +25,14 @@ using TokenDecoderPtr = std::shared_ptr<TokenDecoder>;
 
 /// A wrapper around a decoder tailored for decoding tokens.
 ///
-/// - Adding transactions
+/// - Adding transactions. As transactions never span multiple lines, a rollback rewinds the char stream
+///   to the position in the current line, where the transaction started.
 /// - Adding exception helpers.
 /// - Adding indentation states.
 ///
 /// @tested `TokenDecoderTest`
 ///
 class TokenDecoder final : public Decoder {
-public:
-    using CharacterBuffer = std::deque<DecodedChar>;
-
 public:
     static auto create(CharStreamPtr decoder) noexcept -> TokenDecoderPtr {
         return std::make_shared<TokenDecoder>(std::move(decoder));
@@ -51,7 +48,6 @@ public:
 
 public: // implement Decoder
     void initialize() override {
-        _transactionBuffer.reserve(limits::maxLineLength);
         nextToken();
     }
 
@@ -68,6 +64,9 @@ public: // implement Decoder
     }
 
     void next() override;
+    void appendCharacterRun(String &target, std::u8string_view stopChars) override;
+    auto appendHexDigitPairs(Bytes &target) -> std::size_t override;
+    auto appendBase64Groups(Bytes &target) -> std::size_t override;
 
     /// Check for an error and throw it.
     ///
@@ -97,6 +96,20 @@ public:
         return _decoder->digest();
     }
 
+    /// Get the hash of all bytes that were read from the source.
+    ///
+    /// @return The hash, or empty if it was not enabled.
+    ///
+    [[nodiscard]] auto contentHash() const noexcept -> Bytes {
+        return _decoder->contentHash();
+    }
+
+    /// Enable the hash of all bytes that are read from the source.
+    ///
+    void enableContentHash() {
+        _decoder->enableContentHash();
+    }
+
     /// Move to the next character and start a new token.
     ///
     void nextToken() {
@@ -211,7 +224,7 @@ public: // testing
         auto result = InternalView::create();
         result->setValue("decoder", *object._decoder);
         result->setValue("currentCharacter", object._currentCharacter);
-        result->setValue("characterBuffer", InternalView::createList(10, object._characterBuffer.begin(), object._characterBuffer.end()));
+        result->setValue("characterCount", object._characterCount);
         result->setValue("tokenStartPosition", object._tokenStartPosition);
         result->setValue("transactions", InternalView::createList(10, object._transactions.begin(), object._transactions.end()));
         result->setValue("currentIndentationPattern", object._currentIndentationPattern);
@@ -224,13 +237,32 @@ public: // testing
     }
 #endif
 
+private:
+    /// A function that decodes characters from the line data in bulk.
+    ///
+    using BulkDecodeFn = std::size_t(*)(std::span<const std::byte> data, std::span<std::byte> output) noexcept;
+
+    /// Decode a run of characters from the line data, starting at the current character.
+    ///
+    /// @param target The bytes to append the decoded bytes to.
+    /// @param decodeFn The function to decode the line data.
+    /// @param digitCount The number of characters in a group decoded by the function.
+    /// @param byteCount The number of bytes for each decoded group.
+    /// @return The number of decoded bytes.
+    ///
+    auto appendDecodedRun(
+        Bytes &target,
+        BulkDecodeFn decodeFn,
+        std::size_t digitCount,
+        std::size_t byteCount) -> std::size_t;
+
 private:
     CharStreamPtr _decoder; ///< The wrapped decoder.
     DecodedChar _currentCharacter{Char::EndOfData, {}, {}}; ///< The current decoded character.
-    CharacterBuffer _characterBuffer; ///< A character buffer to allow rollback of transactions.
+    std::size_t _characterCount{0}; ///< The number of characters read from the char stream.
     Position _tokenStartPosition; ///< The start position of the current token.
     TransactionStack _transactions; ///< A stack with transactions.
-    TokenTransactionBuffer _transactionBuffer; ///< A buffer to stored the characters captured in a transaction.
+    TokenTransactionBuffer _transactionBuffer; ///< The start state for each open transaction.
     String _currentIndentationPattern; ///< The current indentation pattern.
     bool _hasUpcomingError{false}; ///< Set to `true` if an delayed error was scheduled.
     struct {
@@ -1,21 +1,34 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
 
 #include "DecodedChar.hpp"
 
+#include "../char/CharStream.hpp"
+
 #include <vector>
 
 
 namespace erbsland::conf::impl {
 
 
-/// A transaction buffer.
+/// The state of the token decoder when a transaction started.
+///
+/// @tested This is an integral part of `TokenDecoder`.
+///
+struct TokenTransactionStart final {
+    DecodedChar character; ///< The current character when the transaction started.
+    CharStream::ReadPosition readPosition; ///< The read position of the char stream after this character.
+    std::size_t characterCount{0}; ///< The number of characters read before this character.
+};
+
+
+/// A transaction buffer, with the start state of each open transaction.
 ///
 /// @tested This is an integral part of `TokenDecoder`.
 ///
-using TokenTransactionBuffer = std::vector<DecodedChar>;
+using TokenTransactionBuffer = std::vector<TokenTransactionStart>;
 
 
 }
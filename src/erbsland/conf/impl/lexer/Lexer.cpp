@@ -10,6 +10,8 @@
 
 #include "../utilities/YieldMacros.hpp"
 
+#include <utility>
+
 
 namespace erbsland::conf::impl {
 
@@ -69,11 +71,50 @@ auto Lexer::tokens() -> TokenGenerator {
 }
 
 
+auto Lexer::nextToken(LexerToken &token) -> bool {
+    while (!_tokenQueue.pop(token)) {
+        if (_pendingError != nullptr) {
+            std::rethrow_exception(std::exchange(_pendingError, nullptr));
+        }
+        if (_stateMachine.isFinished()) {
+            return false;
+        }
+        if (_decoder == nullptr) {
+            throw Error{ErrorCategory::Internal, u8"You cannot read from a closed lexer."};
+        }
+        try {
+            _stateMachine.step(decoder(), _tokenQueue);
+            if (_stateMachine.isFinished()) {
+                close();
+            }
+        } catch (const Error&) {
+            // Keep the error until all tokens created before it are read.
+            close();
+            _stateMachine.finish();
+            _pendingError = std::current_exception();
+        }
+    }
+    return true;
+}
+
+
 auto Lexer::digest() const -> Bytes {
     return _digest;
 }
 
 
+void Lexer::enableContentHash() {
+    if (_decoder != nullptr) {
+        _decoder->enableContentHash();
+    }
+}
+
+
+auto Lexer::contentHash() const -> Bytes {
+    return _contentHash;
+}
+
+
 auto Lexer::hashAlgorithm() -> crypto::ShaHash::Algorithm {
     return defaults::documentHashAlgorithm;
 }
@@ -83,6 +124,7 @@ void Lexer::close() noexcept {
     // Store the digest before the decoder is deleted.
     if (_decoder != nullptr) {
         _digest = _decoder->digest();
+        _contentHash = _decoder->contentHash();
     }
     _decoder.reset();
 }
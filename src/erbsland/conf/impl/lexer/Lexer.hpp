@@ -1,15 +1,19 @@
-// Copyright (c) 2024-2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2024-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
 
+#include "LexerStateMachine.hpp"
 #include "LexerToken.hpp"
 #include "TokenGenerator.hpp"
+#include "TokenQueue.hpp"
 
 #include "../decoder/TokenDecoder.hpp"
 #include "../utilities/Generator.hpp"
 #include "../utilities/InternalView.hpp"
 
+#include <exception>
+
 
 namespace erbsland::conf::impl {
 
@@ -26,7 +30,9 @@ using LexerPtr = std::shared_ptr<Lexer>;
 /// On a successful run, there is *always* a last `EndOfData` token, with no raw text and no positions. This last
 /// token makes sure that the exception that occurs after the last actual text is correctly propagated to the caller.
 ///
-/// The method `tokens()` can only be called once.
+/// The tokens can be read in two ways: `tokens()` returns a coroutine generator, while `nextToken()` uses
+/// a state machine and moves each token into a slot provided by the caller. Both produce the same sequence of tokens.
+/// For each lexer instance, only one of these methods can be used, and `tokens()` can only be called once.
 ///
 /// @tested Individual parts tested in `Lexer...Test` unit tests.
 ///
@@ -67,15 +73,41 @@ public:
     ///
     auto tokens() -> TokenGenerator;
 
+    /// Read the next token from the decoded document.
+    ///
+    /// This is the alternative to `tokens()` that does not use coroutines. Tokens are produced line by line into
+    /// an internal queue and moved into the given slot. If an error occurs, all tokens created before the error are
+    /// returned first, then the error is thrown. This is the same behavior as with `tokens()`.
+    ///
+    /// @param token The slot that receives the next token.
+    /// @return `true` if a token was moved into the slot. `false` if the last `EndOfData` token was already read.
+    /// @throws Error in case of any error while processing the input.
+    ///
+    auto nextToken(LexerToken &token) -> bool;
+
     /// Get the digest from the tokenized document.
     ///
-    /// Must be called *after* calling `tokens()` and read all tokens including the end-of-data token.
+    /// Must be called *after* calling `tokens()` or `nextToken()` and read all tokens including the end-of-data token.
     /// The method must also be called before calling `close()`.
     ///
     /// @return The digest for the document, or empty if none was created.
     ///
     [[nodiscard]] auto digest() const -> Bytes;
 
+    /// Enable the hash of all bytes that are read from the source.
+    ///
+    /// Must be called before the first token is read.
+    ///
+    void enableContentHash();
+
+    /// Get the hash of all bytes that were read from the source.
+    ///
+    /// Like `digest()`, the hash is available after all tokens were read.
+    ///
+    /// @return The hash, or empty if it was not enabled.
+    ///
+    [[nodiscard]] auto contentHash() const -> Bytes;
+
     /// Get the algorithm that was used to create the hash digest for the document.
     ///
     [[nodiscard]] static auto hashAlgorithm() -> crypto::ShaHash::Algorithm;
@@ -95,6 +127,10 @@ public: // testing
 private:
     TokenDecoderPtr _decoder; ///< The token decoder.
     Bytes _digest; ///< The digest of the document.
+    Bytes _contentHash; ///< The hash of all bytes that were read from the source.
+    LexerStateMachine _stateMachine; ///< The state machine for `nextToken()`.
+    TokenQueue _tokenQueue; ///< The tokens produced by the state machine, but not read yet.
+    std::exception_ptr _pendingError; ///< An error that is thrown after all queued tokens are read.
 };
 
 
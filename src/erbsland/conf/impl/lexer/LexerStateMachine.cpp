@@ -0,0 +1,437 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "LexerStateMachine.hpp"
+
+
+#include "Name.hpp"
+#include "Text.hpp"
+#include "ValueMultiLine.hpp"
+
+
+namespace erbsland::conf::impl {
+
+
+using lexer::ExpectMore;
+using lexer::MultiLineAllowed;
+using lexer::NextLine;
+
+
+void LexerStateMachine::step(TokenDecoder &decoder, TokenQueue &tokens) {
+    switch (_state) {
+    case State::Initialize:
+        decoder.initialize();
+        _state = State::LineStart;
+        break;
+    case State::LineStart:
+        stepLineStart(decoder, tokens);
+        break;
+    case State::MultiLineText:
+        stepMultiLineText(decoder, tokens);
+        break;
+    case State::MultiLineBytes:
+        stepMultiLineBytes(decoder, tokens);
+        break;
+    case State::MultiLineValueList:
+        stepMultiLineValueList(decoder, tokens);
+        break;
+    case State::Finished:
+        break;
+    }
+}
+
+
+void LexerStateMachine::stepLineStart(TokenDecoder &decoder, TokenQueue &tokens) {
+    // We assume that the read character is always the first character of a new line.
+    if (decoder.character() == Char::EndOfData) {
+        // Always return an end of data token as the last token in the stream.
+        tokens.push(decoder.createEndOfDataToken());
+        _state = State::Finished;
+        return;
+    }
+    if (decoder.character() == CharClass::Spacing) {
+        // Manually handle spacing to improve the error reporting.
+        tokens.push(lexer::expectSpacing(decoder));
+        if (decoder.character() == CharClass::EndOfLineStart) {
+            addEndOfLine(decoder, ExpectMore::No, tokens);
+        } else {
+            if (decoder.character() == CharClass::NameStart) {
+                decoder.throwSyntaxError(
+                    u8"Value names must appear at the beginning of a line without leading spaces.");
+            }
+            if (decoder.character() == CharClass::SectionStart) {
+                decoder.throwSyntaxError(
+                    u8"Section declarations must start at the beginning of a line without any indentation.");
+            }
+            decoder.throwSyntaxOrUnexpectedEndError(
+                u8"Unexpected content after indentation: only a comments or an empty lines was expected at this point.");
+        }
+    }
+    // Like in `Lexer::tokens()`, the line following an indented empty line is processed in the same step.
+    if (decoder.character() == CharClass::EndOfLineStart) {
+        addEndOfLine(decoder, ExpectMore::No, tokens);
+    } else if (decoder.character() == CharClass::NameStart) {
+        addNameAndValue(decoder, tokens);
+    } else if (decoder.character() == CharClass::SectionStart) {
+        addSection(decoder, tokens);
+    } else {
+        decoder.throwSyntaxError(u8"Expected a section, name or empty line, but got something else.");
+    }
+}
+
+
+void LexerStateMachine::stepMultiLineText(TokenDecoder &decoder, TokenQueue &tokens) {
+    // At the start of each step, the decoder should be at the indented continued line.
+    if (decoder.character() == Char::EndOfData) {
+        decoder.throwUnexpectedEndOfDataError();
+    }
+    // Test if we get the closing bracket sequence.
+    if (auto closeToken = lexer::scanMultiLineClose(decoder, _multiLineOpenType); closeToken.has_value()) {
+        tokens.push(std::move(closeToken));
+        _state = State::LineStart;
+        return;
+    }
+    // Capture text, trailing spacing (+comment) and line-break.
+    switch (_multiLineOpenType.raw()) {
+    case TokenType::MultiLineTextOpen:
+        tokens.push(lexer::parseMultiLineStringContent(
+            decoder,
+            Char::Backslash,
+            lexer::parseTextEscapeSequence,
+            TokenType::MultiLineText));
+        break;
+    case TokenType::MultiLineCodeOpen:
+        tokens.push(lexer::parseMultiLineStringContent(
+            decoder,
+            {},
+            {},
+            TokenType::MultiLineCode));
+        break;
+    case TokenType::MultiLineRegexOpen:
+        tokens.push(lexer::parseMultiLineStringContent(
+            decoder,
+            Char::Backslash,
+            lexer::parseRegularExpressionEscapeSequence,
+            TokenType::MultiLineRegex));
+        break;
+    default:
+        throw std::runtime_error("Unexpected open token type.");
+    }
+    addEndOfLine(decoder, ExpectMore::No, tokens);
+    decoder.expectMore(u8"Unexpected end in a multi-line text, code-block or regular expression.");
+    // if the following line starts with spacing, expect the correct indentation pattern.
+    if (decoder.character() == CharClass::Spacing) {
+        tokens.push(lexer::expectAndCheckIndentation(decoder));
+        decoder.expectMore(u8"Unexpected end in multi-line text, code-block or regular expression.");
+    } else if (decoder.character() != CharClass::LineBreak) {
+        decoder.throwSyntaxError(u8"Missing indentation in multi-line text.");
+    }
+}
+
+
+void LexerStateMachine::stepMultiLineBytes(TokenDecoder &decoder, TokenQueue &tokens) {
+    // At the start of each step, the decoder should be at the indented continued line.
+    if (decoder.character() == Char::EndOfData) {
+        decoder.throwUnexpectedEndOfDataError(u8"Unexpected end in multi-line byte-data.");
+    }
+    // Test if we get the closing bracket sequence.
+    if (auto closeToken = lexer::scanMultiLineClose(decoder, TokenType::MultiLineBytesOpen); closeToken.has_value()) {
+        tokens.push(std::move(closeToken));
+        _state = State::LineStart;
+        return;
+    }
+    tokens.push(lexer::parseMultiLineBytesContent(decoder, _multiLineBytesFormat, _isMultiLineBytesPaddingFound));
+    addEndOfLine(decoder, ExpectMore::No, tokens);
+    decoder.expectMore(u8"Unexpected end in a multi-line bytes-data.");
+    // if the following line starts with spacing, expect the correct indentation pattern.
+    if (decoder.character() == CharClass::Spacing) {
+        tokens.push(lexer::expectAndCheckIndentation(decoder));
+        decoder.expectMore(u8"Unexpected end in multi-line byte-data.");
+    } else if (decoder.character() != CharClass::LineBreak) {
+        decoder.throwSyntaxError(u8"Missing indentation in multi-line byte-data.");
+    }
+}
+
+
+void LexerStateMachine::stepMultiLineValueList(TokenDecoder &decoder, TokenQueue &tokens) {
+    // If the next line starts with spacing, it is potentially a continuation of the value list.
+    if (decoder.character() != CharClass::Spacing) {
+        _state = State::LineStart;
+        return;
+    }
+    auto transaction = Transaction{decoder};
+    while (decoder.character() == CharClass::Spacing) {
+        decoder.next();
+    }
+    if (decoder.character() == CharClass::EndOfLineStart) {
+        // This is a valid empty line. Therefore, also a valid end of the list.
+        transaction.rollback();
+        _state = State::LineStart;
+        return;
+    }
+    if (transaction.capturedString() != decoder.indentationPattern()) {
+        tokens.push(decoder.createToken(TokenType::Indentation)); // Consume the spacing as an indentation token.
+        transaction.commit();
+        decoder.throwError(ErrorCategory::Indentation,
+            u8"The indentation pattern does not match the one on the previous line.");
+    }
+    if (decoder.character() != Char::Asterisk) {
+        tokens.push(decoder.createToken(TokenType::Indentation)); // Consume the spacing as an indentation token.
+        transaction.commit();
+        decoder.throwSyntaxError(
+            u8"Expected the asterisk for a value list continuation, but got something else.");
+    }
+    transaction.commit();
+    tokens.push(decoder.createToken(TokenType::Indentation)); // Consume the spacing.
+    decoder.next();
+    tokens.push(decoder.createToken(TokenType::MultiLineValueListSeparator)); // Consume the asterisk.
+    tokens.push(lexer::scanForSpacing(decoder));
+    decoder.expectMore(u8"Unexpected end in multi-line value list. Expected a value.");
+    addSingleLineValueOrValueList(decoder, tokens);
+}
+
+
+void LexerStateMachine::addNameAndValue(TokenDecoder &decoder, TokenQueue &tokens) {
+    decoder.clearIndentationPattern(); // Clear the indentation pattern at the start of a name/value line.
+    if (decoder.character() == CharClass::Letter || decoder.character() == Char::At) {
+        tokens.push(lexer::expectRegularOrMetaNameToken(decoder));
+    } else {
+        // assumes this must be a text name; otherwise this method was called from the wrong context.
+        if (decoder.character() != Char::DoubleQuote) {
+            decoder.throwInternalError(u8"Function 'addNameAndValue' called from the wrong context.");
+        }
+        tokens.push(lexer::expectTextName(decoder));
+    }
+    tokens.push(lexer::scanForSpacing(decoder));
+    decoder.expectAndNext(CharClass::NameValueSeparator,
+        u8"Expected a value separator after the name, but got something else.");
+    tokens.push(decoder.createToken(TokenType::NameValueSeparator));
+    tokens.push(lexer::scanForSpacing(decoder));
+    if (decoder.character() == Char::CommentStart || decoder.character() == CharClass::LineBreak) {
+        addEndOfLine(decoder, ExpectMore::Yes, tokens); // The Value is defined on the next line.
+        decoder.expectMore(u8"Expected a value on the next line.");
+        tokens.push(lexer::expectAndCheckIndentation(decoder));
+        addValueOrValueList(decoder, NextLine::Yes, MultiLineAllowed::Yes, tokens);
+    } else if (decoder.character() == Char::EndOfData) {
+        decoder.throwUnexpectedEndOfDataError(u8"Expected a value after the name separator.");
+    } else {
+        addValueOrValueList(decoder, NextLine::No, MultiLineAllowed::Yes, tokens);
+    }
+}
+
+
+void LexerStateMachine::addValueOrValueList(
+    TokenDecoder &decoder,
+    const NextLine nextLine,
+    const MultiLineAllowed multiLineAllowed,
+    TokenQueue &tokens) {
+
+    if (nextLine == NextLine::Yes && decoder.character() == Char::Asterisk) {
+        beginMultiLineValueList(decoder, tokens);
+        return;
+    }
+    // Check for multi-line values at this point.
+    if (multiLineAllowed == MultiLineAllowed::Yes && decoder.character() == CharClass::OpeningBracket) {
+        if (auto multiLineOpenToken = lexer::scanMultiLineOpen(decoder)) {
+            const auto tokenType = multiLineOpenToken.value().type();
+            tokens.push(std::move(multiLineOpenToken));
+            switch (tokenType.raw()) {
+            case TokenType::MultiLineTextOpen:
+            case TokenType::MultiLineCodeOpen:
+            case TokenType::MultiLineRegexOpen:
+                beginMultiLineText(decoder, tokenType, tokens);
+                break;
+            case TokenType::MultiLineBytesOpen:
+                beginMultiLineBytes(decoder, tokens);
+                break;
+            default:
+                throw std::runtime_error("Unexpected token type after opening bracket.");
+            }
+            return;
+        }
+    }
+    addSingleLineValueOrValueList(decoder, tokens);
+}
+
+
+void LexerStateMachine::beginMultiLineValueList(TokenDecoder &decoder, TokenQueue &tokens) {
+    if (decoder.character() != Char::Asterisk) {
+        decoder.throwInternalError(u8"Called 'beginMultiLineValueList' in the wrong state.");
+    }
+    decoder.next();
+    tokens.push(decoder.createToken(TokenType::MultiLineValueListSeparator));
+    tokens.push(lexer::scanForSpacing(decoder));
+    decoder.expectMore(u8"Unexpected end in multi-line value list. Expected a value.");
+    addSingleLineValueOrValueList(decoder, tokens);
+    // At this point, we are on the following line.
+    if (decoder.character() == Char::EndOfData) {
+        return; // This is a valid end of the document.
+    }
+    if (decoder.character() != CharClass::Spacing) {
+        return; // If there is something else following the list, it is a valid end of the list.
+    }
+    if (!decoder.hasIndentationPattern()) {
+        decoder.throwInternalError(u8"Expected to have an indentation patten at this point.");
+    }
+    _state = State::MultiLineValueList;
+}
+
+
+void LexerStateMachine::beginMultiLineText(TokenDecoder &decoder, const TokenType openTokenType, TokenQueue &tokens) {
+    // In the case of code, accept a language identifier, just after the opening sequence.
+    if (openTokenType == TokenType::MultiLineCodeOpen) {
+        if (auto languageIdentifier = lexer::scanFormatOrLanguageIdentifier(decoder, true);
+            !languageIdentifier.empty()) {
+            tokens.push(decoder.createToken(TokenType::MultiLineCodeLanguage, std::move(languageIdentifier)));
+            decoder.expectMore(u8"Unexpected end in multi-line code block.");
+        }
+    }
+    // Process any text following the opening bracket sequence.
+    addMultiLineAfterOpen(decoder, tokens);
+    _multiLineOpenType = openTokenType;
+    _state = State::MultiLineText;
+}
+
+
+void LexerStateMachine::beginMultiLineBytes(TokenDecoder &decoder, TokenQueue &tokens) {
+    // expect to be at the character just after the opening angle bracket.
+    decoder.expectMore(u8"Unexpected end in bytes value.");
+    _multiLineBytesFormat = lexer::BytesFormat::Hex;
+    _isMultiLineBytesPaddingFound = false;
+    if (auto formatIdentifier = lexer::scanFormatOrLanguageIdentifier(decoder, true); !formatIdentifier.empty()) {
+        if (decoder.character() != CharClass::EndOfLineStart) {
+            decoder.throwSyntaxError(u8"Unexpected characters in bytes-data format identifier.");
+        }
+        _multiLineBytesFormat = lexer::bytesFormatFromIdentifier(decoder, formatIdentifier);
+        tokens.push(decoder.createToken(TokenType::MultiLineBytesFormat, std::move(formatIdentifier)));
+    }
+    if (decoder.character() != CharClass::EndOfLineStart) {
+        decoder.throwSyntaxError(u8"Unexpected characters in bytes-data format identifier");
+    }
+    // Process any text following the opening bracket sequence.
+    addMultiLineAfterOpen(decoder, tokens);
+    _state = State::MultiLineBytes;
+}
+
+
+void LexerStateMachine::addSection(TokenDecoder &decoder, TokenQueue &tokens) {
+    bool isListSection = false;
+    // First, parse the opening bracket for the section.
+    while (decoder.character() == Char::Minus) { // Skip any number of '-' in front of the section.
+        decoder.next();
+    }
+    if (decoder.character() == Char::Asterisk) { // If there is an asterisk, this is a list section header.
+        decoder.next();
+        isListSection = true;
+    }
+    // At this point, only an open square bracket is valid.
+    decoder.expectAndNext(Char::OpenSBracket, u8"Expected an opening square bracket, but got something else.");
+    tokens.push(decoder.createToken(isListSection ? TokenType::SectionListOpen : TokenType::SectionMapOpen));
+    // Spacing inside the section brackets is allowed.
+    tokens.push(lexer::scanForSpacing(decoder));
+    // Relative paths start with a path separator.
+    if (decoder.character() == Char::NamePathSeparator) {
+        decoder.next();
+        tokens.push(decoder.createToken(TokenType::NamePathSeparator));
+        tokens.push(lexer::scanForSpacing(decoder));
+    }
+    // Read as many names as we get (the parser will handle the logic).
+    while (decoder.character() == CharClass::SectionNameStart) {
+        if (decoder.character() == CharClass::Letter) {
+            tokens.push(lexer::expectRegularOrMetaNameToken(decoder));
+        } else {
+            tokens.push(lexer::expectTextName(decoder));
+        }
+        tokens.push(lexer::scanForSpacing(decoder));
+        if (decoder.character() != Char::NamePathSeparator) {
+            break;
+        }
+        decoder.next();
+        tokens.push(decoder.createToken(TokenType::NamePathSeparator));
+        tokens.push(lexer::scanForSpacing(decoder));
+    }
+    // At this point, we expect the closing square bracket.
+    decoder.expectAndNext(Char::ClosingSBracket, u8"Expected a closing square bracket, but got something else.");
+    // For a list section, accept an asterisk.
+    if (decoder.character() == Char::Asterisk) {
+        if (isListSection) {
+            decoder.next();
+        } else {
+            decoder.throwSyntaxError(u8"A map section cannot have an asterisk after the closing square bracket.");
+        }
+    }
+    // Accept any number of minus chars.
+    while (decoder.character() == Char::Minus) {
+        decoder.next();
+    }
+    tokens.push(decoder.createToken(isListSection ? TokenType::SectionListClose : TokenType::SectionMapClose));
+    // At this point, the line must end.
+    decoder.expect(CharClass::EndOfLineStart, u8"Expected end of line after section, but got something else.");
+    addEndOfLine(decoder, ExpectMore::No, tokens);
+}
+
+
+void LexerStateMachine::addSingleLineValueOrValueList(TokenDecoder &decoder, TokenQueue &tokens) {
+    tokens.push(lexer::expectSingleLineValue(decoder));
+    tokens.push(lexer::scanForSpacing(decoder));
+    while (decoder.character() == Char::ValueListSeparator) { // Is this a list?
+        decoder.next();
+        tokens.push(decoder.createToken(TokenType::ValueListSeparator));
+        tokens.push(lexer::scanForSpacing(decoder));
+        if (decoder.character() == CharClass::LineBreakOrEnd) {
+            decoder.throwSyntaxOrUnexpectedEndError(u8"Expected another value after the value list separator.");
+        }
+        tokens.push(lexer::expectSingleLineValue(decoder));
+        tokens.push(lexer::scanForSpacing(decoder));
+    }
+    decoder.expect(CharClass::EndOfLineStart, u8"Expected end of line or a value separator, but got something else.");
+    addEndOfLine(decoder, ExpectMore::No, tokens);
+}
+
+
+void LexerStateMachine::addMultiLineAfterOpen(TokenDecoder &decoder, TokenQueue &tokens) {
+    addEndOfLine(decoder, ExpectMore::Yes, tokens);
+    decoder.expectMore(u8"Unexpected end in multi-line expression.");
+    // Now we are at the start of a new line.
+    if (decoder.character() == CharClass::Spacing) {
+        tokens.push(lexer::expectAndCheckIndentation(decoder));
+    } else if (decoder.character() != CharClass::LineBreak) {
+        decoder.throwSyntaxError(u8"Expected continued text or data, but got something else.");
+    }
+    // Special case with an empty line after the opening bracket.
+    // Don't consume this linebreak, pass it down to the multi-line-text logic.
+}
+
+
+void LexerStateMachine::addEndOfLine(TokenDecoder &decoder, const ExpectMore expectMore, TokenQueue &tokens) {
+    const auto acceptEndOfData = [&]() -> bool {
+        if (decoder.character() != Char::EndOfData) {
+            return false;
+        }
+        if (expectMore == ExpectMore::Yes) {
+            decoder.throwUnexpectedEndOfDataError(u8"Expected the data to be continued on the next line.");
+        }
+        return true; // The line end can align with the end of the data.
+    };
+    if (acceptEndOfData()) {
+        return;
+    }
+    // Spacing at the end of a line is allowed
+    tokens.push(lexer::scanForSpacing(decoder));
+    if (acceptEndOfData()) {
+        return;
+    }
+    // After the spacing, a comment is allowed.
+    if (decoder.character() == Char::CommentStart) {
+        tokens.push(lexer::expectComment(decoder));
+    }
+    if (acceptEndOfData()) {
+        return;
+    }
+    // At this point, a line-break is expected, or the data must end.
+    decoder.expect(CharClass::LineBreak, u8"Expected the end of the line, but got something else.");
+    tokens.push(lexer::expectLinebreak(decoder));
+}
+
+
+}
+
@@ -0,0 +1,142 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "Core.hpp"
+#include "TokenQueue.hpp"
+#include "Value.hpp"
+#include "ValueBytes.hpp"
+
+#include "../decoder/TokenDecoder.hpp"
+
+
+namespace erbsland::conf::impl {
+
+
+/// The lexer as a state machine, without coroutines.
+///
+/// This is the counterpart to the coroutine-based `Lexer::tokens()` and produces exactly the same sequence of
+/// tokens. Each call to `step()` reads one line of the document, or one statement that starts on the current line,
+/// and adds all tokens to the given queue. Multi-line texts, bytes and value lists are read line by line, using
+/// the states `MultiLineText`, `MultiLineBytes` and `MultiLineValueList` to remember where the block continues.
+///
+/// The functions in this class mirror the `expect...` functions from the `lexer` namespace. If you change the
+/// syntax in one of these functions, the corresponding function in this class must be updated as well.
+///
+/// @tested `LexerStateMachineTest`
+///
+class LexerStateMachine final {
+    /// The state of the lexer.
+    ///
+    enum class State : uint8_t {
+        /// The decoder is not initialized yet.
+        Initialize,
+        /// At the start of a new line in the document.
+        LineStart,
+        /// At the start of a continued line in a multi-line text, code or regular expression.
+        MultiLineText,
+        /// At the start of a continued line in multi-line bytes-data.
+        MultiLineBytes,
+        /// At the start of a line that potentially continues a multi-line value list.
+        MultiLineValueList,
+        /// The end-of-data token was produced, or an error stopped the lexer.
+        Finished,
+    };
+
+public:
+    // defaults
+    LexerStateMachine() = default;
+    ~LexerStateMachine() = default;
+
+public:
+    /// Test if the state machine produced its last token.
+    ///
+    [[nodiscard]] auto isFinished() const noexcept -> bool {
+        return _state == State::Finished;
+    }
+
+    /// Read the next line or statement and add its tokens to the queue.
+    ///
+    /// A step may add no tokens at all, e.g. when the decoder is initialized.
+    ///
+    /// @param decoder The decoder for the document.
+    /// @param tokens The queue to add the tokens.
+    /// @throws Error in case of any error while processing the input. Tokens that were added before the error
+    ///     stay in the queue.
+    ///
+    void step(TokenDecoder &decoder, TokenQueue &tokens);
+
+    /// Stop the state machine, e.g. after an error.
+    ///
+    void finish() noexcept {
+        _state = State::Finished;
+    }
+
+private:
+    /// Read a line at the root level of the document.
+    ///
+    void stepLineStart(TokenDecoder &decoder, TokenQueue &tokens);
+
+    /// Read a continued line of a multi-line text, code or regular expression.
+    ///
+    void stepMultiLineText(TokenDecoder &decoder, TokenQueue &tokens);
+
+    /// Read a continued line of multi-line bytes-data.
+    ///
+    void stepMultiLineBytes(TokenDecoder &decoder, TokenQueue &tokens);
+
+    /// Read a line that potentially continues a multi-line value list.
+    ///
+    void stepMultiLineValueList(TokenDecoder &decoder, TokenQueue &tokens);
+
+    /// Add the tokens for a "name: value" sequence.
+    ///
+    void addNameAndValue(TokenDecoder &decoder, TokenQueue &tokens);
+
+    /// Add the tokens for a value or value list, and start a multi-line block if required.
+    ///
+    void addValueOrValueList(
+        TokenDecoder &decoder,
+        lexer::NextLine nextLine,
+        lexer::MultiLineAllowed multiLineAllowed,
+        TokenQueue &tokens);
+
+    /// Add the tokens for the first line of a multi-line value list.
+    ///
+    void beginMultiLineValueList(TokenDecoder &decoder, TokenQueue &tokens);
+
+    /// Add the tokens after the opening sequence of a multi-line text, code or regular expression.
+    ///
+    void beginMultiLineText(TokenDecoder &decoder, TokenType openTokenType, TokenQueue &tokens);
+
+    /// Add the tokens after the opening sequence of a multi-line bytes-data block.
+    ///
+    void beginMultiLineBytes(TokenDecoder &decoder, TokenQueue &tokens);
+
+    /// Add the tokens for a section.
+    ///
+    static void addSection(TokenDecoder &decoder, TokenQueue &tokens);
+
+    /// Add the tokens for a single-line value or value list.
+    ///
+    static void addSingleLineValueOrValueList(TokenDecoder &decoder, TokenQueue &tokens);
+
+    /// Add the tokens for the end of a line after an opening multi-line bracket.
+    ///
+    static void addMultiLineAfterOpen(TokenDecoder &decoder, TokenQueue &tokens);
+
+    /// Add the tokens for the end of a line.
+    ///
+    static void addEndOfLine(TokenDecoder &decoder, lexer::ExpectMore expectMore, TokenQueue &tokens);
+
+private:
+    State _state{State::Initialize}; ///< The current state.
+    TokenType _multiLineOpenType{TokenType::EndOfData}; ///< The open token of the current multi-line block.
+    lexer::BytesFormat _multiLineBytesFormat{lexer::BytesFormat::Hex}; ///< The format of the current bytes block.
+    bool _isMultiLineBytesPaddingFound{false}; ///< If the current bytes block contained base64 padding.
+};
+
+
+}
+
@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #include "Text.hpp"
 
@@ -9,6 +9,8 @@
 
 #include "../utilities/YieldMacros.hpp"
 
+#include <array>
+
 
 namespace erbsland::conf::impl::lexer {
 
@@ -20,6 +22,9 @@ void parseString(
     const char32_t escapeChar,
     const EscapeFn &escapeFn) {
 
+    // Regular characters are appended in runs, that end at the terminator, the escape character or a line break.
+    const std::array stopCharBuffer{static_cast<char8_t>(terminator), static_cast<char8_t>(escapeChar)};
+    const auto stopChars = std::u8string_view{stopCharBuffer.data(), escapeChar != 0 ? 2U : 1U};
     while (decoder.character() != Char::EndOfData) {
         decoder.checkForErrorAndThrowIt();
         if (decoder.character() == CharClass::LineBreak) {
@@ -34,56 +39,70 @@ void parseString(
             decoder.expectMore(u8"Unexpected end in an escape sequence.");
             escapeFn(decoder, target);
         } else {
-            decoder.character().appendTo(target);
-            decoder.next();
+            decoder.appendCharacterRun(target, stopChars);
         }
     }
     decoder.throwUnexpectedEndOfDataError();
 }
 
 
-auto parseMultiLineString(
+auto parseMultiLineStringContent(
     TokenDecoder &decoder,
     const char32_t escapeChar,
-    EscapeFn escapeFn,
-    const TokenType tokenType) -> TokenGenerator {
+    const EscapeFn &escapeFn,
+    const TokenType tokenType) -> std::optional<LexerToken> {
 
     // Initial check if the line starts with the end marker, so we avoid creating a transaction and capture string.
-    if (!isAtMultiLineEnd(decoder, tokenType)) {
-        String decodedText;
-        // Carefully consume the text block by block, so we can skip trailing spacing.
-        while (!isAtMultiLineEnd(decoder, tokenType)) {
-            // Consume anything that is not space, or the end of the line.
-            while (decoder.character() != CharClass::Spacing && decoder.character() != CharClass::LineBreakOrEnd) {
-                decoder.checkForErrorAndThrowIt();
-                if (decoder.character() == escapeChar) {
-                    decoder.next();
-                    escapeFn(decoder, decodedText);
-                } else {
-                    decoder.character().appendTo(decodedText);
-                    decoder.next();
-                }
-            }
-            // If the line ends here, commit everything consumed so far.
-            if (decoder.character() == CharClass::LineBreakOrEnd) {
-                break;
-            }
-            // At this point we are in spacing territory, always expect that we read the trailing space of the line.
-            auto trailingSpaceTransaction = Transaction{decoder};
-            while (decoder.character() == CharClass::Spacing) {
+    if (isAtMultiLineEnd(decoder, tokenType)) {
+        return std::nullopt;
+    }
+    // Regular characters are appended in runs, that end at spacing, the escape character or a line break.
+    const std::array stopCharBuffer{u8' ', u8'\t', static_cast<char8_t>(escapeChar)};
+    const auto stopChars = std::u8string_view{stopCharBuffer.data(), escapeChar != 0 ? 3U : 2U};
+    String decodedText;
+    // Carefully consume the text block by block, so we can skip trailing spacing.
+    while (!isAtMultiLineEnd(decoder, tokenType)) {
+        // Consume anything that is not space, or the end of the line.
+        while (decoder.character() != CharClass::Spacing && decoder.character() != CharClass::LineBreakOrEnd) {
+            decoder.checkForErrorAndThrowIt();
+            if (decoder.character() == escapeChar) {
                 decoder.next();
+                escapeFn(decoder, decodedText);
+            } else {
+                decoder.appendCharacterRun(decodedText, stopChars);
             }
-            if (isAtMultiLineEnd(decoder, tokenType)) {
-                // If we reached the end of the line, while consuming spaces. We have to roll back this section,
-                // as this is the trailing portion that is not part of the actual text.
-                trailingSpaceTransaction.rollback();
-                break;
-            }
-            decodedText.append(trailingSpaceTransaction.capturedString());
-            trailingSpaceTransaction.commit();
         }
-        EL_YIELD_TOKEN(tokenType, std::move(decodedText));
+        // If the line ends here, commit everything consumed so far.
+        if (decoder.character() == CharClass::LineBreakOrEnd) {
+            break;
+        }
+        // At this point we are in spacing territory, always expect that we read the trailing space of the line.
+        auto trailingSpaceTransaction = Transaction{decoder};
+        const auto textSizeBeforeSpacing = decodedText.size();
+        while (decoder.character() == CharClass::Spacing) {
+            decoder.character().appendTo(decodedText);
+            decoder.next();
+        }
+        if (isAtMultiLineEnd(decoder, tokenType)) {
+            // If we reached the end of the line, while consuming spaces. We have to roll back this section,
+            // as this is the trailing portion that is not part of the actual text.
+            trailingSpaceTransaction.rollback();
+            decodedText.erase(textSizeBeforeSpacing);
+            break;
+        }
+        trailingSpaceTransaction.commit();
     }
+    return decoder.createToken(tokenType, std::move(decodedText));
+}
+
+
+auto parseMultiLineString(
+    TokenDecoder &decoder,
+    const char32_t escapeChar,
+    EscapeFn escapeFn,
+    const TokenType tokenType) -> TokenGenerator {
+
+    EL_YIELD_OPTIONAL(parseMultiLineStringContent(decoder, escapeChar, escapeFn, tokenType));
     // Read the end-of-line tokens (may include a comment if at #).
     EL_YIELD_FROM(expectEndOfLine(decoder, ExpectMore::No));
     // Do the check for more data after creating all tokens for the line.
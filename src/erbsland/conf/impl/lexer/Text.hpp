@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
@@ -42,6 +42,23 @@ void parseString(
     char32_t escapeChar,
     const EscapeFn &escapeFn);
 
+/// Parse the text content of a single line in a multi-line string.
+///
+/// - Parses the text up to the last character that is no trailing spacing.
+/// - Leaves with the decoder at the trailing spacing, comment or end of the line.
+///
+/// @param decoder The decoder to use.
+/// @param escapeChar An escape character (use zero if there is no escape character).
+/// @param escapeFn The function to handle escape characters.
+/// @param tokenType The type of token to return.
+/// @return The token with the text, or nothing if the line has no text.
+///
+[[nodiscard]] auto parseMultiLineStringContent(
+    TokenDecoder &decoder,
+    char32_t escapeChar,
+    const EscapeFn &escapeFn,
+    TokenType tokenType) -> std::optional<LexerToken>;
+
 /// Generic function to parse a multi-line string.
 ///
 /// - Parses a string up to the last character, that is no trailing spacing.
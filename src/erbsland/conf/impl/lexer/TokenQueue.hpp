@@ -0,0 +1,94 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "LexerToken.hpp"
+
+#include <optional>
+#include <vector>
+
+
+namespace erbsland::conf::impl {
+
+
+/// A reusable queue for the tokens produced by one step of the lexer state machine.
+///
+/// Tokens are moved in and out of the queue, they are never copied. The storage is kept between the steps,
+/// so after a few lines of a document, no further allocations are required for the queue itself.
+///
+/// @tested `LexerStateMachineTest`
+///
+class TokenQueue final {
+public:
+    /// The initial capacity of the queue.
+    ///
+    constexpr static std::size_t cInitialCapacity = 32;
+
+public:
+    /// Create an empty token queue.
+    ///
+    TokenQueue() {
+        _tokens.reserve(cInitialCapacity);
+    }
+
+    // defaults
+    ~TokenQueue() = default;
+
+public:
+    /// Test if there are no tokens left to read.
+    ///
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return _readIndex == _tokens.size();
+    }
+
+    /// Add a token at the end of the queue.
+    ///
+    void push(LexerToken &&token) {
+        _tokens.emplace_back(std::move(token));
+    }
+
+    /// Add an optional token at the end of the queue.
+    ///
+    /// If the optional is empty, nothing is added.
+    ///
+    void push(std::optional<LexerToken> &&token) {
+        if (token.has_value()) {
+            _tokens.emplace_back(std::move(token).value());
+        }
+    }
+
+    /// Move the first token from the queue into the given slot.
+    ///
+    /// @param token The slot that receives the token.
+    /// @return `true` if a token was moved, `false` if the queue was empty.
+    ///
+    auto pop(LexerToken &token) noexcept -> bool {
+        if (empty()) {
+            return false;
+        }
+        token = std::move(_tokens[_readIndex]);
+        _readIndex += 1;
+        if (_readIndex == _tokens.size()) {
+            // Keep the capacity for the next step.
+            _tokens.clear();
+            _readIndex = 0;
+        }
+        return true;
+    }
+
+    /// Remove all tokens from the queue.
+    ///
+    void clear() noexcept {
+        _tokens.clear();
+        _readIndex = 0;
+    }
+
+private:
+    std::vector<LexerToken> _tokens; ///< The tokens in the queue.
+    std::size_t _readIndex{0}; ///< The index of the next token to read.
+};
+
+
+}
+
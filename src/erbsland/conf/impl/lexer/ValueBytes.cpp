@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #include "ValueBytes.hpp"
 
@@ -12,6 +12,138 @@
 namespace erbsland::conf::impl::lexer {
 
 
+namespace {
+
+
+/// Decode hex digit pairs up to the end of the bytes-data.
+///
+/// Runs of pairs are decoded in bulk from the line data. Single pairs are only decoded character by character
+/// at the end of a run, to report errors at the exact position.
+///
+/// @param decoder The decoder.
+/// @param bytes The bytes to append the decoded bytes to.
+/// @param isAtEnd A function that tests if the decoder is at the end of the bytes-data.
+/// @param expectMore A function that throws an error if the line ends before the end of the bytes-data.
+///
+template<typename IsAtEndFn, typename ExpectMoreFn>
+void decodeHexBytes(TokenDecoder &decoder, Bytes &bytes, IsAtEndFn isAtEnd, ExpectMoreFn expectMore) {
+    while (true) {
+        expectMore();
+        skipSpacing(decoder);
+        if (isAtEnd()) {
+            break;
+        }
+        expectMore();
+        if (decoder.appendHexDigitPairs(bytes) > 0) {
+            continue;
+        }
+        if (decoder.character() != CharClass::HexDigit) {
+            decoder.throwSyntaxError(u8"Expected first hex digit of a byte, got something else.");
+        }
+        auto value = static_cast<std::byte>(decoder.character().toHexDigitValue()) << 4;
+        decoder.next();
+        expectMore();
+        if (isAtEnd()) {
+            decoder.throwSyntaxError(u8"Expected second hex digit of a byte, not the end of the bytes-data.");
+        }
+        if (decoder.character() != CharClass::HexDigit) {
+            decoder.throwSyntaxError(u8"Expected second hex digit of a byte, got something else.");
+        }
+        value |= static_cast<std::byte>(decoder.character().toHexDigitValue());
+        decoder.next();
+        bytes.push_back(value);
+    }
+}
+
+
+/// Decode base64 groups up to the end of the bytes-data.
+///
+/// Spacing is allowed between groups of four digits. Runs of complete groups are decoded in bulk from the
+/// line data. A group with padding, or with an error, is decoded character by character.
+/// A group with padding must be the last group of the bytes-data, also in multi-line blocks.
+///
+/// @param decoder The decoder.
+/// @param bytes The bytes to append the decoded bytes to.
+/// @param isPaddingFound Set if a group with padding was decoded, and tested for groups after the padding.
+/// @param isAtEnd A function that tests if the decoder is at the end of the bytes-data.
+/// @param expectMore A function that throws an error if the line ends before the end of the bytes-data.
+///
+template<typename IsAtEndFn, typename ExpectMoreFn>
+void decodeBase64Bytes(
+    TokenDecoder &decoder,
+    Bytes &bytes,
+    bool &isPaddingFound,
+    IsAtEndFn isAtEnd,
+    ExpectMoreFn expectMore) {
+
+    while (true) {
+        expectMore();
+        skipSpacing(decoder);
+        if (isAtEnd()) {
+            break;
+        }
+        if (isPaddingFound) {
+            decoder.throwSyntaxError(u8"Unexpected base64 digits after the padding.");
+        }
+        expectMore();
+        if (decoder.appendBase64Groups(bytes) > 0) {
+            continue;
+        }
+        uint32_t group = 0;
+        std::size_t paddingCount = 0;
+        for (std::size_t i = 0; i < 4; ++i) {
+            expectMore();
+            if (i >= 2 && decoder.character() == Char::Equal) {
+                paddingCount += 1;
+            } else if (paddingCount > 0 || decoder.character() != CharClass::Base64Digit) {
+                if (isAtEnd() || decoder.character() == CharClass::Spacing) {
+                    decoder.throwSyntaxError(u8"Expected a complete group of four base64 digits.");
+                }
+                decoder.throwSyntaxError(u8"Expected a base64 digit, got something else.");
+            }
+            group = (group << 6) | decoder.character().toBase64DigitValue();
+            decoder.next();
+        }
+        for (std::size_t i = 0; i < 3 - paddingCount; ++i) {
+            bytes.push_back(static_cast<std::byte>(group >> (16 - i * 8)));
+        }
+        isPaddingFound = paddingCount > 0;
+    }
+}
+
+
+/// Decode bytes-data in the given format.
+///
+template<typename IsAtEndFn, typename ExpectMoreFn>
+void decodeBytes(
+    TokenDecoder &decoder,
+    const BytesFormat format,
+    Bytes &bytes,
+    bool &isPaddingFound,
+    IsAtEndFn isAtEnd,
+    ExpectMoreFn expectMore) {
+
+    if (format == BytesFormat::Base64) {
+        decodeBase64Bytes(decoder, bytes, isPaddingFound, isAtEnd, expectMore);
+    } else {
+        decodeHexBytes(decoder, bytes, isAtEnd, expectMore);
+    }
+}
+
+
+}
+
+
+auto bytesFormatFromIdentifier(TokenDecoder &decoder, const String &formatIdentifier) -> BytesFormat {
+    if (formatIdentifier == u8"hex") {
+        return BytesFormat::Hex;
+    }
+    if (formatIdentifier == u8"base64") {
+        return BytesFormat::Base64;
+    }
+    decoder.throwError(ErrorCategory::Unsupported, u8"Unknown bytes-data format.");
+}
+
 
 auto scanSingleLineFormatIdentifier(TokenDecoder &decoder) -> String {
     auto prefixTransaction = Transaction{decoder};
@@ -34,64 +166,45 @@ auto scanBytes(TokenDecoder &decoder) -> std::optional<LexerToken> {
     decoder.next();
     decoder.expectMoreInLine(u8"Unexpected end in bytes value.");
     // Check for a format identifier after the opening angle bracket.
-    auto formatIdentifier = scanSingleLineFormatIdentifier(decoder);
-    if (formatIdentifier != u8"hex") {
-        decoder.throwError(ErrorCategory::Unsupported, u8"Unknown bytes-data format.");
-    }
-    decoder.expectMoreInLine(u8"Unexpected end in bytes value.");
+    const auto format = bytesFormatFromIdentifier(decoder, scanSingleLineFormatIdentifier(decoder));
     auto bytes = Bytes{};
-    while (decoder.character() != Char::GreaterThan) {
-        decoder.expectMoreInLine(u8"Unexpected end in bytes value.");
-        skipSpacing(decoder);
-        if (decoder.character() == Char::GreaterThan) {
-            break; // Valid end of bytes.
-        }
-        decoder.expectMoreInLine(u8"Unexpected end in bytes value.");
-        if (decoder.character() != CharClass::HexDigit) {
-            decoder.throwSyntaxError(u8"Expected first hex digit of a byte, got something else.");
-        }
-        auto value = static_cast<std::byte>(decoder.character().toHexDigitValue()) << 4;
-        decoder.next();
-        decoder.expectMoreInLine(u8"Unexpected end in bytes value.");
-        if (decoder.character() != CharClass::HexDigit) {
-            decoder.throwSyntaxError(u8"Expected second hex digit of a byte, got something else.");
-        }
-        value |= static_cast<std::byte>(decoder.character().toHexDigitValue());
-        decoder.next();
-        bytes.push_back(value);
-    }
+    bool isPaddingFound = false;
+    decodeBytes(
+        decoder,
+        format,
+        bytes,
+        isPaddingFound,
+        [&decoder]() -> bool { return decoder.character() == Char::GreaterThan; },
+        [&decoder]() { decoder.expectMoreInLine(u8"Unexpected end in bytes value."); });
     decoder.next();
     return decoder.createToken(TokenType::Bytes, std::move(bytes));
 }
 
 
-auto parseMultiLineBytesHexLine(TokenDecoder &decoder) -> TokenGenerator {
+auto parseMultiLineBytesContent(
+    TokenDecoder &decoder,
+    const BytesFormat format,
+    bool &isPaddingFound) -> std::optional<LexerToken> {
+
     // Initial check so we avoid creating a Bytes object.
-    if (!isAtMultiLineEnd(decoder, TokenType::MultiLineBytes)) {
-        Bytes decodedBytes;
-        // Carefully consume the text block by block, so we can skip trailing spacing.
-        while (!isAtMultiLineEnd(decoder, TokenType::MultiLineBytes)) {
-            skipSpacing(decoder);
-            if (isAtMultiLineEnd(decoder, TokenType::MultiLineBytes)) {
-                break;
-            }
-            if (decoder.character() != CharClass::HexDigit) {
-                decoder.throwSyntaxError(u8"Expected first hex digit of a byte, got something else.");
-            }
-            auto value = static_cast<std::byte>(decoder.character().toHexDigitValue()) << 4;
-            decoder.next();
-            if (isAtMultiLineEnd(decoder, TokenType::MultiLineBytes)) {
-                decoder.throwSyntaxError(u8"Expected second hex digit of a byte, not the end of the line.");
-            }
-            if (decoder.character() != CharClass::HexDigit) {
-                decoder.throwSyntaxError(u8"Expected second hex digit of a byte, got something else.");
-            }
-            value |= static_cast<std::byte>(decoder.character().toHexDigitValue());
-            decoder.next();
-            decodedBytes.push_back(value);
-        }
-        EL_YIELD_TOKEN(TokenType::MultiLineBytes, std::move(decodedBytes));
+    if (isAtMultiLineEnd(decoder, TokenType::MultiLineBytes)) {
+        return std::nullopt;
     }
+    Bytes decodedBytes;
+    // Carefully consume the text block by block, so we can skip trailing spacing.
+    decodeBytes(
+        decoder,
+        format,
+        decodedBytes,
+        isPaddingFound,
+        [&decoder]() -> bool { return isAtMultiLineEnd(decoder, TokenType::MultiLineBytes); },
+        []() {});
+    return decoder.createToken(TokenType::MultiLineBytes, std::move(decodedBytes));
+}
+
+
+auto parseMultiLineBytesLine(TokenDecoder &decoder, const BytesFormat format, bool &isPaddingFound) -> TokenGenerator {
+    EL_YIELD_OPTIONAL(parseMultiLineBytesContent(decoder, format, isPaddingFound));
     // Read the end-of-line tokens (may include a comment if at #).
     EL_YIELD_FROM(expectEndOfLine(decoder, ExpectMore::No));
     // Do the check for more data after creating all tokens for the line.
@@ -103,13 +216,13 @@ auto parseMultiLineBytesHexLine(TokenDecoder &decoder) -> TokenGenerator {
 auto expectMultiLineBytes(TokenDecoder &decoder) -> TokenGenerator {
     // expect to be at the character just after the opening angle bracket.
     decoder.expectMore(u8"Unexpected end in bytes value.");
+    auto format = BytesFormat::Hex;
+    bool isPaddingFound = false;
     if (auto formatIdentifier = scanFormatOrLanguageIdentifier(decoder, true); !formatIdentifier.empty()) {
         if (decoder.character() != CharClass::EndOfLineStart) {
             decoder.throwSyntaxError(u8"Unexpected characters in bytes-data format identifier.");
         }
-        if (formatIdentifier != u8"hex") {
-            decoder.throwError(ErrorCategory::Unsupported, u8"Unknown bytes-data format.");
-        }
+        format = bytesFormatFromIdentifier(decoder, formatIdentifier);
         EL_YIELD_TOKEN(TokenType::MultiLineBytesFormat, std::move(formatIdentifier));
     }
     if (decoder.character() != CharClass::EndOfLineStart) {
@@ -125,7 +238,7 @@ auto expectMultiLineBytes(TokenDecoder &decoder) -> TokenGenerator {
             co_yield std::move(closeToken).value();
             co_return;
         }
-        EL_YIELD_FROM(parseMultiLineBytesHexLine(decoder));
+        EL_YIELD_FROM(parseMultiLineBytesLine(decoder, format, isPaddingFound));
         // if the following line starts with spacing, expect the correct indentation pattern.
         if (decoder.character() == CharClass::Spacing) {
             EL_YIELD(expectAndCheckIndentation(decoder));
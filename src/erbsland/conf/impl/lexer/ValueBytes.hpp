@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
@@ -7,6 +7,8 @@
 
 #include "../decoder/TokenDecoder.hpp"
 
+#include <cstdint>
+
 
 namespace erbsland::conf::impl::lexer {
 
@@ -14,6 +16,24 @@ namespace erbsland::conf::impl::lexer {
 // @tested via Lexer tests
 
 
+/// The format of bytes-data.
+///
+enum class BytesFormat : uint8_t {
+    Hex, ///< Pairs of hex digits, the default format.
+    Base64, ///< Groups of four base64 digits.
+};
+
+
+/// Get the format of bytes-data from a format identifier.
+///
+/// @param decoder The decoder.
+/// @param formatIdentifier The lower-case format identifier.
+/// @return The format of the bytes-data.
+/// @throws Error (Unsupported) if the format is unknown.
+///
+[[nodiscard]] auto bytesFormatFromIdentifier(TokenDecoder &decoder, const String &formatIdentifier) -> BytesFormat;
+
+
 /// Scan the character stream for a single-line bytes-value.
 ///
 /// @param decoder The decoder.
@@ -22,6 +42,23 @@ namespace erbsland::conf::impl::lexer {
 [[nodiscard]] auto scanBytes(TokenDecoder &decoder) -> std::optional<LexerToken>;
 
 
+/// Parse the bytes of a single line in a multi-line bytes-data block.
+///
+/// Leaves with the decoder at the trailing spacing, comment or end of the line. In the base64 format,
+/// each line is decoded on its own and must only contain complete groups of four digits.
+///
+/// @param decoder The decoder.
+/// @param format The format of the bytes-data.
+/// @param isPaddingFound The padding state of the block. Must be `false` for the first line. It is set after
+///     a base64 group with padding, and no further groups are accepted in the following lines.
+/// @return A token with the decoded bytes, or nothing if the line contains no bytes.
+///
+[[nodiscard]] auto parseMultiLineBytesContent(
+    TokenDecoder &decoder,
+    BytesFormat format,
+    bool &isPaddingFound) -> std::optional<LexerToken>;
+
+
 /// Expect and read multi-line bytes sequence
 ///
 /// Expects that the opening bracket token was parsed and the decoder is now at the character
@@ -0,0 +1,92 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "CachedSource.hpp"
+
+
+#include "../constants/Defaults.hpp"
+#include "../crypto/ShaHash.hpp"
+
+#include <array>
+#include <fstream>
+#include <span>
+#include <system_error>
+
+
+namespace erbsland::conf::impl {
+
+
+auto CachedSource::copyAssignment(const Assignment &assignment) -> Assignment {
+    return Assignment{
+        assignment.type(),
+        assignment.namePath(),
+        assignment.location(),
+        copyValue(assignment.value())};
+}
+
+
+auto CachedSource::readFileState(const std::filesystem::path &path) noexcept -> std::optional<FileState> {
+    std::error_code errorCode;
+    if (!std::filesystem::is_regular_file(path, errorCode) || errorCode) {
+        return std::nullopt;
+    }
+    FileState result;
+    // Take the read time first, so a modification while the state is read is never considered safe.
+    result.readTime = std::filesystem::file_time_type::clock::now();
+    result.size = std::filesystem::file_size(path, errorCode);
+    if (errorCode) {
+        return std::nullopt;
+    }
+    result.modificationTime = std::filesystem::last_write_time(path, errorCode);
+    if (errorCode) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+
+auto CachedSource::readContentHash(const std::filesystem::path &path) noexcept -> std::optional<Bytes> {
+    try {
+        std::ifstream stream{path, std::ios::binary};
+        if (!stream.is_open()) {
+            return std::nullopt;
+        }
+        crypto::ShaHash hash{defaults::documentHashAlgorithm};
+        std::array<char, 0x4000> buffer{};
+        while (stream.read(buffer.data(), buffer.size()) || stream.gcount() > 0) {
+            hash.update(std::as_bytes(std::span{buffer.data(), static_cast<std::size_t>(stream.gcount())}));
+        }
+        if (stream.bad()) {
+            return std::nullopt;
+        }
+        return hash.digest();
+    } catch (...) {
+        return std::nullopt;
+    }
+}
+
+
+auto CachedSource::copyValue(const ValuePtr &value) -> ValuePtr {
+    if (value == nullptr) {
+        return {};
+    }
+    ValuePtr result;
+    if (value->type() == ValueType::ValueList) {
+        std::vector<ValuePtr> children;
+        children.reserve(value->childrenImpl().size());
+        for (const auto &child : value->childrenImpl()) {
+            children.emplace_back(copyValue(child));
+        }
+        result = Value::createValueList(std::move(children));
+    } else {
+        result = value->deepCopy();
+    }
+    if (!value->nameImpl().empty()) {
+        result->setName(value->nameImpl());
+    }
+    result->setLocation(value->location());
+    return result;
+}
+
+
+}
+
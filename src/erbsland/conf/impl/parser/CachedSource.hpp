@@ -0,0 +1,125 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "../assignment/Assignment.hpp"
+
+#include "../../Bytes.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <vector>
+
+
+namespace erbsland::conf::impl {
+
+
+class CachedSource;
+using CachedSourcePtr = std::shared_ptr<const CachedSource>;
+using AssignmentList = std::vector<Assignment>;
+
+
+/// The size and modification time of a file, to detect changes.
+///
+struct FileState {
+    std::uintmax_t size{0}; ///< The size of the file in bytes.
+    std::filesystem::file_time_type modificationTime; ///< The time of the last modification.
+    std::filesystem::file_time_type readTime; ///< The time when the state was read. Not compared.
+
+    auto operator==(const FileState &other) const noexcept -> bool {
+        return size == other.size && modificationTime == other.modificationTime;
+    }
+
+    /// Test if the file could have been modified after this state was read, without changing its modification time.
+    ///
+    /// This is the case if the modification time is not older than the read time by more than the
+    /// resolution of the file system time stamps.
+    ///
+    [[nodiscard]] auto isModificationTimeAmbiguous() const noexcept -> bool {
+        constexpr auto timeStampResolution = std::chrono::seconds{2}; // The coarsest resolution, used by FAT.
+        return modificationTime + timeStampResolution >= readTime;
+    }
+};
+
+
+/// The assignments of a source that were read by a previous parser run.
+///
+/// The values in the assignments are detached copies, which are never added to a document. Each parser run that
+/// uses a cached source replays copies of these assignments. Therefore, an instance is immutable and can be shared
+/// between threads.
+///
+/// @tested `ParserCacheTest`
+///
+class CachedSource final {
+public:
+    /// Create a new cached source.
+    ///
+    /// @param digest The document digest, calculated by the lexer.
+    /// @param contentHash The hash of all bytes that the lexer read from the source.
+    /// @param assignments The detached assignments of the source.
+    ///
+    CachedSource(Bytes digest, Bytes contentHash, AssignmentList assignments) noexcept
+        : _digest{std::move(digest)}, _contentHash{std::move(contentHash)}, _assignments{std::move(assignments)} {
+    }
+
+    // defaults
+    ~CachedSource() = default;
+
+public:
+    /// The document digest, calculated by the lexer, to verify signatures.
+    ///
+    [[nodiscard]] auto digest() const noexcept -> const Bytes& { return _digest; }
+
+    /// The hash of all bytes that were read from the source, in the format of `readContentHash()`.
+    ///
+    [[nodiscard]] auto contentHash() const noexcept -> const Bytes& { return _contentHash; }
+
+    /// The number of assignments.
+    ///
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return _assignments.size(); }
+
+    /// Create a copy of an assignment that can be added to a new document.
+    ///
+    /// @param index The index of the assignment.
+    ///
+    [[nodiscard]] auto assignment(const std::size_t index) const -> Assignment {
+        return copyAssignment(_assignments[index]);
+    }
+
+public:
+    /// Create a detached copy of an assignment.
+    ///
+    /// The value of the assignment is copied, including the locations of the value and all nested values.
+    ///
+    [[nodiscard]] static auto copyAssignment(const Assignment &assignment) -> Assignment;
+
+    /// Read the size and modification time of a file.
+    ///
+    /// @return The state of the file, or no value if the path is no regular file or there was an error.
+    ///
+    [[nodiscard]] static auto readFileState(const std::filesystem::path &path) noexcept -> std::optional<FileState>;
+
+    /// Read a file and calculate a hash of its content.
+    ///
+    /// @return The hash, or no value if there was an error reading the file.
+    ///
+    [[nodiscard]] static auto readContentHash(const std::filesystem::path &path) noexcept -> std::optional<Bytes>;
+
+private:
+    /// Create a deep copy of a value, including its location.
+    ///
+    [[nodiscard]] static auto copyValue(const ValuePtr &value) -> ValuePtr;
+
+private:
+    Bytes _digest; ///< The document digest, calculated by the lexer.
+    Bytes _contentHash; ///< The hash of all bytes that were read from the source.
+    AssignmentList _assignments; ///< The detached assignments of the source.
+};
+
+
+}
+
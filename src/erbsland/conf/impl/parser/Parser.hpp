@@ -6,11 +6,15 @@
 #include "ParserContext.hpp"
 #include "ParserSettings.hpp"
 
+#include "../utilities/WorkerPool.hpp"
 #include "../value/DocumentBuilder.hpp"
 
+#include "../../ParserCache.hpp"
 #include "../../Position.hpp"
 #include "../../Source.hpp"
 
+#include <memory>
+
 
 namespace erbsland::conf::impl {
 
@@ -24,6 +28,15 @@ namespace erbsland::conf::impl {
 /// About the const reference to `ParserSettings`: an instance of this structure is created as a local variable
 /// in `conf::Parser::parse()`. Therefore, the reference stored here is always valid for the lifetime of this object.
 ///
+/// If parallel includes are enabled, the sources of an `\@include` that resolves to more than one source are read
+/// on a worker pool. Each context reads and decodes its source and keeps the assignments. The parser replays the
+/// assignments in include order, so the document and the reported errors are the same as with sequential parsing.
+/// Access checks, source resolving, signature verification and the document builder stay on the calling thread.
+///
+/// If a cache is set, each file source is looked up in the cache after its access was checked. A cached source
+/// is replayed like a preloaded context, without reading the file. All other file sources record their
+/// assignments and are added to the cache when the parser leaves their context without an error.
+///
 /// @needtest
 ///
 class Parser {
@@ -34,9 +47,14 @@ public:
     :
         _settings{settings} {
 
+        if (_settings.arenaAllocation) {
+            _valueArena = ValueArena::create();
+            _builder.setValueArena(_valueArena);
+        }
         // Prepare the stack with the root context.
         _contextStack.reserve(limits::maxDocumentNesting + 1);
-        _contextStack.emplace_back(ParserContext::create(0, std::move(documentSource)));
+        _contextStack.emplace_back(
+            ParserContext::create(0, std::move(documentSource), _settings.lexerEngine, _valueArena));
     }
 
     ~Parser() = default;
@@ -71,6 +89,10 @@ public:
             document->setLocation(rootLocation);
             return document;
         } catch (const Error&) {
+            // stop reading ahead, before the contexts are closed.
+            if (_workerPool != nullptr) {
+                _workerPool->stop();
+            }
             // close all contexts in case of an error.
             for (const auto &context : std::views::reverse(_contextStack)) {
                 try {
@@ -113,33 +135,63 @@ private:
     void initializeCurrentContext() {
         if (!currentContext().isInitialized()) {
             // before initializing, verify if we are allowed to access the source.
-            if (_settings.accessCheck != nullptr) {
-                const AccessSources sources{
-                    .source = currentContext().sourceIdentifier(),
-                    .parent = currentContext().parentSourceIdentifier(),
-                    .root = !_contextStack.empty() ? _contextStack.front()->sourceIdentifier() : nullptr
-                };
-                auto location = currentContext().includeLocation();
-                if (location.isUndefined()) {
-                    location = Location{currentContext().sourceIdentifier()};
-                }
-                try {
-                    if (_settings.accessCheck->check(sources) != AccessCheckResult::Granted) {
-                        throw Error{
-                            ErrorCategory::Access,
-                            u8"Access denied to source.",
-                            location
-                        };
-                    }
-                } catch (const Error& error) {
-                    throw error.withLocation(location);
-                }
+            // Preloaded contexts were checked before their source was read.
+            if (!currentContext().isPreloaded()) {
+                checkAccess(currentContext());
+                useCache(currentContext());
             }
             // Now as we got access, initialize this context.
             currentContext().initialize();
         }
     }
 
+    /// Verify if the source of a context can be accessed.
+    ///
+    /// @throws Error (Access) if the access is denied.
+    ///
+    void checkAccess(const ParserContext &context) const {
+        if (_settings.accessCheck == nullptr) {
+            return;
+        }
+        const AccessSources sources{
+            .source = context.sourceIdentifier(),
+            .parent = context.parentSourceIdentifier(),
+            .root = !_contextStack.empty() ? _contextStack.front()->sourceIdentifier() : nullptr
+        };
+        auto location = context.includeLocation();
+        if (location.isUndefined()) {
+            location = Location{context.sourceIdentifier()};
+        }
+        try {
+            if (_settings.accessCheck->check(sources) != AccessCheckResult::Granted) {
+                throw Error{
+                    ErrorCategory::Access,
+                    u8"Access denied to source.",
+                    location
+                };
+            }
+        } catch (const Error& error) {
+            throw error.withLocation(location);
+        }
+    }
+
+    /// Look up the source of a context in the cache.
+    ///
+    /// If the source is cached, the context replays the cached assignments. Otherwise, the context records
+    /// its assignments, if the source can be cached.
+    ///
+    void useCache(ParserContext &context) const {
+        if (_settings.cache == nullptr) {
+            return;
+        }
+        auto lookup = _settings.cache->find(*context.sourceIdentifier());
+        if (lookup.source != nullptr) {
+            context.setCachedSource(std::move(lookup.source));
+        } else if (lookup.fileState.has_value()) {
+            context.startRecording(*lookup.fileState);
+        }
+    }
+
     /// Test if there is a next token.
     ///
     [[nodiscard]] auto hasNext() const -> bool {
@@ -208,12 +260,17 @@ private:
                     assignment.location()};
             }
             const auto parentSourceIdentifier = sourceIdentifier();
+            const bool readInParallel = _settings.includeThreadCount > 0 && sourceList->size() > 1;
             for (const auto &source : std::views::reverse(*sourceList)) {
                 addSourceContext(
                     includeLevel,
                     source,
                     parentSourceIdentifier,
-                    assignment.location());
+                    assignment.location(),
+                    readInParallel);
+            }
+            if (readInParallel) {
+                preloadIncludedContexts(sourceList->size());
             }
         }
     }
@@ -222,7 +279,8 @@ private:
         const std::size_t includeLevel,
         const SourcePtr &source,
         const SourceIdentifierPtr &parentSourceIdentifier,
-        const Location &location) {
+        const Location &location,
+        const bool readInParallel) {
 
         for (const auto &context : _contextStack) {
             if (*context->sourceIdentifier() == *source->identifier()) {
@@ -232,12 +290,42 @@ private:
                     location};
             }
         }
-        auto newContext = ParserContext::create(includeLevel, source);
+        // Creating values in an arena is not thread-safe, therefore each preloaded context uses its own arena.
+        auto valueArena = (readInParallel && _valueArena != nullptr) ? ValueArena::create() : _valueArena;
+        auto newContext = ParserContext::create(includeLevel, source, _settings.lexerEngine, std::move(valueArena));
         newContext->setIncludeLocation(location);
         newContext->setParentSourceIdentifier(parentSourceIdentifier);
         _contextStack.emplace_back(std::move(newContext));
     }
 
+    /// Start reading the contexts of included sources on the worker pool.
+    ///
+    /// The access to each source is checked in include order, before the source is read. An access error is
+    /// stored in the context and raised when the parser reaches this context.
+    ///
+    /// @param count The number of new contexts on the top of the stack.
+    ///
+    void preloadIncludedContexts(const std::size_t count) {
+        if (_workerPool == nullptr) {
+            _workerPool = std::make_unique<WorkerPool>(_settings.includeThreadCount);
+        }
+        // The contexts are on the stack in reverse order.
+        for (std::size_t i = 0; i < count; ++i) {
+            auto context = _contextStack[_contextStack.size() - 1 - i];
+            try {
+                checkAccess(*context);
+            } catch (const Error&) {
+                context->setPreloadError(std::current_exception());
+                continue;
+            }
+            useCache(*context);
+            if (context->isCached()) {
+                continue;
+            }
+            context->setPreloadFuture(_workerPool->submit([context]() -> void { context->preload(); }));
+        }
+    }
+
     /// The source identifier for the current context.
     ///
     [[nodiscard]] auto sourceIdentifier() const -> SourceIdentifierPtr {
@@ -296,14 +384,22 @@ private:
         if (_contextStack.empty()) {
             throw std::logic_error{"Called 'leaveContext()` with no context available."};
         }
+        if (currentContext().isRecording()) {
+            _settings.cache->store(
+                *currentContext().sourceIdentifier(),
+                *currentContext().recordedFileState(),
+                currentContext().takeRecordedSource());
+        }
         currentContext().close();
         _contextStack.pop_back();
     }
 
 private:
+    ValueArenaPtr _valueArena; ///< The arena for the document, or `nullptr` to allocate it on the heap.
     DocumentBuilder _builder; ///< The document builder.
     ParserContextStack _contextStack; ///< The context stack.
     const ParserSettings &_settings; ///< The parser settings.
+    std::unique_ptr<WorkerPool> _workerPool; ///< The pool to read included sources, created on first use.
 };
 
 
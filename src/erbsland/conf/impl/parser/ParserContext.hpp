@@ -3,13 +3,20 @@
 #pragma once
 
 
+#include "CachedSource.hpp"
+#include "ParserSettings.hpp"
+
 #include "../assignment/AssignmentStream.hpp"
 #include "../decoder/TokenDecoder.hpp"
 #include "../lexer/Lexer.hpp"
 
 #include "../../Source.hpp"
 
+#include <atomic>
+#include <exception>
+#include <future>
 #include <limits>
+#include <optional>
 #include <stdexcept>
 #include <vector>
 
@@ -24,6 +31,13 @@ using ParserContextStack = std::vector<ParserContextPtr>;
 
 /// Parsing context for a single document source.
 ///
+/// A context either reads the assignments while the parser processes them, or it is *preloaded*: all assignments
+/// are read ahead, usually on a worker thread, and the parser replays them later. A preloaded context reports
+/// errors at the same point of the replay where the sequential parser would report them.
+///
+/// If the parser uses a cache, a context either replays copies of the assignments of a cached source without
+/// opening the source, or it records detached copies of all assignments it returns, to add them to the cache.
+///
 /// @needtest
 ///
 class ParserContext final {
@@ -32,25 +46,42 @@ public:
     ///
     /// @param includeLevel The include level for this source.
     /// @param source Source from which tokens are read.
+    /// @param lexerEngine The engine used to read the tokens and assignments.
+    /// @param valueArena The arena for the values, or `nullptr` to allocate the values on the heap.
     ///
-    explicit ParserContext(const std::size_t includeLevel, SourcePtr source, PrivateTag /*pt*/) noexcept
+    explicit ParserContext(
+        const std::size_t includeLevel,
+        SourcePtr source,
+        const LexerEngine lexerEngine,
+        ValueArenaPtr valueArena,
+        PrivateTag /*pt*/) noexcept
     :
         _includeLevel{static_cast<uint8_t>(includeLevel)},
+        _lexerEngine{lexerEngine},
         _source{std::move(source)},
         _lexer{Lexer::create(CharStream::create(_source))},
         _assignmentStream(AssignmentStream::create(_lexer)) {
         // Include depth is limited by design; keep it small and cheap to copy.
         assert(includeLevel <= static_cast<std::size_t>(std::numeric_limits<uint8_t>::max()));
+        _assignmentStream->setValueArena(std::move(valueArena));
     }
 
     /// Create a new context instance.
     ///
     /// @param includeLevel The include level for this source.
     /// @param source Source from which tokens are read.
+    /// @param lexerEngine The engine used to read the tokens and assignments.
+    /// @param valueArena The arena for the values, or `nullptr` to allocate the values on the heap.
     /// @return Shared-pointer to the new context.
     ///
-    [[nodiscard]] static auto create(const std::size_t includeLevel, SourcePtr source) -> ParserContextPtr {
-        return std::make_shared<ParserContext>(includeLevel, std::move(source), PrivateTag{});
+    [[nodiscard]] static auto create(
+        const std::size_t includeLevel,
+        SourcePtr source,
+        const LexerEngine lexerEngine = LexerEngine::StateMachine,
+        ValueArenaPtr valueArena = {}) -> ParserContextPtr {
+
+        return std::make_shared<ParserContext>(
+            includeLevel, std::move(source), lexerEngine, std::move(valueArena), PrivateTag{});
     }
 
     // defaults
@@ -65,22 +96,51 @@ public:
 
     /// Initialize this context.
     ///
+    /// For a preloaded context, this waits until all assignments were read. If no worker started to read them
+    /// yet, they are read on the calling thread.
+    ///
     void initialize() {
         if (_initialized) {
             throw std::logic_error("ParserContext::initialize() called twice.");
         }
+        if (_isPreloaded) {
+            if (!_preloadClaimed.exchange(true)) {
+                readAllAssignments();
+            } else if (_preloadFuture.valid()) {
+                _preloadFuture.wait();
+            }
+            _initialized = true;
+            if (_preloadedAssignments.empty() && _preloadError != nullptr) {
+                std::rethrow_exception(_preloadError);
+            }
+            return;
+        }
         if (!_source->isOpen()) {
             _source->open();
         }
-        _assignmentGenerator = _assignmentStream->assignments();
-        _assignmentIterator = _assignmentGenerator.begin();
-        _endIterator = _assignmentGenerator.end();
+        if (_lexerEngine == LexerEngine::StateMachine) {
+            // Like the generator, always read one assignment ahead.
+            _hasNextAssignment = _assignmentStream->nextAssignment(_nextAssignment);
+        } else {
+            _assignmentGenerator = _assignmentStream->assignments();
+            _assignmentIterator = _assignmentGenerator.begin();
+            _endIterator = _assignmentGenerator.end();
+        }
         _initialized = true;
     }
 
     /// Check if more assignments are available.
     ///
     [[nodiscard]] auto hasNext() const -> bool {
+        if (_cachedSource != nullptr) {
+            return _preloadIndex < _cachedSource->size();
+        }
+        if (_isPreloaded) {
+            return _preloadIndex < _preloadedAssignments.size();
+        }
+        if (_lexerEngine == LexerEngine::StateMachine) {
+            return _hasNextAssignment;
+        }
         return _assignmentIterator != _endIterator;
     }
 
@@ -89,11 +149,117 @@ public:
     /// @throws Error For any problems while parsing a document.
     ///
     [[nodiscard]] auto nextAssignment() -> Assignment {
+        if (_cachedSource != nullptr) {
+            auto assignment = _cachedSource->assignment(_preloadIndex);
+            _preloadIndex += 1;
+            return assignment;
+        }
+        if (_isPreloaded) {
+            auto assignment = std::move(_preloadedAssignments[_preloadIndex]);
+            _preloadIndex += 1;
+            if (_preloadIndex == _preloadedAssignments.size() && _preloadError != nullptr) {
+                // Like the read-ahead of the stream, the error is raised before the last assignment is returned.
+                std::rethrow_exception(_preloadError);
+            }
+            recordAssignment(assignment);
+            return assignment;
+        }
+        if (_lexerEngine == LexerEngine::StateMachine) {
+            auto assignment = std::move(_nextAssignment);
+            _hasNextAssignment = _assignmentStream->nextAssignment(_nextAssignment);
+            recordAssignment(assignment);
+            return assignment;
+        }
         auto assignment =  *_assignmentIterator;
         ++_assignmentIterator;
+        recordAssignment(assignment);
         return assignment;
     }
 
+    /// Replay the assignments of a cached source, instead of reading the source.
+    ///
+    /// Must be called before the context is initialized.
+    ///
+    /// @param cachedSource The cached source.
+    ///
+    void setCachedSource(CachedSourcePtr cachedSource) noexcept {
+        _cachedSource = std::move(cachedSource);
+        _isPreloaded = true;
+        _preloadClaimed = true;
+    }
+
+    /// Test if this context replays a cached source.
+    ///
+    [[nodiscard]] auto isCached() const noexcept -> bool {
+        return _cachedSource != nullptr;
+    }
+
+    /// Record copies of all assignments, to add them to a cache.
+    ///
+    /// @param fileState The state of the file, before it is read.
+    ///
+    void startRecording(const FileState &fileState) {
+        _recordedFileState = fileState;
+        _lexer->enableContentHash();
+    }
+
+    /// Test if this context records its assignments.
+    ///
+    [[nodiscard]] auto isRecording() const noexcept -> bool {
+        return _recordedFileState.has_value();
+    }
+
+    /// The state of the recorded file, before it was read.
+    ///
+    [[nodiscard]] auto recordedFileState() const noexcept -> const std::optional<FileState>& {
+        return _recordedFileState;
+    }
+
+    /// Create a cached source from the recorded assignments.
+    ///
+    /// Must be called after all assignments were read.
+    ///
+    [[nodiscard]] auto takeRecordedSource() -> CachedSourcePtr {
+        return std::make_shared<const CachedSource>(
+            digest(), _lexer->contentHash(), std::move(_recordedAssignments));
+    }
+
+    /// Test if this context is preloaded.
+    ///
+    [[nodiscard]] auto isPreloaded() const noexcept -> bool {
+        return _isPreloaded;
+    }
+
+    /// Mark this context as preloaded, with the future of the task that reads the assignments.
+    ///
+    /// @param preloadFuture The future of the task that calls `preload()`.
+    ///
+    void setPreloadFuture(std::future<void> preloadFuture) noexcept {
+        _isPreloaded = true;
+        _preloadFuture = std::move(preloadFuture);
+    }
+
+    /// Mark this context as preloaded, with an error that is raised when the context is initialized.
+    ///
+    /// @param error The error, e.g. from the access check.
+    ///
+    void setPreloadError(std::exception_ptr error) noexcept {
+        _isPreloaded = true;
+        _preloadClaimed = true;
+        _preloadError = std::move(error);
+    }
+
+    /// Read all assignments of this context, and close the source.
+    ///
+    /// This method is called from a worker thread. It does nothing if the assignments are already read
+    /// by another thread. Errors are stored and raised when the assignments are replayed.
+    ///
+    void preload() noexcept {
+        if (!_preloadClaimed.exchange(true)) {
+            readAllAssignments();
+        }
+    }
+
     /// Set the signature text for this context.
     ///
     void setSignatureText(String signatureText) {
@@ -109,6 +275,9 @@ public:
     /// Get the document digest produced by the lexer.
     ///
     [[nodiscard]] auto digest() const -> Bytes {
+        if (_cachedSource != nullptr) {
+            return _cachedSource->digest();
+        }
         return _lexer->digest();
     }
 
@@ -156,6 +325,11 @@ public:
         _endIterator = {};
         _assignmentIterator = {};
         _assignmentGenerator = {};
+        _hasNextAssignment = false;
+        _preloadedAssignments = {};
+        _cachedSource = {};
+        _recordedAssignments = {};
+        _assignmentStream = {};
         _lexer = {};
         if (_source->isOpen()) {
             _source->close();
@@ -163,9 +337,43 @@ public:
         _source = {};
     }
 
+private:
+    /// Record a detached copy of an assignment, if this context records its assignments.
+    ///
+    void recordAssignment(const Assignment &assignment) {
+        if (_recordedFileState.has_value()) {
+            _recordedAssignments.emplace_back(CachedSource::copyAssignment(assignment));
+        }
+    }
+
+    /// Read all assignments into `_preloadedAssignments` and close the source.
+    ///
+    void readAllAssignments() noexcept {
+        try {
+            if (!_source->isOpen()) {
+                _source->open();
+            }
+            if (_lexerEngine == LexerEngine::StateMachine) {
+                Assignment assignment;
+                while (_assignmentStream->nextAssignment(assignment)) {
+                    _preloadedAssignments.emplace_back(std::move(assignment));
+                }
+            } else {
+                for (const auto &assignment : _assignmentStream->assignments()) {
+                    _preloadedAssignments.emplace_back(assignment);
+                }
+            }
+        } catch (...) {
+            _preloadError = std::current_exception();
+        }
+        // Close the source early, so hundreds of included sources do not stay open until they are replayed.
+        _source->close();
+    }
+
 private:
     bool _initialized = false; ///< Flag indicating if the context has been initialized.
     uint8_t _includeLevel; ///< The include level for this context.
+    LexerEngine _lexerEngine; ///< The engine used to read the tokens and assignments.
     SourcePtr _source; ///< The source for this context, as reference to detect inclusion loops.
     SourceIdentifierPtr _parentSourceIdentifier; ///< The identifier of the parent source.
     Location _includeLocation; ///< The location of the include directive.
@@ -174,7 +382,18 @@ private:
     AssignmentGenerator _assignmentGenerator; ///< The assignment generator.
     AssignmentGenerator::iterator _assignmentIterator; ///< The assignment iterator.
     AssignmentGenerator::iterator _endIterator; ///< The end iterator.
+    Assignment _nextAssignment; ///< The next assignment, read ahead using the state machine.
+    bool _hasNextAssignment{false}; ///< If `_nextAssignment` contains an assignment.
     String _signatureText; ///< The signature text, if any.
+    bool _isPreloaded{false}; ///< If the assignments of this context are read ahead.
+    std::atomic<bool> _preloadClaimed{false}; ///< Set by the thread that reads the assignments ahead.
+    std::future<void> _preloadFuture; ///< The future of the task that reads the assignments ahead.
+    std::vector<Assignment> _preloadedAssignments; ///< The assignments that were read ahead.
+    std::size_t _preloadIndex{0}; ///< The index of the next preloaded assignment.
+    std::exception_ptr _preloadError; ///< The error that stopped reading ahead.
+    CachedSourcePtr _cachedSource; ///< The cached source that is replayed, or `nullptr`.
+    std::optional<FileState> _recordedFileState; ///< The state of the recorded file, if assignments are recorded.
+    AssignmentList _recordedAssignments; ///< The recorded copies of the assignments.
 };
 
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
@@ -8,10 +8,33 @@
 #include "../../FileSourceResolver.hpp"
 #include "../../SignatureValidator.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+
+namespace erbsland::conf {
+class ParserCache;
+using ParserCachePtr = std::shared_ptr<ParserCache>;
+}
+
 
 namespace erbsland::conf::impl {
 
 
+/// The engine used to read the tokens and assignments of a document.
+///
+enum class LexerEngine : uint8_t {
+    /// A state machine that moves tokens and assignments into reusable slots, without coroutines.
+    StateMachine,
+    /// The coroutine generators `Lexer::tokens()` and `AssignmentStream::assignments()`.
+    ///
+    /// This is the reference implementation for the state machine.
+    ///
+    Generator,
+};
+
+
 /// Internal settings of the parser.
 ///
 /// @needtest
@@ -36,6 +59,26 @@ struct ParserSettings {
     /// If set, all documents, even these without `\@signature` must be checked by this object.
     ///
     SignatureValidatorPtr signatureValidator;
+
+    /// The engine used to read the tokens and assignments.
+    ///
+    LexerEngine lexerEngine = LexerEngine::StateMachine;
+
+    /// If all values of the document are allocated in a `ValueArena`.
+    ///
+    bool arenaAllocation = false;
+
+    /// The number of worker threads to read included sources in parallel.
+    ///
+    /// If zero, all sources are read sequentially.
+    ///
+    std::size_t includeThreadCount = 0;
+
+    /// The cache for the assignments of parsed files.
+    ///
+    /// If `nullptr`, all sources are parsed.
+    ///
+    ParserCachePtr cache;
 };
 
 
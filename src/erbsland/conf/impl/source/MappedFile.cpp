@@ -0,0 +1,138 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "MappedFile.hpp"
+
+
+#include "../../Error.hpp"
+
+#include <cerrno>
+#include <system_error>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+
+namespace erbsland::conf::impl {
+
+
+namespace {
+
+
+[[noreturn]] void throwMapError(const std::error_code &errorCode, const Location &location) {
+    throw Error(
+        ErrorCategory::IO,
+        String(u8"Failed to map file. Error: ") + String{errorCode.message()}.toEscaped(EscapeMode::ErrorText),
+        location);
+}
+
+
+}
+
+
+#if defined(_WIN32)
+
+
+void MappedFile::map(
+    const std::filesystem::path &canonicalPath,
+    const std::size_t fileSize,
+    const Location &location) {
+
+    unmap();
+    auto toErrorCode = [](const DWORD errorCode) {
+        return std::error_code{static_cast<int>(errorCode), std::system_category()};
+    };
+    const auto fileHandle = ::CreateFileW(
+        canonicalPath.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        throwMapError(toErrorCode(::GetLastError()), location);
+    }
+    const auto mappingHandle = ::CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle == nullptr) {
+        const auto errorCode = ::GetLastError();
+        ::CloseHandle(fileHandle);
+        throwMapError(toErrorCode(errorCode), location);
+    }
+    const auto address = ::MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, fileSize);
+    const auto errorCode = ::GetLastError();
+    // The view keeps a reference to the mapping, so both handles can be closed right away.
+    ::CloseHandle(mappingHandle);
+    ::CloseHandle(fileHandle);
+    if (address == nullptr) {
+        throwMapError(toErrorCode(errorCode), location);
+    }
+    _data = static_cast<const std::byte*>(address);
+    _size = fileSize;
+}
+
+
+void MappedFile::unmap() noexcept {
+    if (_data != nullptr) {
+        ::UnmapViewOfFile(_data);
+    }
+    _data = nullptr;
+    _size = 0;
+}
+
+
+#else
+
+
+void MappedFile::map(
+    const std::filesystem::path &canonicalPath,
+    const std::size_t fileSize,
+    const Location &location) {
+
+    unmap();
+    const auto fileDescriptor = ::open(canonicalPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0) {
+        throwMapError(std::error_code{errno, std::system_category()}, location);
+    }
+    int mapFlags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    // The whole file is read, so pre-faulting the pages is faster than faulting them in one by one.
+    mapFlags |= MAP_POPULATE;
+#endif
+    const auto address = ::mmap(nullptr, fileSize, PROT_READ, mapFlags, fileDescriptor, 0);
+    const auto errorCode = errno;
+    // The mapping keeps a reference to the file, so the descriptor can be closed right away.
+    ::close(fileDescriptor);
+    if (address == MAP_FAILED) {
+        throwMapError(std::error_code{errorCode, std::system_category()}, location);
+    }
+    ::posix_madvise(address, fileSize, POSIX_MADV_SEQUENTIAL);
+    _data = static_cast<const std::byte*>(address);
+    _size = fileSize;
+}
+
+
+void MappedFile::unmap() noexcept {
+    if (_data != nullptr) {
+        ::munmap(const_cast<std::byte*>(_data), _size);
+    }
+    _data = nullptr;
+    _size = 0;
+}
+
+
+#endif
+
+
+}
+
@@ -0,0 +1,78 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "../../Location.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+
+namespace erbsland::conf::impl {
+
+
+/// A read-only mapping of a whole file into the address space of the process.
+///
+/// The mapping is released when `unmap()` is called or the object is destroyed.
+///
+/// @tested `MappedFileSourceTest`, `DocumentSnapshotTest`
+///
+class MappedFile final {
+public:
+    MappedFile() = default;
+
+    /// Releases the mapping.
+    ///
+    ~MappedFile() { unmap(); }
+
+    // disable copy and move
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    auto operator=(const MappedFile&) -> MappedFile& = delete;
+    auto operator=(MappedFile&&) -> MappedFile& = delete;
+
+public:
+    /// Map a file.
+    ///
+    /// Releases any previous mapping first. The mapping is prepared for reading the data once from start to end.
+    ///
+    /// @param canonicalPath The canonical path of the file.
+    /// @param fileSize The size of the file in bytes. Must not be zero.
+    /// @param location The location used for errors.
+    /// @throws Error (IO) If the file can't be mapped.
+    ///
+    void map(
+        const std::filesystem::path &canonicalPath,
+        std::size_t fileSize,
+        const Location &location);
+
+    /// Release the mapping.
+    ///
+    void unmap() noexcept;
+
+    /// Test if a file is mapped.
+    ///
+    [[nodiscard]] auto isMapped() const noexcept -> bool { return _data != nullptr; }
+
+    /// The start of the mapped data, or `nullptr`.
+    ///
+    [[nodiscard]] auto data() const noexcept -> const std::byte* { return _data; }
+
+    /// The size of the mapped data.
+    ///
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return _size; }
+
+    /// The mapped data as span.
+    ///
+    [[nodiscard]] auto bytes() const noexcept -> std::span<const std::byte> { return {_data, _size}; }
+
+private:
+    const std::byte *_data{nullptr}; ///< The start of the mapped file data.
+    std::size_t _size{0}; ///< The size of the mapped data.
+};
+
+
+}
+
@@ -0,0 +1,155 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "MappedFileSource.hpp"
+
+
+#include "../constants/Limits.hpp"
+#include "../utf8/U8Format.hpp"
+
+#include "../../Error.hpp"
+
+#include <algorithm>
+#include <utility>
+
+
+namespace erbsland::conf::impl {
+
+
+using namespace std::filesystem;
+
+
+MappedFileSource::MappedFileSource(std::filesystem::path path)
+:
+    _path{std::move(path)},
+    _identifier{SourceIdentifier::createForFile(
+        String{absolute(_path).lexically_normal().string()})} {
+}
+
+
+auto MappedFileSource::identifier() const noexcept -> SourceIdentifierPtr {
+    return _identifier;
+}
+
+
+void MappedFileSource::open() {
+    if (isOpen()) {
+        throw Error(ErrorCategory::Internal, u8"The source is already open.", Location{_identifier});
+    }
+    std::filesystem::path canonicalPath;
+    std::uintmax_t fileSize = 0;
+    try {
+        canonicalPath = canonical(_path);
+        if (!is_regular_file(canonicalPath)) {
+            throw Error(
+                ErrorCategory::IO,
+                u8"The source path is no regular file.",
+                Location{_identifier},
+                canonicalPath);
+        }
+        fileSize = file_size(canonicalPath);
+    } catch (const filesystem_error &error) {
+        throw Error(
+            ErrorCategory::IO,
+            String(u8"File not found. Error: ") + String{error.code().message()}.toEscaped(EscapeMode::ErrorText),
+            Location{_identifier});
+    }
+    if (fileSize > limits::maxDocumentSize) {
+        throw Error(
+            ErrorCategory::LimitExceeded,
+            u8format("The document exceeds the maximum size of {} bytes.", limits::maxDocumentSize),
+            Location{_identifier});
+    }
+    // An empty file can't be mapped, and there is nothing to read anyway.
+    if (fileSize > 0) {
+        _mappedFile.map(canonicalPath, static_cast<std::size_t>(fileSize), Location{_identifier});
+    }
+    _readOffset = 0;
+    _sourceIsAtEnd = false;
+    _sourceIsOpen = true;
+}
+
+
+auto MappedFileSource::isOpen() const noexcept -> bool {
+    return _sourceIsOpen;
+}
+
+
+auto MappedFileSource::atEnd() const noexcept -> bool {
+    return _sourceIsAtEnd;
+}
+
+
+auto MappedFileSource::readLine(std::span<std::byte> lineBuffer) -> std::size_t {
+    if (_sourceIsAtEnd) {
+        return 0;
+    }
+    if (lineBuffer.size() < limits::maxLineLength) {
+        throw Error(
+            ErrorCategory::LimitExceeded,
+            u8format("Line buffer too small. Need at least {} bytes.", limits::maxLineLength));
+    }
+    const auto line = readLineView();
+    std::ranges::copy(line, lineBuffer.begin());
+    return line.size();
+}
+
+
+auto MappedFileSource::supportsLineViews() const noexcept -> bool {
+    return true;
+}
+
+
+auto MappedFileSource::readLineView() -> std::span<const std::byte> {
+    if (!_sourceIsOpen) {
+        throwSourceNotOpen();
+    }
+    if (_sourceIsAtEnd) {
+        return {};
+    }
+    const auto remaining = _mappedFile.bytes().subspan(_readOffset);
+    // Only search as far as a valid line can reach, so an overlong line is detected without a full scan.
+    const auto searchSize = std::min(remaining.size(), limits::maxLineLength);
+    const auto newlineIt = std::ranges::find(remaining.first(searchSize), std::byte{'\n'});
+    std::size_t lineLength = 0;
+    if (newlineIt != remaining.begin() + static_cast<std::ptrdiff_t>(searchSize)) {
+        lineLength = static_cast<std::size_t>(newlineIt - remaining.begin()) + 1U; // Include the newline.
+    } else if (remaining.size() <= limits::maxLineLength) {
+        lineLength = remaining.size(); // The last line without a newline.
+    } else {
+        throwLineLengthExceeded();
+    }
+    _readOffset += lineLength;
+    if (_readOffset >= _mappedFile.size()) {
+        // Keep the mapping, as the returned view must stay valid until the source is closed.
+        _sourceIsAtEnd = true;
+    }
+    return remaining.first(lineLength);
+}
+
+
+void MappedFileSource::close() noexcept {
+    _mappedFile.unmap();
+    _readOffset = 0;
+    _sourceIsOpen = false;
+}
+
+
+void MappedFileSource::throwLineLengthExceeded() {
+    close(); // Like the stream source, an invalid line closes the source.
+    throw Error(
+        ErrorCategory::LimitExceeded,
+        u8format("The line exceeds the maximum size of {} bytes.", limits::maxLineLength),
+        Location{_identifier});
+}
+
+
+void MappedFileSource::throwSourceNotOpen() {
+    throw Error(
+        ErrorCategory::IO,
+        u8"You cannot read from a closed source.",
+        Location{_identifier});
+}
+
+
+}
+
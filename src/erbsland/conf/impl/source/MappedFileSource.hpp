@@ -0,0 +1,73 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "MappedFile.hpp"
+
+#include "../../Source.hpp"
+
+#include <filesystem>
+
+
+namespace erbsland::conf::impl {
+
+
+/// A file source that maps the whole file into memory.
+///
+/// Instead of copying the data through a stream buffer, this source maps the file into the address space
+/// of the process and returns views to the lines in the mapping. The mapping is released when the source is
+/// closed or destroyed, therefore all views returned by `readLineView()` stay valid until then.
+///
+/// @tested `MappedFileSourceTest`
+///
+class MappedFileSource final : public Source {
+public:
+    /// Create a new memory-mapped file source.
+    ///
+    explicit MappedFileSource(std::filesystem::path path);
+
+    /// Releases the mapping, if the source is still open.
+    ///
+    ~MappedFileSource() override = default;
+
+    // disable copy and move
+    MappedFileSource(const MappedFileSource&) = delete;
+    MappedFileSource(MappedFileSource&&) = delete;
+    auto operator=(const MappedFileSource&) -> MappedFileSource& = delete;
+    auto operator=(MappedFileSource&&) -> MappedFileSource& = delete;
+
+public: // Implement source.
+    [[nodiscard]] auto identifier() const noexcept -> SourceIdentifierPtr override;
+    void open() override;
+    [[nodiscard]] auto isOpen() const noexcept -> bool override;
+    [[nodiscard]] auto atEnd() const noexcept -> bool override;
+    [[nodiscard]] auto readLine(std::span<std::byte> lineBuffer) -> std::size_t override;
+    [[nodiscard]] auto supportsLineViews() const noexcept -> bool override;
+    [[nodiscard]] auto readLineView() -> std::span<const std::byte> override;
+    void close() noexcept override;
+
+public: // Access the underlying path.
+    [[nodiscard]] auto filesystemPath() const noexcept -> const std::filesystem::path& { return _path; }
+
+private:
+    /// Throw if the line length was exceeded.
+    ///
+    void throwLineLengthExceeded();
+
+    /// Throw when tried to read if the source is closed.
+    ///
+    void throwSourceNotOpen();
+
+private:
+    std::filesystem::path _path; ///< The path from where this source reads its data.
+    SourceIdentifierPtr _identifier; ///< The identifier `file:<path>` for this source.
+    MappedFile _mappedFile; ///< The mapped file data.
+    std::size_t _readOffset{0}; ///< The offset for the next read operation.
+    bool _sourceIsOpen{false}; ///< If this source is open.
+    bool _sourceIsAtEnd{false}; ///< If this source is at the end.
+};
+
+
+}
+
@@ -0,0 +1,80 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "WorkerPool.hpp"
+
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+
+namespace erbsland::conf::impl {
+
+
+WorkerPool::WorkerPool(const std::size_t threadCount) {
+    const auto count = std::max<std::size_t>(threadCount, 1U);
+    _threads.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        _threads.emplace_back([this]() -> void { run(); });
+    }
+}
+
+
+WorkerPool::~WorkerPool() {
+    stop();
+}
+
+
+auto WorkerPool::submit(std::function<void()> task) -> std::future<void> {
+    std::packaged_task<void()> packagedTask{std::move(task)};
+    auto future = packagedTask.get_future();
+    {
+        const std::lock_guard lock{_mutex};
+        if (_stopped) {
+            throw std::logic_error{"WorkerPool::submit() called after the pool was stopped."};
+        }
+        _tasks.emplace_back(std::move(packagedTask));
+    }
+    _condition.notify_one();
+    return future;
+}
+
+
+void WorkerPool::stop() noexcept {
+    std::deque<std::packaged_task<void()>> discardedTasks;
+    {
+        const std::lock_guard lock{_mutex};
+        if (_stopped) {
+            return;
+        }
+        _stopped = true;
+        discardedTasks.swap(_tasks);
+    }
+    _condition.notify_all();
+    for (auto &thread : _threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+
+void WorkerPool::run() {
+    while (true) {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock lock{_mutex};
+            _condition.wait(lock, [this]() -> bool { return _stopped || !_tasks.empty(); });
+            if (_stopped) {
+                return;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+        task(); // Exceptions are stored in the future of the task.
+    }
+}
+
+
+}
+
@@ -0,0 +1,81 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace erbsland::conf::impl {
+
+
+/// A minimal pool of worker threads that run tasks in the order they were submitted.
+///
+/// The threads are started when the pool is created and joined when the pool is stopped or destroyed.
+/// Tasks that did not start before the pool is stopped are discarded, and their futures report a broken promise.
+///
+/// *Multithreading*: All methods must be called from the thread that owns the pool.
+///
+/// @tested `WorkerPoolTest`
+///
+class WorkerPool final {
+public:
+    /// Create a new worker pool.
+    ///
+    /// @param threadCount The number of worker threads. At least one thread is created.
+    ///
+    explicit WorkerPool(std::size_t threadCount);
+
+    /// Stop the pool and join all worker threads.
+    ///
+    ~WorkerPool();
+
+    // disable copy and assign.
+    WorkerPool(const WorkerPool &) = delete;
+    auto operator=(const WorkerPool &) -> WorkerPool& = delete;
+    WorkerPool(WorkerPool &&) = delete;
+    auto operator=(WorkerPool &&) -> WorkerPool& = delete;
+
+public:
+    /// Add a task to the queue.
+    ///
+    /// @param task The task to run on one of the worker threads.
+    /// @return A future that is ready when the task finished.
+    ///
+    auto submit(std::function<void()> task) -> std::future<void>;
+
+    /// Discard all queued tasks and join the worker threads.
+    ///
+    /// Tasks that are already running are completed before this method returns.
+    ///
+    void stop() noexcept;
+
+    /// The number of worker threads.
+    ///
+    [[nodiscard]] auto threadCount() const noexcept -> std::size_t {
+        return _threads.size();
+    }
+
+private:
+    /// The main loop of each worker thread.
+    ///
+    void run();
+
+private:
+    std::mutex _mutex; ///< The mutex to protect the queue and the stop flag.
+    std::condition_variable _condition; ///< Signals new tasks or the stop of the pool.
+    std::deque<std::packaged_task<void()>> _tasks; ///< The queued tasks.
+    bool _stopped{false}; ///< If the pool was stopped.
+    std::vector<std::thread> _threads; ///< The worker threads.
+};
+
+
+}
+
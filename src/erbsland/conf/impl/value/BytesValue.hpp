@@ -24,6 +24,7 @@ public:
     [[nodiscard]] auto type() const noexcept -> ValueType override { return ValueType::Bytes; }
     [[nodiscard]] auto asBytes() const noexcept -> Bytes override { return _value; }
     [[nodiscard]] auto asBytesOrThrow() const -> Bytes override { return _value; }
+    [[nodiscard]] auto bytesView() const noexcept -> std::span<const std::byte> override { return _value.raw(); }
     [[nodiscard]] auto toTextRepresentation() const noexcept -> String override;
     [[nodiscard]] auto deepCopy() const -> ValuePtr override { return std::make_shared<BytesValue>(_value); }
     [[nodiscard]] auto rawStorage() const noexcept -> const Bytes& { return _value; }
@@ -0,0 +1,94 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "ContentHash.hpp"
+
+
+#include "BytesValue.hpp"
+#include "ValueWithConvertibleType.hpp"
+#include "ValueWithNativeType.hpp"
+
+#include <bit>
+#include <cmath>
+#include <limits>
+
+
+namespace erbsland::conf::impl {
+
+
+auto ContentHash::get(
+    const conf::Value &value,
+    const Name &name,
+    const std::vector<ValuePtr> &children,
+    const uint64_t generation) const noexcept -> uint64_t {
+
+    if (_generation.load(std::memory_order_acquire) == generation) {
+        return _hash.load(std::memory_order_relaxed);
+    }
+    // All threads calculate the same hash for the same generation, so concurrent updates are harmless.
+    const auto hash = calculate(value, name, children, generation);
+    _hash.store(hash, std::memory_order_relaxed);
+    _generation.store(generation, std::memory_order_release);
+    return hash;
+}
+
+
+auto ContentHash::calculate(
+    const conf::Value &value,
+    const Name &name,
+    const std::vector<ValuePtr> &children,
+    const uint64_t generation) noexcept -> uint64_t {
+
+    const auto type = value.type();
+    auto result = mix(static_cast<uint64_t>(type.raw()) + 1U);
+    result = mix(result ^ static_cast<uint64_t>(name.hash()));
+    if (type.isScalar()) {
+        return mix(result ^ scalarHash(value));
+    }
+    if (type.isMap()) {
+        // The children of a section are matched by name, so their order must not change the hash.
+        uint64_t childrenHash = 0;
+        for (const auto &child : children) {
+            childrenHash += mix(child->contentHashFor(generation));
+        }
+        return mix(result ^ childrenHash ^ children.size());
+    }
+    for (const auto &child : children) {
+        result = mix(result ^ child->contentHashFor(generation));
+    }
+    return mix(result ^ children.size());
+}
+
+
+auto ContentHash::scalarHash(const conf::Value &value) noexcept -> uint64_t {
+    // All scalar values in a value tree are implementation values.
+    switch (value.type()) {
+    case ValueType::Integer:
+        return static_cast<uint64_t>(static_cast<const IntegerValue&>(value).rawStorage());
+    case ValueType::Boolean:
+        return static_cast<const BooleanValue&>(value).rawStorage() ? 1U : 0U;
+    case ValueType::Float: {
+        auto number = static_cast<const FloatValue&>(value).rawStorage();
+        if (std::isnan(number)) {
+            number = std::numeric_limits<Float>::quiet_NaN();
+        } else if (number == 0.0) {
+            number = 0.0; // -0.0 equals 0.0
+        }
+        return std::bit_cast<uint64_t>(number);
+    }
+    case ValueType::Text:
+        return std::hash<String>{}(static_cast<const TextValue&>(value).rawStorage());
+    case ValueType::Bytes:
+        return std::hash<Bytes>{}(static_cast<const BytesValue&>(value).rawStorage());
+    case ValueType::RegEx: {
+        const auto &regEx = static_cast<const RegExValue&>(value).rawStorage();
+        return std::hash<String>{}(regEx.toText()) ^ (regEx.isMultiLine() ? 1U : 0U);
+    }
+    default:
+        // Dates, times, date-times and time-deltas are compared by their text representation.
+        return std::hash<String>{}(value.toTextRepresentation());
+    }
+}
+
+
+}
+
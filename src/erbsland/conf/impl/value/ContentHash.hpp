@@ -0,0 +1,92 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "ValueTreeGeneration.hpp"
+
+#include "../../Name.hpp"
+#include "../../Value.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+namespace erbsland::conf::impl {
+
+
+class Value;
+using ValuePtr = std::shared_ptr<Value>;
+
+
+/// A lazily calculated hash of the type, name and content of a value, including all its children.
+///
+/// The hash is calculated on the first call of `get()` and kept until the value tree is modified, which is detected
+/// using the `ValueTreeGeneration` of the tree. Container values combine the cached hashes of their children: the children of
+/// sections are combined independent of their order, the elements of lists in order.
+///
+/// Values that are equal, as compared by `DocumentDiff`, have equal hashes. Locations, validation rules and
+/// default-value flags are not part of the hash.
+///
+/// *Multithreading*: `get()` can be called from multiple threads at the same time, as long as the value tree is not
+/// modified.
+///
+/// @tested `ValueContentHashTest`
+///
+class ContentHash final {
+public:
+    ContentHash() = default;
+    ~ContentHash() = default;
+
+    // prevent copy and assign.
+    ContentHash(const ContentHash&) = delete;
+    auto operator=(const ContentHash&) -> ContentHash& = delete;
+
+public:
+    /// Get the cached hash or calculate it.
+    ///
+    /// @param value The value, which owns this cache.
+    /// @param name The name of the value.
+    /// @param children The children of the value.
+    /// @param generation The current generation of the value tree.
+    /// @return The content hash.
+    ///
+    [[nodiscard]] auto get(
+        const conf::Value &value,
+        const Name &name,
+        const std::vector<ValuePtr> &children,
+        uint64_t generation) const noexcept -> uint64_t;
+
+    /// Calculate the hash for a value.
+    ///
+    /// Uses the cached hashes of the children.
+    ///
+    [[nodiscard]] static auto calculate(
+        const conf::Value &value,
+        const Name &name,
+        const std::vector<ValuePtr> &children,
+        uint64_t generation) noexcept -> uint64_t;
+
+private:
+    /// Calculate the hash for the content of a scalar value.
+    [[nodiscard]] static auto scalarHash(const conf::Value &value) noexcept -> uint64_t;
+    /// Mix the bits of a hash, to combine the hashes of children.
+    [[nodiscard]] static constexpr auto mix(uint64_t hash) noexcept -> uint64_t {
+        hash ^= hash >> 30U;
+        hash *= 0xbf58476d1ce4e5b9ULL;
+        hash ^= hash >> 27U;
+        hash *= 0x94d049bb133111ebULL;
+        hash ^= hash >> 31U;
+        return hash;
+    }
+
+private:
+    mutable std::atomic<uint64_t> _hash{0}; ///< The cached hash.
+    mutable std::atomic<uint64_t> _generation{0}; ///< The tree generation of the cached hash, or zero.
+};
+
+
+}
+
@@ -34,6 +34,11 @@ auto Document::parent() const noexcept -> conf::ValuePtr {
 }
 
 
+auto Document::contentHash() const noexcept -> uint64_t {
+    return _contentHash.get(*this, Name::emptyInstance(), _children.valueList(), _treeGeneration.current());
+}
+
+
 auto Document::type() const noexcept -> ValueType {
     return ValueType::Document;
 }
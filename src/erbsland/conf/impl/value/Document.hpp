@@ -4,6 +4,7 @@
 
 
 #include "Container.hpp"
+#include "ContentHash.hpp"
 #include "ValueMap.hpp"
 
 #include "../utf8/U8Format.hpp"
@@ -25,6 +26,7 @@ public: // implement Value
     [[nodiscard]] auto namePath() const noexcept -> NamePath override;
     [[nodiscard]] auto hasParent() const noexcept -> bool override;
     [[nodiscard]] auto parent() const noexcept -> conf::ValuePtr override;
+    [[nodiscard]] auto contentHash() const noexcept -> uint64_t override;
     [[nodiscard]] auto type() const noexcept -> ValueType override;
     [[nodiscard]] auto hasLocation() const noexcept -> bool override;
     [[nodiscard]] auto location() const noexcept -> Location override;
@@ -49,6 +51,10 @@ public: // implement Value
     [[nodiscard]] auto asTimeDelta() const noexcept -> TimeDelta override;
     [[nodiscard]] auto asRegEx() const noexcept -> RegEx override;
     [[nodiscard]] auto asValueList() const noexcept -> conf::ValueList override;
+    [[nodiscard]] auto nameRef() const noexcept -> const Name& override { return Name::emptyInstance(); }
+    [[nodiscard]] auto locationRef() const noexcept -> const Location& override { return _location; }
+    [[nodiscard]] auto textView() const noexcept -> std::u8string_view override { return {}; }
+    [[nodiscard]] auto bytesView() const noexcept -> std::span<const std::byte> override { return {}; }
     [[nodiscard]] auto asIntegerOrThrow() const -> Integer override;
     [[nodiscard]] auto asBooleanOrThrow() const -> bool override;
     [[nodiscard]] auto asFloatOrThrow() const -> Float override;
@@ -74,11 +80,19 @@ public: // implementation API
     void setValidationRule(RulePtr rule) noexcept;
     /// Remove default values from direct children.
     void removeDefaultValues();
+    /// Fast access to all child-values.
+    [[nodiscard]] auto childrenImpl() const noexcept -> const std::vector<ValuePtr>& { return _children.valueList(); }
+    /// Fast name-based access for child-values.
+    [[nodiscard]] auto valueImpl(const Name &name) const noexcept -> ValuePtr { return _children.valueImpl(name); }
+    /// Access the generation of the value tree of this document.
+    [[nodiscard]] auto treeGeneration() const noexcept -> ValueTreeGeneration& { return _treeGeneration; }
 
 private:
     Location _location; ///< The location of the document.
     ValueMap _children; ///< The map with the child values.
     RulePtr _rule; ///< The validation rule that was used when this value was validated.
+    ContentHash _contentHash; ///< The cached content hash.
+    mutable ValueTreeGeneration _treeGeneration; ///< The generation of the value tree of this document.
 };
 
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #include "DocumentBuilder.hpp"
 
@@ -7,6 +7,7 @@
 #include "Value.hpp"
 
 #include <stdexcept>
+#include <utility>
 
 
 namespace erbsland::conf::impl {
@@ -50,7 +51,7 @@ void DocumentBuilder::addSectionMap(const NamePathLike &namePathLike, const Loca
         value->setLocation(location); // update its location.
     } else {
         // there is no existing element
-        value = Value::createSectionWithNames();
+        value = Value::createSectionWithNames(_storage.valueArena());
         value->setName(namePath.back());
         _storage.addChildValue(parentValue, namePath, location, value);
     }
@@ -96,15 +97,15 @@ void DocumentBuilder::addSectionList(const NamePathLike &namePathLike, const Loc
         }
         // Add a new element to the existing section list.
         parentValue = value;
-        value = Value::createSectionWithNames();
+        value = Value::createSectionWithNames(_storage.valueArena());
         _storage.addChildValue(parentValue, namePath, location, value);
     } else {
         // there is no existing element, create a new list with one element.
-        value = Value::createSectionList();
+        value = Value::createSectionList(_storage.valueArena());
         value->setName(namePath.back());
         _storage.addChildValue(parentValue, namePath, location, value);
         parentValue = value;
-        value = Value::createSectionWithNames();
+        value = Value::createSectionWithNames(_storage.valueArena());
         _storage.addChildValue(parentValue, namePath, location, value);
     }
     _storage.updateLastSection(value, namePath);
@@ -143,5 +144,10 @@ auto DocumentBuilder::getDocumentAndReset() noexcept -> std::shared_ptr<Document
 }
 
 
+void DocumentBuilder::setValueArena(ValueArenaPtr valueArena) {
+    _storage.setValueArena(std::move(valueArena));
+}
+
+
 }
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
@@ -85,6 +85,20 @@ public:
     ///
     [[nodiscard]] auto getDocumentAndReset() noexcept -> std::shared_ptr<Document>;
 
+    /// Set the arena for the document and all values created by this builder.
+    ///
+    /// This resets the document builder.
+    ///
+    /// @param valueArena The arena, or `nullptr` to allocate the document on the heap.
+    ///
+    void setValueArena(ValueArenaPtr valueArena);
+
+    /// Access the arena for new values.
+    ///
+    [[nodiscard]] auto valueArena() const noexcept -> const ValueArenaPtr& {
+        return _storage.valueArena();
+    }
+
 public: // methods for the public interface.
     template<typename T>
     void addValueT(const NamePathLike &, const T &) {
@@ -93,12 +107,12 @@ public: // methods for the public interface.
 
     template<typename T> requires (std::is_integral_v<T>)
     void addValueT(const NamePathLike &namePath, const T &value) {
-        addValue(namePath, Value::createInteger(static_cast<Integer>(value)));
+        addValue(namePath, Value::createInteger(static_cast<Integer>(value), _storage.valueArena()));
     }
 
     template<typename T> requires (std::is_floating_point_v<T>)
     void addValueT(const NamePathLike &namePath, const T &value) {
-        addValue(namePath, Value::createFloat(static_cast<Float>(value)));
+        addValue(namePath, Value::createFloat(static_cast<Float>(value), _storage.valueArena()));
     }
 
 private:
@@ -108,52 +122,52 @@ private:
 
 template<>
 inline void DocumentBuilder::addValueT<String>(const NamePathLike &namePath, const String &value) {
-    addValue(namePath, Value::createText(value));
+    addValue(namePath, Value::createText(value, _storage.valueArena()));
 }
 
 template<>
 inline void DocumentBuilder::addValueT<std::u8string>(const NamePathLike &namePath, const std::u8string &value) {
-    addValue(namePath, Value::createText(String{value}));
+    addValue(namePath, Value::createText(String{value}, _storage.valueArena()));
 }
 
 template<>
 inline void DocumentBuilder::addValueT<std::string>(const NamePathLike &namePath, const std::string &value) {
-    addValue(namePath, Value::createText(String{value}));
+    addValue(namePath, Value::createText(String{value}, _storage.valueArena()));
 }
 
 template<>
 inline void DocumentBuilder::addValueT<bool>(const NamePathLike &namePath, const bool &value) {
-    addValue(namePath, Value::createBoolean(value));
+    addValue(namePath, Value::createBoolean(value, _storage.valueArena()));
 }
 
 template<>
 inline void DocumentBuilder::addValueT<Date>(const NamePathLike &namePath, const Date &value) {
-    addValue(namePath, Value::createDate(value));
+    addValue(namePath, Value::createDate(value, _storage.valueArena()));
 }
 
 template<>
 inline void DocumentBuilder::addValueT<Time>(const NamePathLike &namePath, const Time &value) {
-    addValue(namePath, Value::createTime(value));
+    addValue(namePath, Value::createTime(value, _storage.valueArena()));
 }
 
 template<>
 inline void DocumentBuilder::addValueT<DateTime>(const NamePathLike &namePath, const DateTime &value) {
-    addValue(namePath, Value::createDateTime(value));
+    addValue(namePath, Value::createDateTime(value, _storage.valueArena()));
 }
 
 template<>
 inline void DocumentBuilder::addValueT<Bytes>(const NamePathLike &namePath, const Bytes &value) {
-    addValue(namePath, Value::createBytes(value));
+    addValue(namePath, Value::createBytes(value, _storage.valueArena()));
 }
 
 template<>
 inline void DocumentBuilder::addValueT<RegEx>(const NamePathLike &namePath, const RegEx &value) {
-    addValue(namePath, Value::createRegEx(value));
+    addValue(namePath, Value::createRegEx(value, _storage.valueArena()));
 }
 
 template<>
 inline void DocumentBuilder::addValueT<TimeDelta>(const NamePathLike &namePath, const TimeDelta &value) {
-    addValue(namePath, Value::createTimeDelta(value));
+    addValue(namePath, Value::createTimeDelta(value, _storage.valueArena()));
 }
 
 
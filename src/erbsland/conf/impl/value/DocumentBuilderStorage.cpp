@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #include "DocumentBuilderStorage.hpp"
 
@@ -8,13 +8,14 @@
 #include "ValueHelper.hpp"
 
 #include <stdexcept>
+#include <utility>
 
 
 namespace erbsland::conf::impl {
 
 
 void DocumentBuilderStorage::reset() {
-    _document = std::make_shared<Document>();
+    _document = ValueArena::makeShared<Document>(_valueArena);
     _lastSectionNamePath = {};
     _lastSectionValue = {};
 }
@@ -27,6 +28,12 @@ auto DocumentBuilderStorage::getDocumentAndReset() noexcept -> std::shared_ptr<D
 }
 
 
+void DocumentBuilderStorage::setValueArena(ValueArenaPtr valueArena) {
+    _valueArena = std::move(valueArena);
+    reset();
+}
+
+
 void DocumentBuilderStorage::updateLastSection(const ValuePtr &sectionValue, const NamePath &sectionNamePath) {
     if (sectionValue == nullptr) {
         throw std::invalid_argument{"sectionValue must not be null."};
@@ -49,7 +56,7 @@ auto DocumentBuilderStorage::resolveForSection(
         const auto &name = namePath.at(i);
         sectionValue = getChildValue(sectionValue, name);
         if (sectionValue == nullptr) {
-            sectionValue = Value::createIntermediateSection();
+            sectionValue = Value::createIntermediateSection(_valueArena);
             sectionValue->setName(name);
             addChildValue(parentValue, namePath, location, sectionValue);
         } else {
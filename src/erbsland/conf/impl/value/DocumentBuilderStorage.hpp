@@ -1,9 +1,10 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
 
 #include "Document.hpp"
+#include "ValueArena.hpp"
 
 
 namespace erbsland::conf::impl {
@@ -28,6 +29,20 @@ public:
     ///
     [[nodiscard]] auto getDocumentAndReset() noexcept -> std::shared_ptr<Document>;
 
+    /// Set the arena for the document and all values created by the storage.
+    ///
+    /// This also resets the storage.
+    ///
+    /// @param valueArena The arena, or `nullptr` to allocate all values on the heap.
+    ///
+    void setValueArena(ValueArenaPtr valueArena);
+
+    /// Access the arena for new values.
+    ///
+    [[nodiscard]] auto valueArena() const noexcept -> const ValueArenaPtr& {
+        return _valueArena;
+    }
+
     /// Update the last updated section.
     ///
     void updateLastSection(const ValuePtr &sectionValue, const NamePath &sectionNamePath);
@@ -87,6 +102,7 @@ private:
         const ValuePtr &value);
 
 private:
+    ValueArenaPtr _valueArena;
     NamePath _lastSectionNamePath;
     ValuePtr _lastSectionValue;
     std::shared_ptr<Document> _document = std::make_shared<Document>();
@@ -0,0 +1,82 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "PackedValues.hpp"
+
+
+#include "ValueWithNativeType.hpp"
+
+#include <algorithm>
+#include <concepts>
+
+
+namespace erbsland::conf::impl {
+
+
+auto PackedValues::create(const std::vector<ValuePtr> &values) -> PackedValues {
+    if (values.empty()) {
+        return {};
+    }
+    const auto &first = values.front();
+    if (first->type() == ValueType::Integer) {
+        return createForType<Integer>(values);
+    }
+    if (first->type() == ValueType::Float) {
+        return createForType<Float>(values);
+    }
+    if (first->type() == ValueType::ValueList) {
+        if (const auto *packedRow = first->packedValues(); packedRow != nullptr) {
+            if (packedRow->isPacked<Integer>()) {
+                return createForType<Integer>(values);
+            }
+            if (packedRow->isPacked<Float>()) {
+                return createForType<Float>(values);
+            }
+        }
+    }
+    return {};
+}
+
+
+template<typename T>
+auto PackedValues::createForType(const std::vector<ValuePtr> &values) -> PackedValues {
+    using NativeValue = std::conditional_t<std::same_as<T, Integer>, IntegerValue, FloatValue>;
+    constexpr auto expectedType = std::same_as<T, Integer> ? ValueType::Integer : ValueType::Float;
+    const bool isNested = std::ranges::any_of(values, [](const ValuePtr &value) -> bool {
+        return value->type() == ValueType::ValueList;
+    });
+    std::vector<T> packedValues;
+    std::vector<std::size_t> rowOffsets;
+    std::size_t columnCount = 1;
+    packedValues.reserve(values.size());
+    if (isNested) {
+        rowOffsets.reserve(values.size() + 1);
+    }
+    for (const auto &value : values) {
+        if (isNested) {
+            rowOffsets.push_back(packedValues.size());
+        }
+        if (value->type() == expectedType) {
+            packedValues.push_back(static_cast<const NativeValue&>(*value).rawStorage());
+            continue;
+        }
+        const auto *packedRow = isNested ? value->packedValues() : nullptr;
+        if (packedRow == nullptr || !packedRow->isPacked<T>() || packedRow->isNested()) {
+            return {}; // A different type, or a list nested too deeply.
+        }
+        const auto rowValues = packedRow->values<T>();
+        packedValues.insert(packedValues.end(), rowValues.begin(), rowValues.end());
+        columnCount = std::max(columnCount, rowValues.size());
+    }
+    if (isNested) {
+        rowOffsets.push_back(packedValues.size());
+    }
+    PackedValues result;
+    result._values = std::move(packedValues);
+    result._rowOffsets = std::move(rowOffsets);
+    result._columnCount = columnCount;
+    return result;
+}
+
+
+}
+
@@ -0,0 +1,96 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "../../Float.hpp"
+#include "../../Integer.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <variant>
+#include <vector>
+
+
+namespace erbsland::conf::impl {
+
+
+class Value;
+
+
+/// Contiguous native storage for the elements of a homogeneous value list.
+///
+/// A value list is packed, if all its elements are integers, or all its elements are floats. Nested value lists
+/// are packed as matrix, if each element is either a single value or a packed list of the same type. In this case,
+/// the values of all rows are stored one after the other, and the row offsets mark the start of each row.
+///
+/// The storage is created on the first access, e.g. by `asSpan()` or `asMatrixView()`, and never modified, because
+/// the elements of value lists are not changed after the list was created.
+///
+/// @tested `ValuePackedListTest`
+///
+class PackedValues final {
+public:
+    /// The packed values.
+    using Storage = std::variant<std::monostate, std::vector<Integer>, std::vector<Float>>;
+
+public:
+    PackedValues() = default;
+
+    /// Pack the elements of a value list.
+    ///
+    /// @param values The elements of the value list.
+    /// @return The packed values, or empty storage if the elements can't be packed.
+    ///
+    [[nodiscard]] static auto create(const std::vector<std::shared_ptr<Value>> &values) -> PackedValues;
+
+public:
+    /// Test if the values are packed with the given type.
+    ///
+    template<typename T>
+    [[nodiscard]] auto isPacked() const noexcept -> bool {
+        return std::holds_alternative<std::vector<T>>(_values);
+    }
+
+    /// Test if the list has nested value lists.
+    ///
+    /// If not, each element is a single value, that is also a matrix row with one column.
+    ///
+    [[nodiscard]] auto isNested() const noexcept -> bool { return !_rowOffsets.empty(); }
+
+    /// Access the packed values.
+    ///
+    /// @return All values, row by row, or an empty span if the values are not packed with this type.
+    ///
+    template<typename T>
+    [[nodiscard]] auto values() const noexcept -> std::span<const T> {
+        if (const auto *values = std::get_if<std::vector<T>>(&_values); values != nullptr) {
+            return *values;
+        }
+        return {};
+    }
+
+    /// The offsets of the rows in the values, followed by the total number of values.
+    ///
+    /// @return The row offsets, or an empty span if the list has no nested lists.
+    ///
+    [[nodiscard]] auto rowOffsets() const noexcept -> std::span<const std::size_t> { return _rowOffsets; }
+
+    /// The maximum number of values in a row.
+    ///
+    [[nodiscard]] auto columnCount() const noexcept -> std::size_t { return _columnCount; }
+
+private:
+    template<typename T>
+    [[nodiscard]] static auto createForType(const std::vector<std::shared_ptr<Value>> &values) -> PackedValues;
+
+private:
+    Storage _values; ///< The packed values, row by row.
+    std::vector<std::size_t> _rowOffsets; ///< The row offsets, for nested lists.
+    std::size_t _columnCount{0}; ///< The maximum number of values in a row.
+};
+
+
+}
+
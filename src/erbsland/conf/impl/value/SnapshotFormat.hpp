@@ -0,0 +1,92 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+
+/// The binary format of document snapshots.
+///
+/// All numbers are stored in little-endian byte order. Unsigned numbers use a variable length encoding with
+/// seven bits per byte (`varint`), signed numbers are zig-zag encoded before. Strings and byte sequences are
+/// stored as `varint` size, followed by the data.
+///
+/// ```
+/// snapshot  := magic(8) version(u32) digest(bytes) sourceCount(varint) source* node checksum(u64)
+/// source    := name(string) path(string)
+/// node      := type(u8) [name] flags(u8) [location] payload
+/// name      := nameType(u8) (text(string) | index(varint))     -- omitted for the document.
+/// location  := sourceIndex(varint) line(signed) column(signed)   -- only if `Flag::HasLocation` is set.
+/// ```
+///
+/// The source index refers to the source table, starting with one. Zero is used for locations without a source.
+/// The payload of a scalar value depends on its type. Sections, section lists, value lists and the document
+/// store the number of children, followed by the child nodes. The checksum covers all preceding bytes.
+///
+namespace erbsland::conf::impl::snapshot {
+
+
+/// The magic bytes at the start of each snapshot.
+constexpr std::array<std::byte, 8> cMagic = {
+    std::byte{'E'}, std::byte{'L'}, std::byte{'C'}, std::byte{'L'},
+    std::byte{'S'}, std::byte{'N'}, std::byte{'A'}, std::byte{'P'}};
+
+/// The version of the format.
+///
+/// Increase this version for every incompatible change of the format. Snapshots with a different version
+/// are rejected by the reader.
+///
+constexpr uint32_t cVersion = 1;
+
+/// The maximum nesting depth of the nodes.
+///
+/// Documents are limited by the maximum length of name paths, value lists add at most two more levels.
+/// The limit prevents a stack overflow when reading a corrupted snapshot.
+///
+constexpr std::size_t cMaxDepth = 32;
+
+/// The size of the trailing checksum.
+constexpr std::size_t cChecksumSize = 8;
+
+
+/// Flags stored for each node.
+///
+enum Flag : uint8_t {
+    HasLocation = 0x01U, ///< The node has a location.
+    IsDefaultValue = 0x02U, ///< The value was added from a default value of a validation rule.
+    KnownFlags = 0x03U, ///< All known flags.
+};
+
+
+/// Calculate the checksum for the snapshot data.
+///
+/// Combines the data in blocks of eight bytes, to keep the verification cost low for large snapshots.
+///
+[[nodiscard]] inline auto checksum(const std::span<const std::byte> data) noexcept -> uint64_t {
+    constexpr uint64_t cPrime = 0x9e3779b97f4a7c15ULL;
+    uint64_t result = 0xcbf29ce484222325ULL ^ data.size();
+    std::size_t offset = 0;
+    for (; offset + 8 <= data.size(); offset += 8) {
+        uint64_t word = 0;
+        for (std::size_t i = 0; i < 8; ++i) {
+            word |= static_cast<uint64_t>(data[offset + i]) << (i * 8U);
+        }
+        result = std::rotl(result ^ word, 29) * cPrime;
+    }
+    uint64_t tail = 0;
+    for (std::size_t i = 0; offset + i < data.size(); ++i) {
+        tail |= static_cast<uint64_t>(data[offset + i]) << (i * 8U);
+    }
+    result = std::rotl(result ^ tail, 29) * cPrime;
+    result ^= result >> 32U;
+    return result;
+}
+
+
+}
+
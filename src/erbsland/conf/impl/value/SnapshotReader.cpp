@@ -0,0 +1,346 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "SnapshotReader.hpp"
+
+
+#include "Document.hpp"
+#include "SnapshotFormat.hpp"
+
+#include "../../Error.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+
+namespace erbsland::conf::impl {
+
+
+auto SnapshotReader::readSourceDigest() -> Bytes {
+    _offset = 0;
+    _endOffset = _data.size();
+    readHeader();
+    return _sourceDigest;
+}
+
+
+void SnapshotReader::read() {
+    _offset = 0;
+    if (_data.size() < snapshot::cMagic.size() + 4 + snapshot::cChecksumSize) {
+        throw Error(ErrorCategory::Unsupported, u8"The data is no document snapshot.", _errorLocation);
+    }
+    _endOffset = _data.size() - snapshot::cChecksumSize;
+    readHeader();
+    const auto checksumData = _data.subspan(_endOffset);
+    uint64_t expectedChecksum = 0;
+    for (std::size_t i = 0; i < snapshot::cChecksumSize; ++i) {
+        expectedChecksum |= static_cast<uint64_t>(checksumData[i]) << (i * 8U);
+    }
+    if (snapshot::checksum(_data.first(_endOffset)) != expectedChecksum) {
+        throwCorrupted(u8"The checksum does not match");
+    }
+    try {
+        readSources();
+        _arena = ValueArena::create();
+        auto document = ValueArena::makeShared<Document>(_arena);
+        if (readByte() != static_cast<uint8_t>(ValueType::Document)) {
+            throwCorrupted(u8"Expected the document node");
+        }
+        const auto flags = readByte();
+        if ((flags & ~snapshot::KnownFlags) != 0) {
+            throwCorrupted(u8"Unknown flags");
+        }
+        if ((flags & snapshot::HasLocation) != 0) {
+            document->setLocation(readLocation());
+        }
+        readChildNodes(document, *document, 1);
+        if (_offset != _endOffset) {
+            throwCorrupted(u8"Unexpected data after the document");
+        }
+        _document = std::move(document);
+    } catch (const Error&) {
+        throw;
+    } catch (const std::exception&) {
+        // Invalid dates, times, or offsets.
+        throwCorrupted(u8"Invalid value");
+    }
+}
+
+
+void SnapshotReader::readHeader() {
+    if (_endOffset < snapshot::cMagic.size() + 4
+        || !std::ranges::equal(_data.first(snapshot::cMagic.size()), snapshot::cMagic)) {
+        throw Error(ErrorCategory::Unsupported, u8"The data is no document snapshot.", _errorLocation);
+    }
+    _offset = snapshot::cMagic.size();
+    if (readFixed(4) != snapshot::cVersion) {
+        throw Error(ErrorCategory::Unsupported, u8"The document snapshot has an unsupported version.", _errorLocation);
+    }
+    _sourceDigest = readBytes();
+}
+
+
+void SnapshotReader::readSources() {
+    const auto count = readSize();
+    _sources.clear();
+    _sources.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto name = readString();
+        auto path = readString();
+        _sources.push_back(SourceIdentifier::create(std::move(name), std::move(path)));
+    }
+}
+
+
+void SnapshotReader::readChildNodes(const conf::ValuePtr &parent, Container &container, const std::size_t depth) {
+    const auto count = readSize();
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto child = readNode(depth);
+        if (parent->type() == ValueType::SectionList && !child->type().isMap()) {
+            throwCorrupted(u8"Section lists must only contain sections");
+        }
+        child->setParent(parent);
+        container.addValue(child);
+    }
+}
+
+
+auto SnapshotReader::readNode(const std::size_t depth) -> ValuePtr {
+    if (depth > snapshot::cMaxDepth) {
+        throwCorrupted(u8"The nodes are nested too deeply");
+    }
+    const auto rawType = readByte();
+    if (rawType == static_cast<uint8_t>(ValueType::Undefined) || rawType >= static_cast<uint8_t>(ValueType::Document)) {
+        throwCorrupted(u8"Invalid node type");
+    }
+    const auto type = ValueType{static_cast<ValueType::Enum>(rawType)};
+    auto name = readName();
+    const auto flags = readByte();
+    if ((flags & ~snapshot::KnownFlags) != 0) {
+        throwCorrupted(u8"Unknown flags");
+    }
+    Location location;
+    if ((flags & snapshot::HasLocation) != 0) {
+        location = readLocation();
+    }
+    ValuePtr value;
+    if (type.isScalar()) {
+        value = readScalar(type);
+    } else if (type == ValueType::ValueList) {
+        const auto count = readSize();
+        std::vector<ValuePtr> children;
+        children.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto child = readNode(depth + 1);
+            if (!child->type().isScalar() && child->type() != ValueType::ValueList) {
+                throwCorrupted(u8"Value lists must only contain values");
+            }
+            children.push_back(std::move(child));
+        }
+        value = Value::createValueList(std::move(children), _arena);
+    } else {
+        switch (type) {
+        case ValueType::SectionList:
+            value = Value::createSectionList(_arena);
+            break;
+        case ValueType::IntermediateSection:
+            value = Value::createIntermediateSection(_arena);
+            break;
+        case ValueType::SectionWithNames:
+            value = Value::createSectionWithNames(_arena);
+            break;
+        default:
+            value = Value::createSectionWithTexts(_arena);
+            break;
+        }
+        readChildNodes(value, *value, depth + 1);
+    }
+    value->setName(std::move(name));
+    value->setLocation(location);
+    if ((flags & snapshot::IsDefaultValue) != 0) {
+        value->markAsDefaultValue();
+    }
+    return value;
+}
+
+
+auto SnapshotReader::readScalar(const ValueType type) -> ValuePtr {
+    switch (type) {
+    case ValueType::Integer:
+        return Value::createInteger(readSigned(), _arena);
+    case ValueType::Boolean:
+        return Value::createBoolean(readByte() != 0, _arena);
+    case ValueType::Float:
+        return Value::createFloat(std::bit_cast<Float>(readFixed(8)), _arena);
+    case ValueType::Text:
+        return Value::createText(readString(), _arena);
+    case ValueType::Date:
+        return Value::createDate(readDate(), _arena);
+    case ValueType::Time:
+        return Value::createTime(readTime(), _arena);
+    case ValueType::DateTime: {
+        auto date = readDate();
+        auto time = readTime();
+        return Value::createDateTime(DateTime{std::move(date), std::move(time)}, _arena);
+    }
+    case ValueType::Bytes:
+        return Value::createBytes(readBytes(), _arena);
+    case ValueType::TimeDelta: {
+        const auto count = readSize();
+        TimeDelta timeDelta;
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto unit = readByte();
+            if (unit >= TimeUnit::all().size()) {
+                throwCorrupted(u8"Invalid time unit");
+            }
+            timeDelta.setCount(TimeUnit{static_cast<TimeUnit::Enum>(unit)}, readSigned());
+        }
+        return Value::createTimeDelta(timeDelta, _arena);
+    }
+    default: { // ValueType::RegEx
+        auto text = readString();
+        const auto isMultiLine = readByte() != 0;
+        return Value::createRegEx(RegEx{std::move(text), isMultiLine}, _arena);
+    }
+    }
+}
+
+
+auto SnapshotReader::readName() -> Name {
+    switch (static_cast<NameType>(readByte())) {
+    case NameType::Regular:
+        return Name::createRegular(readString());
+    case NameType::Text:
+        return Name::createText(readString());
+    case NameType::Index:
+        return Name::createIndex(readUnsigned());
+    case NameType::TextIndex:
+        return Name::createTextIndex(readUnsigned());
+    default:
+        throwCorrupted(u8"Invalid name type");
+    }
+}
+
+
+auto SnapshotReader::readLocation() -> Location {
+    const auto sourceIndex = readUnsigned();
+    if (sourceIndex > _sources.size()) {
+        throwCorrupted(u8"Invalid source index");
+    }
+    const auto line = readSigned();
+    const auto column = readSigned();
+    constexpr auto cMaxPosition = static_cast<int64_t>(std::numeric_limits<int>::max());
+    if (line < -1 || line > cMaxPosition || column < -1 || column > cMaxPosition) {
+        throwCorrupted(u8"Invalid position");
+    }
+    return Location{
+        sourceIndex > 0 ? _sources[sourceIndex - 1] : SourceIdentifierPtr{},
+        Position{static_cast<int>(line), static_cast<int>(column)}};
+}
+
+
+auto SnapshotReader::readDate() -> Date {
+    const auto year = readSigned();
+    const auto month = readByte();
+    const auto day = readByte();
+    if (month == 0) {
+        return {};
+    }
+    if (year < 0 || year > 9999) {
+        throwCorrupted(u8"Invalid date");
+    }
+    return Date{static_cast<int>(year), month, day};
+}
+
+
+auto SnapshotReader::readTime() -> Time {
+    const auto nanoseconds = readSigned();
+    const auto isLocalTime = readByte() != 0;
+    const auto offsetSeconds = readSigned();
+    if (nanoseconds < 0) {
+        return {};
+    }
+    if (offsetSeconds < std::numeric_limits<int32_t>::min() || offsetSeconds > std::numeric_limits<int32_t>::max()) {
+        throwCorrupted(u8"Invalid time offset");
+    }
+    return Time{
+        nanoseconds,
+        isLocalTime ? TimeOffset{} : TimeOffset{static_cast<int32_t>(offsetSeconds)}};
+}
+
+
+auto SnapshotReader::readByte() -> uint8_t {
+    if (_offset >= _endOffset) {
+        throwCorrupted(u8"Unexpected end of the data");
+    }
+    return static_cast<uint8_t>(_data[_offset++]);
+}
+
+
+auto SnapshotReader::readUnsigned() -> uint64_t {
+    uint64_t result = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        const auto byte = readByte();
+        result |= static_cast<uint64_t>(byte & 0x7fU) << shift;
+        if ((byte & 0x80U) == 0) {
+            return result;
+        }
+    }
+    throwCorrupted(u8"Invalid number");
+}
+
+
+auto SnapshotReader::readSigned() -> int64_t {
+    const auto value = readUnsigned();
+    return static_cast<int64_t>(value >> 1U) ^ -static_cast<int64_t>(value & 1U);
+}
+
+
+auto SnapshotReader::readFixed(const std::size_t size) -> uint64_t {
+    uint64_t result = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        result |= static_cast<uint64_t>(readByte()) << (i * 8U);
+    }
+    return result;
+}
+
+
+auto SnapshotReader::readSize() -> std::size_t {
+    const auto size = readUnsigned();
+    // Each element uses at least one byte, so this check also limits the size of all allocations.
+    if (size > _endOffset - _offset) {
+        throwCorrupted(u8"Invalid size");
+    }
+    return static_cast<std::size_t>(size);
+}
+
+
+auto SnapshotReader::readSpan() -> std::span<const std::byte> {
+    const auto size = readSize();
+    const auto result = _data.subspan(_offset, size);
+    _offset += size;
+    return result;
+}
+
+
+auto SnapshotReader::readString() -> String {
+    return String{readSpan(), PrivateTag{}};
+}
+
+
+auto SnapshotReader::readBytes() -> Bytes {
+    const auto data = readSpan();
+    return Bytes{Bytes::ByteVector{data.begin(), data.end()}};
+}
+
+
+void SnapshotReader::throwCorrupted(const std::u8string_view reason) const {
+    throw Error(
+        ErrorCategory::Syntax,
+        String{u8"The document snapshot is corrupted. "} + String{reason} + u8".",
+        _errorLocation);
+}
+
+
+}
+
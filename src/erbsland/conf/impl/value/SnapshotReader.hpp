@@ -0,0 +1,106 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "Value.hpp"
+#include "ValueArena.hpp"
+
+#include "../../Bytes.hpp"
+#include "../../Document.hpp"
+#include "../../Location.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+namespace erbsland::conf::impl {
+
+
+/// Reads a document from the binary snapshot format.
+///
+/// The reader verifies the checksum, and checks every read against the size of the data, so corrupted or
+/// truncated snapshots are reported with an error.
+///
+/// See `SnapshotFormat.hpp` for a description of the format.
+///
+/// @tested `DocumentSnapshotTest`
+///
+class SnapshotReader final {
+public:
+    /// Create a new reader.
+    ///
+    /// @param data The snapshot data. It must stay valid until the reader is destroyed.
+    /// @param errorLocation The location used for errors.
+    ///
+    SnapshotReader(std::span<const std::byte> data, Location errorLocation) noexcept
+        : _data{data}, _errorLocation{std::move(errorLocation)} {}
+    ~SnapshotReader() = default;
+
+    // prevent copy and assign.
+    SnapshotReader(const SnapshotReader&) = delete;
+    auto operator=(const SnapshotReader&) -> SnapshotReader& = delete;
+
+public:
+    /// Read only the header of the snapshot.
+    ///
+    /// The checksum is not verified, so only the first bytes of the data are accessed.
+    ///
+    /// @return The source digest that is stored in the header.
+    /// @throws Error (Unsupported) If the data is no snapshot, or the snapshot has an unsupported version.
+    /// @throws Error (Syntax) If the header is corrupted.
+    ///
+    [[nodiscard]] auto readSourceDigest() -> Bytes;
+
+    /// Read the whole snapshot and rebuild the document.
+    ///
+    /// @throws Error (Unsupported) If the data is no snapshot, or the snapshot has an unsupported version.
+    /// @throws Error (Syntax) If the data is corrupted.
+    ///
+    void read();
+
+    /// The source digest, after reading.
+    ///
+    [[nodiscard]] auto sourceDigest() const noexcept -> const Bytes& { return _sourceDigest; }
+
+    /// The rebuilt document, after reading.
+    ///
+    [[nodiscard]] auto document() const noexcept -> const DocumentPtr& { return _document; }
+
+private:
+    void readHeader();
+    void readSources();
+    /// Read the child nodes, and add them to the container.
+    void readChildNodes(const conf::ValuePtr &parent, Container &container, std::size_t depth);
+    [[nodiscard]] auto readNode(std::size_t depth) -> ValuePtr;
+    [[nodiscard]] auto readScalar(ValueType type) -> ValuePtr;
+    [[nodiscard]] auto readName() -> Name;
+    [[nodiscard]] auto readLocation() -> Location;
+    [[nodiscard]] auto readDate() -> Date;
+    [[nodiscard]] auto readTime() -> Time;
+    [[nodiscard]] auto readByte() -> uint8_t;
+    [[nodiscard]] auto readUnsigned() -> uint64_t;
+    [[nodiscard]] auto readSigned() -> int64_t;
+    [[nodiscard]] auto readFixed(std::size_t size) -> uint64_t;
+    [[nodiscard]] auto readSize() -> std::size_t;
+    [[nodiscard]] auto readSpan() -> std::span<const std::byte>;
+    [[nodiscard]] auto readString() -> String;
+    [[nodiscard]] auto readBytes() -> Bytes;
+    /// Throw an error for corrupted data.
+    [[noreturn]] void throwCorrupted(std::u8string_view reason) const;
+
+private:
+    std::span<const std::byte> _data; ///< The snapshot data.
+    Location _errorLocation; ///< The location for errors.
+    std::size_t _offset{0}; ///< The current read offset.
+    std::size_t _endOffset{0}; ///< The offset where the checksum starts.
+    Bytes _sourceDigest; ///< The source digest from the header.
+    std::vector<SourceIdentifierPtr> _sources; ///< The source table.
+    ValueArenaPtr _arena; ///< The arena for the rebuilt values.
+    DocumentPtr _document; ///< The rebuilt document.
+};
+
+
+}
+
@@ -0,0 +1,209 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "SnapshotWriter.hpp"
+
+
+#include "Document.hpp"
+#include "SnapshotFormat.hpp"
+
+#include <bit>
+
+
+namespace erbsland::conf::impl {
+
+
+auto SnapshotWriter::write(const conf::Document &document, const Bytes &sourceDigest) -> Bytes {
+    _data.clear();
+    _sources.clear();
+    _sourceIndexes.clear();
+    // Write the nodes first, to collect the source identifiers for the table in the header.
+    writeNode(document, static_cast<const Document&>(document).childrenImpl());
+    auto nodeData = std::move(_data);
+    _data.clear();
+    _data.reserve(nodeData.size() + 128);
+    _data.insert(_data.end(), snapshot::cMagic.begin(), snapshot::cMagic.end());
+    writeFixed(snapshot::cVersion, 4);
+    writeBytes(sourceDigest);
+    writeUnsigned(_sources.size());
+    for (const auto &source : _sources) {
+        writeString(source->name());
+        writeString(source->path());
+    }
+    _data.insert(_data.end(), nodeData.begin(), nodeData.end());
+    writeFixed(snapshot::checksum(_data), snapshot::cChecksumSize);
+    return Bytes{std::move(_data)};
+}
+
+
+void SnapshotWriter::writeNode(const conf::Value &value, const std::vector<ValuePtr> &children) {
+    const auto type = value.type();
+    writeByte(static_cast<uint8_t>(type.raw()));
+    if (type != ValueType::Document) {
+        writeName(static_cast<const Value&>(value).nameImpl());
+    }
+    uint8_t flags = 0;
+    if (value.hasLocation()) {
+        flags |= snapshot::HasLocation;
+    }
+    if (value.isDefaultValue()) {
+        flags |= snapshot::IsDefaultValue;
+    }
+    writeByte(flags);
+    if (value.hasLocation()) {
+        writeLocation(value.location());
+    }
+    if (type.isScalar()) {
+        writeScalar(value);
+        return;
+    }
+    writeUnsigned(children.size());
+    for (const auto &child : children) {
+        writeNode(*child, child->childrenImpl());
+    }
+}
+
+
+void SnapshotWriter::writeScalar(const conf::Value &value) {
+    switch (value.type()) {
+    case ValueType::Integer:
+        writeSigned(value.asInteger());
+        break;
+    case ValueType::Boolean:
+        writeByte(value.asBoolean() ? 1U : 0U);
+        break;
+    case ValueType::Float:
+        writeFixed(std::bit_cast<uint64_t>(value.asFloat()), 8);
+        break;
+    case ValueType::Text:
+        writeString(value.asText());
+        break;
+    case ValueType::Date:
+        writeDate(value.asDate());
+        break;
+    case ValueType::Time:
+        writeTime(value.asTime());
+        break;
+    case ValueType::DateTime: {
+        const auto dateTime = value.asDateTime();
+        writeDate(dateTime.date());
+        writeTime(dateTime.time());
+        break;
+    }
+    case ValueType::Bytes:
+        writeBytes(value.asBytes());
+        break;
+    case ValueType::TimeDelta: {
+        const auto timeDelta = value.asTimeDelta();
+        const auto units = timeDelta.units();
+        writeUnsigned(units.size());
+        for (const auto unit : units) {
+            writeByte(static_cast<uint8_t>(static_cast<TimeUnit::Enum>(unit)));
+            writeSigned(timeDelta.count(unit));
+        }
+        break;
+    }
+    case ValueType::RegEx: {
+        const auto regEx = value.asRegEx();
+        writeString(regEx.toText());
+        writeByte(regEx.isMultiLine() ? 1U : 0U);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+
+void SnapshotWriter::writeName(const Name &name) {
+    writeByte(static_cast<uint8_t>(name.type()));
+    if (name.type() == NameType::Regular || name.type() == NameType::Text) {
+        writeString(name.asText());
+    } else {
+        writeUnsigned(name.asIndex());
+    }
+}
+
+
+void SnapshotWriter::writeLocation(const Location &location) {
+    // Zero is used for locations without a source identifier.
+    const auto &sourceIdentifier = location.sourceIdentifier();
+    writeUnsigned(sourceIdentifier != nullptr ? sourceIndex(sourceIdentifier) + 1 : 0);
+    writeSigned(location.position().line());
+    writeSigned(location.position().column());
+}
+
+
+void SnapshotWriter::writeDate(const Date &date) {
+    if (date.isUndefined()) {
+        writeSigned(0);
+        writeByte(0);
+        writeByte(0);
+        return;
+    }
+    writeSigned(date.year());
+    writeByte(static_cast<uint8_t>(date.month()));
+    writeByte(static_cast<uint8_t>(date.day()));
+}
+
+
+void SnapshotWriter::writeTime(const Time &time) {
+    writeSigned(time.isUndefined() ? -1 : time.toNanoseconds().count());
+    const auto &offset = time.offset();
+    writeByte(offset.isLocalTime() ? 1U : 0U);
+    writeSigned(offset.isLocalTime() ? 0 : offset.totalSeconds().count());
+}
+
+
+void SnapshotWriter::writeByte(const uint8_t value) {
+    _data.push_back(static_cast<std::byte>(value));
+}
+
+
+void SnapshotWriter::writeUnsigned(uint64_t value) {
+    while (value >= 0x80U) {
+        writeByte(static_cast<uint8_t>((value & 0x7fU) | 0x80U));
+        value >>= 7U;
+    }
+    writeByte(static_cast<uint8_t>(value));
+}
+
+
+void SnapshotWriter::writeSigned(const int64_t value) {
+    // zig-zag encoding, to keep small negative numbers short.
+    writeUnsigned((static_cast<uint64_t>(value) << 1U) ^ static_cast<uint64_t>(value >> 63));
+}
+
+
+void SnapshotWriter::writeFixed(const uint64_t value, const std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        writeByte(static_cast<uint8_t>(value >> (i * 8U)));
+    }
+}
+
+
+void SnapshotWriter::writeString(const String &text) {
+    writeUnsigned(text.size());
+    const auto *data = reinterpret_cast<const std::byte*>(text.data());
+    _data.insert(_data.end(), data, data + text.size());
+}
+
+
+void SnapshotWriter::writeBytes(const Bytes &bytes) {
+    writeUnsigned(bytes.size());
+    _data.insert(_data.end(), bytes.begin(), bytes.end());
+}
+
+
+auto SnapshotWriter::sourceIndex(const SourceIdentifierPtr &sourceIdentifier) -> std::size_t {
+    if (const auto it = _sourceIndexes.find(sourceIdentifier.get()); it != _sourceIndexes.end()) {
+        return it->second;
+    }
+    const auto index = _sources.size();
+    _sources.push_back(sourceIdentifier);
+    _sourceIndexes.emplace(sourceIdentifier.get(), index);
+    return index;
+}
+
+
+}
+
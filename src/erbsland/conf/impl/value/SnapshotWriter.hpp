@@ -0,0 +1,70 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "Value.hpp"
+
+#include "../../Bytes.hpp"
+#include "../../Document.hpp"
+#include "../../Location.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+
+namespace erbsland::conf::impl {
+
+
+/// Writes a document into the binary snapshot format.
+///
+/// See `SnapshotFormat.hpp` for a description of the format.
+///
+/// @tested `DocumentSnapshotTest`
+///
+class SnapshotWriter final {
+public:
+    SnapshotWriter() = default;
+    ~SnapshotWriter() = default;
+
+    // prevent copy and assign.
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    auto operator=(const SnapshotWriter&) -> SnapshotWriter& = delete;
+
+public:
+    /// Write a document.
+    ///
+    /// @param document The document to write.
+    /// @param sourceDigest The digest of the sources, stored in the header.
+    /// @return The snapshot data.
+    ///
+    [[nodiscard]] auto write(const conf::Document &document, const Bytes &sourceDigest) -> Bytes;
+
+private:
+    /// Write a node with all its children.
+    void writeNode(const conf::Value &value, const std::vector<ValuePtr> &children);
+    /// Write the payload of a scalar value.
+    void writeScalar(const conf::Value &value);
+    void writeName(const Name &name);
+    void writeLocation(const Location &location);
+    void writeDate(const Date &date);
+    void writeTime(const Time &time);
+    void writeByte(uint8_t value);
+    void writeUnsigned(uint64_t value);
+    void writeSigned(int64_t value);
+    void writeFixed(uint64_t value, std::size_t size);
+    void writeString(const String &text);
+    void writeBytes(const Bytes &bytes);
+    /// Get the index of a source identifier in the source table, and add it if required.
+    [[nodiscard]] auto sourceIndex(const SourceIdentifierPtr &sourceIdentifier) -> std::size_t;
+
+private:
+    std::vector<std::byte> _data; ///< The data of the currently written section.
+    std::vector<SourceIdentifierPtr> _sources; ///< The source table.
+    std::unordered_map<const SourceIdentifier*, std::size_t> _sourceIndexes; ///< The index for each source.
+};
+
+
+}
+
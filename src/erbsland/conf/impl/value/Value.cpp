@@ -1,4 +1,4 @@
-// Copyright (c) 2024-2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2024-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #include "Value.hpp"
 
@@ -56,6 +56,11 @@ auto Value::parent() const noexcept -> conf::ValuePtr {
 }
 
 
+auto Value::contentHash() const noexcept -> uint64_t {
+    return contentHashFor(ValueTreeGeneration::currentFor(*this));
+}
+
+
 auto Value::size() const noexcept -> std::size_t {
     return 0;
 }
@@ -286,95 +291,95 @@ void Value::throwTypeMismatch(
 }
 
 
-auto Value::createInteger(Integer value) noexcept -> ValuePtr {
-    return std::make_shared<IntegerValue>(value);
+auto Value::createInteger(Integer value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<IntegerValue>(arena, value);
 }
 
 
-auto Value::createBoolean(bool value) noexcept -> ValuePtr {
-    return std::make_shared<BooleanValue>(value);
+auto Value::createBoolean(bool value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<BooleanValue>(arena, value);
 }
 
 
-auto Value::createFloat(Float value) noexcept -> ValuePtr {
-    return std::make_shared<FloatValue>(value);
+auto Value::createFloat(Float value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<FloatValue>(arena, value);
 }
 
 
-auto Value::createText(const String &value) noexcept -> ValuePtr {
-    return std::make_shared<TextValue>(value);
+auto Value::createText(const String &value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<TextValue>(arena, value);
 }
 
 
-auto Value::createText(String &&value) noexcept -> ValuePtr {
-    return std::make_shared<TextValue>(std::move(value));
+auto Value::createText(String &&value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<TextValue>(arena, std::move(value));
 }
 
 
-auto Value::createDate(const Date &value) noexcept -> ValuePtr {
-    return std::make_shared<DateValue>(value);
+auto Value::createDate(const Date &value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<DateValue>(arena, value);
 }
 
 
-auto Value::createTime(const Time &value) noexcept -> ValuePtr {
-    return std::make_shared<TimeValue>(value);
+auto Value::createTime(const Time &value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<TimeValue>(arena, value);
 }
 
 
-auto Value::createDateTime(const DateTime &value) noexcept -> ValuePtr {
-    return std::make_shared<DateTimeValue>(value);
+auto Value::createDateTime(const DateTime &value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<DateTimeValue>(arena, value);
 }
 
 
-auto Value::createBytes(const Bytes &value) noexcept -> ValuePtr {
-    return std::make_shared<BytesValue>(value);
+auto Value::createBytes(const Bytes &value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<BytesValue>(arena, value);
 }
 
 
-auto Value::createBytes(Bytes &&value) noexcept -> ValuePtr {
-    return std::make_shared<BytesValue>(std::move(value));
+auto Value::createBytes(Bytes &&value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<BytesValue>(arena, std::move(value));
 }
 
 
-auto Value::createTimeDelta(const TimeDelta &value) noexcept -> ValuePtr {
-    return std::make_shared<TimeDeltaValue>(value);
+auto Value::createTimeDelta(const TimeDelta &value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<TimeDeltaValue>(arena, value);
 }
 
 
-auto Value::createRegEx(const RegEx &value) noexcept -> ValuePtr {
-    return std::make_shared<RegExValue>(value);
+auto Value::createRegEx(const RegEx &value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<RegExValue>(arena, value);
 }
 
 
-auto Value::createRegEx(RegEx &&value) noexcept -> ValuePtr {
-    return std::make_shared<RegExValue>(std::move(value));
+auto Value::createRegEx(RegEx &&value, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<RegExValue>(arena, std::move(value));
 }
 
 
-auto Value::createValueList(std::vector<ValuePtr> &&valueList) noexcept -> ValuePtr {
-    auto result = std::make_shared<ValueList>(std::move(valueList));
+auto Value::createValueList(std::vector<ValuePtr> &&valueList, const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    auto result = ValueArena::makeShared<ValueList>(arena, std::move(valueList));
     result->initializeChildren();
     return result;
 }
 
 
-auto Value::createSectionList() noexcept -> ValuePtr {
-    return std::make_shared<SectionList>();
+auto Value::createSectionList(const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<SectionList>(arena);
 }
 
 
-auto Value::createIntermediateSection() noexcept -> ValuePtr {
-    return std::make_shared<IntermediateSection>();
+auto Value::createIntermediateSection(const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<IntermediateSection>(arena);
 }
 
 
-auto Value::createSectionWithNames() noexcept -> ValuePtr {
-    return std::make_shared<SectionWithNames>();
+auto Value::createSectionWithNames(const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<SectionWithNames>(arena);
 }
 
 
-auto Value::createSectionWithTexts() noexcept -> ValuePtr {
-    return std::make_shared<SectionWithTexts>();
+auto Value::createSectionWithTexts(const ValueArenaPtr &arena) noexcept -> ValuePtr {
+    return ValueArena::makeShared<SectionWithTexts>(arena);
 }
 
 
@@ -1,9 +1,11 @@
-// Copyright (c) 2024-2025 Erbsland DEV. https://erbsland.dev
+// Copyright (c) 2024-2026 Erbsland DEV. https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
 
 #include "Container.hpp"
+#include "ContentHash.hpp"
+#include "ValueArena.hpp"
 
 #include "../Definitions.hpp"
 #include "../lexer/Content.hpp"
@@ -46,6 +48,7 @@ public:
     [[nodiscard]] auto namePath() const noexcept -> NamePath override;
     [[nodiscard]] auto hasParent() const noexcept -> bool override;
     [[nodiscard]] auto parent() const noexcept -> conf::ValuePtr override;
+    [[nodiscard]] auto contentHash() const noexcept -> uint64_t override;
     [[nodiscard]] auto size() const noexcept -> std::size_t override;
     [[nodiscard]] auto hasValue(const NamePathLike &) const noexcept -> bool override;
     [[nodiscard]] auto value(const NamePathLike &) const noexcept -> conf::ValuePtr override;
@@ -58,6 +61,8 @@ public:
     [[nodiscard]] auto wasValidated() const noexcept -> bool override;
     [[nodiscard]] auto validationRule() const noexcept -> vr::RulePtr override;
     [[nodiscard]] auto isDefaultValue() const noexcept -> bool override;
+    [[nodiscard]] auto nameRef() const noexcept -> const Name& override { return _name; }
+    [[nodiscard]] auto locationRef() const noexcept -> const Location& override { return _location; }
 
     // empty defaults
     [[nodiscard]] auto asInteger() const noexcept -> int64_t override;
@@ -71,6 +76,8 @@ public:
     [[nodiscard]] auto asTimeDelta() const noexcept -> TimeDelta override;
     [[nodiscard]] auto asRegEx() const noexcept -> RegEx override;
     [[nodiscard]] auto asValueList() const noexcept -> conf::ValueList override;
+    [[nodiscard]] auto textView() const noexcept -> std::u8string_view override { return {}; }
+    [[nodiscard]] auto bytesView() const noexcept -> std::span<const std::byte> override { return {}; }
     [[nodiscard]] auto asIntegerOrThrow() const -> int64_t override;
     [[nodiscard]] auto asBooleanOrThrow() const -> bool override;
     [[nodiscard]] auto asFloatOrThrow() const -> double override;
@@ -113,24 +120,32 @@ public: // factory methods
     /// @{
     /// Factory method to create a value.
     ///
-    [[nodiscard]] static auto createInteger(Integer value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createBoolean(bool value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createFloat(Float value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createText(const String &value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createText(String &&value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createDate(const Date &value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createTime(const Time &value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createDateTime(const DateTime &value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createBytes(const Bytes &value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createBytes(Bytes &&value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createTimeDelta(const TimeDelta &value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createRegEx(const RegEx &value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createRegEx(RegEx &&value) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createValueList(std::vector<ValuePtr> &&valueList) noexcept -> ValuePtr;
-    [[nodiscard]] static auto createSectionList() noexcept -> ValuePtr;
-    [[nodiscard]] static auto createIntermediateSection() noexcept -> ValuePtr;
-    [[nodiscard]] static auto createSectionWithNames() noexcept -> ValuePtr;
-    [[nodiscard]] static auto createSectionWithTexts() noexcept -> ValuePtr;
+    /// @param arena The arena for the new value, or `nullptr` to allocate the value on the heap.
+    ///
+    [[nodiscard]] static auto createInteger(Integer value, const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createBoolean(bool value, const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createFloat(Float value, const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createText(const String &value, const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createText(String &&value, const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createDate(const Date &value, const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createTime(const Time &value, const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createDateTime(
+        const DateTime &value,
+        const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createBytes(const Bytes &value, const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createBytes(Bytes &&value, const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createTimeDelta(
+        const TimeDelta &value,
+        const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createRegEx(const RegEx &value, const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createRegEx(RegEx &&value, const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createValueList(
+        std::vector<ValuePtr> &&valueList,
+        const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createSectionList(const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createIntermediateSection(const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createSectionWithNames(const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
+    [[nodiscard]] static auto createSectionWithTexts(const ValueArenaPtr &arena = {}) noexcept -> ValuePtr;
     /// @}
 
 public: // implement `Container`
@@ -138,6 +153,12 @@ public: // implement `Container`
     void addValue(const ValuePtr &childValue) override;
 
 public: // helper methods.
+    /// Get the content hash, with the already known generation of the value tree.
+    [[nodiscard]] auto contentHashFor(uint64_t generation) const noexcept -> uint64_t {
+        return _contentHash.get(*this, _name, childrenImpl(), generation);
+    }
+    /// Fast access to the name, without a copy.
+    [[nodiscard]] auto nameImpl() const noexcept -> const Name& { return _name; }
     /// Fast access to all child-values.
     [[nodiscard]] virtual auto childrenImpl() const noexcept -> const std::vector<ValuePtr>&;
     /// Fast name-based access for child-values.
@@ -251,6 +272,7 @@ protected:
     Location _location; ///< The location of this value.
     RulePtr _rule; ///< The validation rule that was used when this value was validated.
     bool _isDefaultValue{false}; ///< Flag if this is a default value.
+    ContentHash _contentHash; ///< The cached content hash.
 };
 
 
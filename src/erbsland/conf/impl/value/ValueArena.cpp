@@ -0,0 +1,22 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "ValueArena.hpp"
+
+
+namespace erbsland::conf::impl {
+
+
+ValueArena::ValueArena(PrivateTag /*pt*/) noexcept
+:
+    _resource{cInitialChunkSize} {
+}
+
+
+auto ValueArena::allocate(const std::size_t size, const std::size_t alignment) -> void* {
+    _allocatedBytes += size;
+    return _resource.allocate(size, alignment);
+}
+
+
+}
+
@@ -0,0 +1,125 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "../utilities/PrivateTag.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+
+namespace erbsland::conf::impl {
+
+
+class ValueArena;
+using ValueArenaPtr = std::shared_ptr<ValueArena>;
+
+
+/// A memory arena for all nodes of one parsed document.
+///
+/// Values, sections and the document itself are created using `std::allocate_shared` with an allocator that
+/// places the object and its control block in a few large chunks of memory. Releasing a node never returns memory
+/// to the heap. Every control block keeps a reference to the arena, so the chunks are freed at once when the
+/// last node of the document is released. Values that outlive the document therefore stay valid.
+///
+/// The nodes cannot share a single control block with aliasing pointers: each container holds strong
+/// pointers to its children, and these would keep the shared block alive forever.
+///
+/// *Multithreading*: Creating values in an arena is not thread-safe. The parser creates all values in the arena
+/// from a single thread. Releasing values from multiple threads is safe.
+///
+/// @tested `ValueArenaTest`
+///
+class ValueArena final {
+public:
+    /// The size of the first chunk in bytes.
+    ///
+    constexpr static std::size_t cInitialChunkSize = 16U * 1024U;
+
+    /// The allocator that places objects in the arena.
+    ///
+    template<typename T>
+    class Allocator {
+    public:
+        using value_type = T;
+
+    public:
+        explicit Allocator(ValueArenaPtr arena) noexcept : _arena{std::move(arena)} {}
+        template<typename U>
+        Allocator(const Allocator<U> &other) noexcept : _arena{other._arena} {} // NOLINT(*-explicit-constructor)
+
+    public:
+        [[nodiscard]] auto allocate(const std::size_t count) -> T* {
+            return static_cast<T*>(_arena->allocate(count * sizeof(T), alignof(T)));
+        }
+        void deallocate(T* /*pointer*/, std::size_t /*count*/) noexcept {
+            // Memory is only released with the whole arena.
+        }
+        template<typename U>
+        [[nodiscard]] auto operator==(const Allocator<U> &other) const noexcept -> bool {
+            return _arena == other._arena;
+        }
+
+    private:
+        template<typename U> friend class Allocator;
+        ValueArenaPtr _arena; ///< The arena that provides the memory.
+    };
+
+public:
+    /// Create a new arena.
+    ///
+    explicit ValueArena(PrivateTag /*pt*/) noexcept;
+
+    /// Create a new arena.
+    ///
+    [[nodiscard]] static auto create() -> ValueArenaPtr {
+        return std::make_shared<ValueArena>(PrivateTag{});
+    }
+
+    // defaults
+    ~ValueArena() = default;
+
+    // disable copy and assign.
+    ValueArena(const ValueArena &) = delete;
+    auto operator=(const ValueArena &) -> ValueArena& = delete;
+    ValueArena(ValueArena &&) = delete;
+    auto operator=(ValueArena &&) -> ValueArena& = delete;
+
+public:
+    /// Create a shared object in the given arena, or on the heap if there is no arena.
+    ///
+    /// @tparam T The type of the created object.
+    /// @param arena The arena, or `nullptr` to use `std::make_shared`.
+    /// @param args The arguments for the constructor.
+    /// @return The new object.
+    ///
+    template<typename T, typename... Args>
+    [[nodiscard]] static auto makeShared(const ValueArenaPtr &arena, Args&&... args) -> std::shared_ptr<T> {
+        if (arena == nullptr) {
+            return std::make_shared<T>(std::forward<Args>(args)...);
+        }
+        return std::allocate_shared<T>(Allocator<T>{arena}, std::forward<Args>(args)...);
+    }
+
+    /// The number of bytes allocated from this arena.
+    ///
+    [[nodiscard]] auto allocatedBytes() const noexcept -> std::size_t {
+        return _allocatedBytes;
+    }
+
+private:
+    /// Allocate a block of memory.
+    ///
+    [[nodiscard]] auto allocate(std::size_t size, std::size_t alignment) -> void*;
+
+private:
+    std::pmr::monotonic_buffer_resource _resource; ///< The resource that manages the chunks.
+    std::size_t _allocatedBytes{0}; ///< The number of bytes allocated from this arena.
+};
+
+
+}
+
@@ -3,8 +3,11 @@
 #pragma once
 
 
+#include "PackedValues.hpp"
 #include "ValueWithChildren.hpp"
 
+#include <mutex>
+
 
 namespace erbsland::conf::impl {
 
@@ -39,6 +42,21 @@ public:
     void initializeChildren() {
         _children.setParent(shared_from_this());
     }
+    [[nodiscard]] auto packedValues() const noexcept -> const PackedValues* override {
+        // Most lists are never accessed as span or matrix, so the values are only packed on the first access.
+        std::call_once(_packedValuesFlag, [this]() noexcept -> void {
+            try {
+                _packedValues = PackedValues::create(_children.valueList());
+            } catch (...) {
+                // Without packed values, the list is accessed using its elements.
+            }
+        });
+        return &_packedValues;
+    }
+
+private:
+    mutable std::once_flag _packedValuesFlag; ///< Flag to pack the values once.
+    mutable PackedValues _packedValues; ///< The packed values, if this list is homogeneous.
 };
 
 
@@ -1,10 +1,11 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #include "ValueMap.hpp"
 
 
 #include "Value.hpp"
 
+#include <bit>
 #include <numeric>
 
 
@@ -15,9 +16,9 @@ ValueMap::ValueMap(List &&valueList) : _valueList(std::move(valueList)) {
     std::size_t index = 0;
     for (const auto &value : _valueList) {
         value->setName(Name::createIndex(index));
-        _valueMap.insert_or_assign(value->name(), value);
         index += 1;
     }
+    rebuildIndex();
 }
 
 
@@ -73,7 +74,7 @@ auto ValueMap::hasValueImpl(const NamePath &namePath) const noexcept -> bool {
 
 
 auto ValueMap::hasValueImpl(const Name &name) const noexcept -> bool {
-    return _valueMap.contains(name);
+    return findIndex(name) != cNotFound;
 }
 
 
@@ -142,11 +143,11 @@ auto ValueMap::valueImpl(const Name &name) const -> ValuePtr {
         }
         return _valueList[index];
     }
-    auto it = _valueMap.find(name);
-    if (it == _valueMap.end()) {
+    const auto index = findIndex(name);
+    if (index == cNotFound) {
         return {};
     }
-    return it->second;
+    return _valueList[index];
 }
 
 
@@ -159,7 +160,7 @@ auto ValueMap::valueImpl(std::size_t index) const -> ValuePtr {
 
 
 auto ValueMap::begin() const noexcept -> ValueIterator {
-    if (_valueMap.empty()) {
+    if (_valueList.empty()) {
         return {};
     }
     return ValueIterator{_valueList.begin()};
@@ -167,7 +168,7 @@ auto ValueMap::begin() const noexcept -> ValueIterator {
 
 
 auto ValueMap::end() const noexcept -> ValueIterator {
-    if (_valueMap.empty()) {
+    if (_valueList.empty()) {
         return {};
     }
     return ValueIterator{_valueList.end()};
@@ -179,7 +180,15 @@ void ValueMap::addValue(const ValuePtr &value) {
         value->setName(Name::createIndex(_valueList.size()));
     }
     _valueList.push_back(value);
-    _valueMap.insert_or_assign(value->name(), value);
+    _nameHashes.push_back(value->nameImpl().hash());
+    if (_indexTable.empty() && _valueList.size() <= cLinearScanLimit) {
+        return;
+    }
+    if (_valueList.size() * 2 > _indexTable.size()) {
+        rebuildIndexTable(); // keep the load factor of the table at or below 50%.
+    } else {
+        insertIntoIndexTable(_valueList.size() - 1);
+    }
 }
 
 
@@ -188,10 +197,66 @@ void ValueMap::removeDefaultValues() {
         return childValue->isDefaultValue();
     });
 
-    _valueMap.clear();
-    _valueMap.reserve(_valueList.size());
-    for (const auto &childValue : _valueList) {
-        _valueMap.insert_or_assign(childValue->name(), childValue);
+    rebuildIndex();
+}
+
+
+auto ValueMap::findIndex(const Name &name) const noexcept -> std::size_t {
+    const auto hash = name.hash();
+    if (_indexTable.empty()) {
+        // Scan backwards, so the last value with a name wins, like in the index table.
+        for (std::size_t index = _valueList.size(); index > 0; --index) {
+            if (_nameHashes[index - 1] == hash && _valueList[index - 1]->nameImpl() == name) {
+                return index - 1;
+            }
+        }
+        return cNotFound;
+    }
+    const auto mask = _indexTable.size() - 1;
+    for (auto slot = hash & mask; _indexTable[slot] != 0; slot = (slot + 1) & mask) {
+        const std::size_t index = _indexTable[slot] - 1;
+        if (_nameHashes[index] == hash && _valueList[index]->nameImpl() == name) {
+            return index;
+        }
+    }
+    return cNotFound;
+}
+
+
+void ValueMap::insertIntoIndexTable(const std::size_t index) noexcept {
+    const auto hash = _nameHashes[index];
+    const auto &name = _valueList[index]->nameImpl();
+    const auto mask = _indexTable.size() - 1;
+    auto slot = hash & mask;
+    while (_indexTable[slot] != 0) {
+        const std::size_t existingIndex = _indexTable[slot] - 1;
+        if (_nameHashes[existingIndex] == hash && _valueList[existingIndex]->nameImpl() == name) {
+            break; // replace the existing entry.
+        }
+        slot = (slot + 1) & mask;
+    }
+    _indexTable[slot] = static_cast<uint32_t>(index + 1);
+}
+
+
+void ValueMap::rebuildIndex() {
+    _nameHashes.clear();
+    _nameHashes.reserve(_valueList.size());
+    for (const auto &value : _valueList) {
+        _nameHashes.push_back(value->nameImpl().hash());
+    }
+    rebuildIndexTable();
+}
+
+
+void ValueMap::rebuildIndexTable() {
+    if (_valueList.size() <= cLinearScanLimit) {
+        IndexTable{}.swap(_indexTable);
+        return;
+    }
+    _indexTable.assign(std::bit_ceil(_valueList.size() * 2), 0);
+    for (std::size_t index = 0; index < _valueList.size(); ++index) {
+        insertIntoIndexTable(index);
     }
 }
 
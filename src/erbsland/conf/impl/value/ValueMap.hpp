@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
@@ -6,7 +6,8 @@
 #include "../../NamePath.hpp"
 #include "../../ValueIterator.hpp"
 
-#include <unordered_map>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 
@@ -15,10 +16,22 @@ namespace erbsland::conf::impl {
 
 /// A map of values.
 ///
+/// The values are stored in a list, in the order of their definition. For each value, the hash of its name is
+/// cached in a parallel list. Most sections have only a few values, and for these, a name is found by a linear
+/// scan over the cached hashes. Only if a map grows beyond `cLinearScanLimit` values, an additional open-addressing
+/// table with the indexes of the values is built.
+///
+/// @tested `ValueMapTest`
+///
 class ValueMap {
 public:
     using List = std::vector<ValuePtr>;
-    using Map = std::unordered_map<Name, ValuePtr>;
+    using HashList = std::vector<std::size_t>;
+    using IndexTable = std::vector<uint32_t>;
+
+    /// The maximum number of values that are searched using a linear scan.
+    ///
+    constexpr static std::size_t cLinearScanLimit = 16;
 
 public:
     /// Create a new value map, from a list of unnamed values.
@@ -46,7 +59,7 @@ public:
     void addValue(const ValuePtr &value);
     void removeDefaultValues();
     [[nodiscard]] auto valueList() const noexcept -> const List& { return _valueList; }
-    [[nodiscard]] auto valueMap() const noexcept -> const Map& { return _valueMap; }
+    [[nodiscard]] auto hasIndexTable() const noexcept -> bool { return !_indexTable.empty(); }
     void setParent(const conf::ValuePtr &parent);
 
 public:
@@ -57,10 +70,36 @@ public:
     [[nodiscard]] auto valueImpl(const Name &name) const -> ValuePtr;
     [[nodiscard]] auto valueImpl(std::size_t index) const -> ValuePtr;
 
+private:
+    /// Get the index of the value with the given name.
+    ///
+    /// If there are multiple values with the same name, the index of the last one is returned.
+    ///
+    /// @return The index of the value, or `cNotFound` if there is no such value.
+    ///
+    [[nodiscard]] auto findIndex(const Name &name) const noexcept -> std::size_t;
+
+    /// Add the value with the given index to the index table.
+    ///
+    void insertIntoIndexTable(std::size_t index) noexcept;
+
+    /// Rebuild the hashes and the index table for all values.
+    ///
+    void rebuildIndex();
+
+    /// Rebuild the index table for all values, or remove it if it is not required.
+    ///
+    void rebuildIndexTable();
+
+    /// The value returned by `findIndex()` if no value was found.
+    ///
+    constexpr static std::size_t cNotFound = std::numeric_limits<std::size_t>::max();
+
 private:
     bool _textIndexesAllowed{false}; ///< Whether text indexes are allowed.
     List _valueList; ///< The list with the values in order of their definition.
-    Map _valueMap; ///< A map with the names of the values.
+    HashList _nameHashes; ///< The hashes of the names, in the same order as `_valueList`.
+    IndexTable _indexTable; ///< Open-addressing table with `index + 1` of the values, or empty for small maps.
 };
 
 
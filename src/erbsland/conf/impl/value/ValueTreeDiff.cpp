@@ -0,0 +1,225 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "ValueTreeDiff.hpp"
+
+
+#include "BytesValue.hpp"
+#include "Document.hpp"
+#include "ValueWithConvertibleType.hpp"
+#include "ValueWithNativeType.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace erbsland::conf::impl {
+
+
+auto ValueTreeDiff::compare(const conf::ConstValuePtr &oldValue, const conf::ConstValuePtr &newValue) -> EntryList {
+    _entries.clear();
+    if (oldValue == newValue) {
+        return {};
+    }
+    const auto &rootValue = (newValue != nullptr) ? *newValue : *oldValue;
+    _namePath = rootValue.namePath();
+    if (oldValue == nullptr || newValue == nullptr) {
+        // Compare with an empty document, so each child is listed as added or removed.
+        const auto change = (oldValue == nullptr) ? Change::Added : Change::Removed;
+        for (const auto &childValue : children(rootValue)) {
+            _namePath.append(childValue->nameImpl());
+            addEntry(
+                change,
+                (change == Change::Removed) ? childValue : ValuePtr{},
+                (change == Change::Added) ? childValue : ValuePtr{});
+            _namePath.popBack();
+        }
+        return std::move(_entries);
+    }
+    if (isComparableStructure(oldValue->type(), newValue->type())) {
+        if (newValue->type() == ValueType::SectionList) {
+            compareSectionLists(*oldValue, *newValue);
+        } else {
+            compareMaps(*oldValue, *newValue);
+        }
+    } else if (oldValue->type() != newValue->type() || !isEqual(*oldValue, *newValue)) {
+        _entries.emplace_back(DocumentDiff::Entry{
+            .change = Change::Changed,
+            .namePath = _namePath,
+            .oldValue = oldValue,
+            .newValue = newValue});
+    }
+    return std::move(_entries);
+}
+
+
+auto ValueTreeDiff::isEqual(const conf::Value &oldValue, const conf::Value &newValue) -> bool {
+    if (&oldValue == &newValue) {
+        return true;
+    }
+    const auto type = newValue.type();
+    if (oldValue.type() != type) {
+        return false;
+    }
+    if (type.isScalar()) {
+        return isEqualScalar(oldValue, newValue);
+    }
+    const auto &oldChildren = children(oldValue);
+    const auto &newChildren = children(newValue);
+    if (oldChildren.size() != newChildren.size()) {
+        return false;
+    }
+    // The children have the same names, so their content hashes reject most different children quickly.
+    const auto isEqualChild = [](const ValuePtr &oldChild, const ValuePtr &newChild) -> bool {
+        return oldChild != nullptr && oldChild->contentHash() == newChild->contentHash()
+            && isEqual(*oldChild, *newChild);
+    };
+    if (type.isMap()) {
+        return std::ranges::all_of(newChildren, [&](const ValuePtr &newChild) -> bool {
+            return isEqualChild(child(oldValue, newChild->nameImpl()), newChild);
+        });
+    }
+    for (std::size_t i = 0; i < newChildren.size(); ++i) {
+        if (!isEqualChild(oldChildren[i], newChildren[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+void ValueTreeDiff::compareMaps(const conf::Value &oldMap, const conf::Value &newMap) {
+    const auto &newChildren = children(newMap);
+    for (const auto &newChild : newChildren) {
+        _namePath.append(newChild->nameImpl());
+        if (const auto oldChild = child(oldMap, newChild->nameImpl()); oldChild != nullptr) {
+            compareValues(oldChild, newChild);
+        } else {
+            addEntry(Change::Added, {}, newChild);
+        }
+        _namePath.popBack();
+    }
+    for (const auto &oldChild : children(oldMap)) {
+        if (child(newMap, oldChild->nameImpl()) == nullptr) {
+            _namePath.append(oldChild->nameImpl());
+            addEntry(Change::Removed, oldChild, {});
+            _namePath.popBack();
+        }
+    }
+}
+
+
+void ValueTreeDiff::compareSectionLists(const conf::Value &oldList, const conf::Value &newList) {
+    const auto &oldChildren = children(oldList);
+    const auto &newChildren = children(newList);
+    const auto commonSize = std::min(oldChildren.size(), newChildren.size());
+    for (std::size_t i = 0; i < commonSize; ++i) {
+        _namePath.append(newChildren[i]->nameImpl());
+        compareValues(oldChildren[i], newChildren[i]);
+        _namePath.popBack();
+    }
+    for (std::size_t i = commonSize; i < newChildren.size(); ++i) {
+        _namePath.append(newChildren[i]->nameImpl());
+        addEntry(Change::Added, {}, newChildren[i]);
+        _namePath.popBack();
+    }
+    for (std::size_t i = commonSize; i < oldChildren.size(); ++i) {
+        _namePath.append(oldChildren[i]->nameImpl());
+        addEntry(Change::Removed, oldChildren[i], {});
+        _namePath.popBack();
+    }
+}
+
+
+void ValueTreeDiff::compareValues(const ValuePtr &oldValue, const ValuePtr &newValue) {
+    // Both values have the same name, so equal content hashes mean equal subtrees.
+    if (oldValue == newValue || oldValue->contentHash() == newValue->contentHash()) {
+        return;
+    }
+    const auto oldType = oldValue->type();
+    const auto newType = newValue->type();
+    if (isComparableStructure(oldType, newType)) {
+        if (newType == ValueType::SectionList) {
+            compareSectionLists(*oldValue, *newValue);
+        } else {
+            compareMaps(*oldValue, *newValue);
+        }
+        return;
+    }
+    // Equal values have equal content hashes, so these values differ.
+    addEntry(Change::Changed, oldValue, newValue);
+}
+
+
+void ValueTreeDiff::addEntry(const Change change, const ValuePtr &oldValue, const ValuePtr &newValue) {
+    _entries.emplace_back(DocumentDiff::Entry{
+        .change = change,
+        .namePath = _namePath,
+        .oldValue = oldValue,
+        .newValue = newValue});
+}
+
+
+auto ValueTreeDiff::isComparableStructure(const ValueType oldType, const ValueType newType) noexcept -> bool {
+    const auto isNameMap = [](const ValueType type) -> bool {
+        return type == ValueType::SectionWithNames || type == ValueType::IntermediateSection
+            || type == ValueType::Document;
+    };
+    if (isNameMap(oldType) && isNameMap(newType)) {
+        return true;
+    }
+    return oldType == newType && (newType == ValueType::SectionWithTexts || newType == ValueType::SectionList);
+}
+
+
+auto ValueTreeDiff::isEqualScalar(const conf::Value &oldValue, const conf::Value &newValue) -> bool {
+    // The types were compared by the caller, and all values in a document are implementation values.
+    switch (newValue.type()) {
+    case ValueType::Integer:
+        return static_cast<const IntegerValue&>(oldValue).rawStorage()
+            == static_cast<const IntegerValue&>(newValue).rawStorage();
+    case ValueType::Boolean:
+        return static_cast<const BooleanValue&>(oldValue).rawStorage()
+            == static_cast<const BooleanValue&>(newValue).rawStorage();
+    case ValueType::Float: {
+        const auto oldFloat = static_cast<const FloatValue&>(oldValue).rawStorage();
+        const auto newFloat = static_cast<const FloatValue&>(newValue).rawStorage();
+        return oldFloat == newFloat || (std::isnan(oldFloat) && std::isnan(newFloat));
+    }
+    case ValueType::Text:
+        return static_cast<const TextValue&>(oldValue).rawStorage()
+            == static_cast<const TextValue&>(newValue).rawStorage();
+    case ValueType::Date:
+        return static_cast<const DateValue&>(oldValue).rawStorage()
+            == static_cast<const DateValue&>(newValue).rawStorage();
+    case ValueType::Bytes:
+        return static_cast<const BytesValue&>(oldValue).rawStorage()
+            == static_cast<const BytesValue&>(newValue).rawStorage();
+    case ValueType::RegEx:
+        return static_cast<const RegExValue&>(oldValue).rawStorage()
+            == static_cast<const RegExValue&>(newValue).rawStorage();
+    default:
+        // Times, date-times and time-deltas compare equal with different offsets or units.
+        // Compare their text, so a change of the offset or unit is reported.
+        return oldValue.toTextRepresentation() == newValue.toTextRepresentation();
+    }
+}
+
+
+auto ValueTreeDiff::children(const conf::Value &value) noexcept -> const std::vector<ValuePtr>& {
+    if (value.type() == ValueType::Document) {
+        return static_cast<const Document&>(value).childrenImpl();
+    }
+    return static_cast<const Value&>(value).childrenImpl();
+}
+
+
+auto ValueTreeDiff::child(const conf::Value &map, const Name &name) noexcept -> ValuePtr {
+    if (map.type() == ValueType::Document) {
+        return static_cast<const Document&>(map).valueImpl(name);
+    }
+    return static_cast<const Value&>(map).valueImpl(name);
+}
+
+
+}
+
@@ -0,0 +1,76 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "Value.hpp"
+
+#include "../../DocumentDiff.hpp"
+
+#include <vector>
+
+
+namespace erbsland::conf::impl {
+
+
+/// Compares two value trees by walking both trees in parallel.
+///
+/// Sections and documents are matched by name, using the name index of each section. Section lists are matched
+/// by index. Values with the same name-path are compared using their cached content hashes, so subtrees with
+/// equal hashes are skipped, without visiting their values.
+///
+/// @tested `DocumentDiffTest`
+///
+class ValueTreeDiff final {
+public:
+    using Change = DocumentDiff::Change;
+    using EntryList = DocumentDiff::EntryList;
+
+public:
+    ValueTreeDiff() = default;
+    ~ValueTreeDiff() = default;
+
+    // prevent copy and assign.
+    ValueTreeDiff(const ValueTreeDiff&) = delete;
+    auto operator=(const ValueTreeDiff&) -> ValueTreeDiff& = delete;
+
+public:
+    /// Compare two value trees.
+    ///
+    /// @param oldValue The old root value, or `nullptr`.
+    /// @param newValue The new root value, or `nullptr`.
+    /// @return The list of differences.
+    ///
+    [[nodiscard]] auto compare(const conf::ConstValuePtr &oldValue, const conf::ConstValuePtr &newValue) -> EntryList;
+
+    /// Test if two values have the same type and content, including all children.
+    ///
+    [[nodiscard]] static auto isEqual(const conf::Value &oldValue, const conf::Value &newValue) -> bool;
+
+private:
+    /// Compare the children of two maps, matching them by name.
+    void compareMaps(const conf::Value &oldMap, const conf::Value &newMap);
+    /// Compare the children of two section lists, matching them by index.
+    void compareSectionLists(const conf::Value &oldList, const conf::Value &newList);
+    /// Compare two values with the same name-path.
+    void compareValues(const ValuePtr &oldValue, const ValuePtr &newValue);
+    /// Add an entry for the current name-path.
+    void addEntry(Change change, const ValuePtr &oldValue, const ValuePtr &newValue);
+
+    /// Test if the children of two values can be compared.
+    [[nodiscard]] static auto isComparableStructure(ValueType oldType, ValueType newType) noexcept -> bool;
+    /// Test if two scalar values with the same type are equal.
+    [[nodiscard]] static auto isEqualScalar(const conf::Value &oldValue, const conf::Value &newValue) -> bool;
+    /// Access the children of a document or value.
+    [[nodiscard]] static auto children(const conf::Value &value) noexcept -> const std::vector<ValuePtr>&;
+    /// Get a child of a map by name.
+    [[nodiscard]] static auto child(const conf::Value &map, const Name &name) noexcept -> ValuePtr;
+
+private:
+    NamePath _namePath; ///< The name-path of the currently compared values.
+    EntryList _entries; ///< The collected differences.
+};
+
+
+}
+
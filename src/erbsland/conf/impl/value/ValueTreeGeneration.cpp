@@ -0,0 +1,47 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "ValueTreeGeneration.hpp"
+
+
+#include "Document.hpp"
+
+
+namespace erbsland::conf::impl {
+
+
+auto ValueTreeGeneration::currentFor(const conf::Value &value) noexcept -> uint64_t {
+    auto root = value.parent();
+    if (root == nullptr) {
+        return forRoot(value).current();
+    }
+    for (auto parent = root->parent(); parent != nullptr; parent = root->parent()) {
+        root = std::move(parent);
+    }
+    return forRoot(*root).current();
+}
+
+
+void ValueTreeGeneration::advanceFor(const conf::Value &value) noexcept {
+    auto root = value.parent();
+    if (root == nullptr) {
+        forRoot(value).advance();
+        return;
+    }
+    for (auto parent = root->parent(); parent != nullptr; parent = root->parent()) {
+        root = std::move(parent);
+    }
+    forRoot(*root).advance();
+}
+
+
+auto ValueTreeGeneration::forRoot(const conf::Value &root) noexcept -> ValueTreeGeneration& {
+    if (root.isDocument()) {
+        // All documents in a value tree are implementation values.
+        return static_cast<const Document&>(root).treeGeneration();
+    }
+    static ValueTreeGeneration detachedTrees;
+    return detachedTrees;
+}
+
+
+}
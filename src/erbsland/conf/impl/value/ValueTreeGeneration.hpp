@@ -0,0 +1,79 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "../../fwd.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace erbsland::conf::impl {
+
+
+/// A counter that changes whenever a published value tree is modified.
+///
+/// After parsing, a document is only modified by the validation, which removes and adds default values.
+/// Cached lookups, like the ones in `ValueHandle`, and cached content hashes store the generation and are
+/// discarded if it changed.
+///
+/// Each document owns the generation of its value tree, so modifying one document does not discard the caches
+/// of other documents. Value trees without a document share one generation. New generations are taken from a
+/// process-wide sequence, so a generation never matches a cache entry that was stored for another tree.
+///
+/// @tested `ValueHandleTest`, `ValueContentHashTest`
+///
+class ValueTreeGeneration final {
+public:
+    /// Create a new generation.
+    ValueTreeGeneration() noexcept : _generation{nextGeneration()} {}
+    /// Default destructor.
+    ~ValueTreeGeneration() = default;
+
+    // prevent copy and assign.
+    ValueTreeGeneration(const ValueTreeGeneration&) = delete;
+    auto operator=(const ValueTreeGeneration&) -> ValueTreeGeneration& = delete;
+
+public:
+    /// Get the current generation.
+    ///
+    [[nodiscard]] auto current() const noexcept -> uint64_t {
+        return _generation.load(std::memory_order_acquire);
+    }
+
+    /// Advance the generation before a value tree is modified.
+    ///
+    void advance() noexcept {
+        _generation.store(nextGeneration(), std::memory_order_release);
+    }
+
+    /// Get the current generation of the value tree that contains a value.
+    ///
+    /// @param value Any value in the value tree.
+    /// @return The current generation of the tree.
+    ///
+    [[nodiscard]] static auto currentFor(const conf::Value &value) noexcept -> uint64_t;
+
+    /// Advance the generation of the value tree that contains a value.
+    ///
+    /// @param value Any value in the value tree.
+    ///
+    static void advanceFor(const conf::Value &value) noexcept;
+
+private:
+    /// Get the generation that is owned by the root of a value tree.
+    [[nodiscard]] static auto forRoot(const conf::Value &root) noexcept -> ValueTreeGeneration&;
+
+    /// Take the next generation from the process-wide sequence.
+    [[nodiscard]] static auto nextGeneration() noexcept -> uint64_t {
+        return _sequence.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> _generation; ///< The current generation.
+    inline static std::atomic<uint64_t> _sequence{1}; ///< The next unused generation.
+};
+
+
+}
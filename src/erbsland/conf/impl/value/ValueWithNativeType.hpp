@@ -86,6 +86,7 @@ public:
     using ValueWithNativeType::ValueWithNativeType;
     [[nodiscard]] auto asText() const noexcept -> String override { return _value; }
     [[nodiscard]] auto asTextOrThrow() const -> String override { return _value; }
+    [[nodiscard]] auto textView() const noexcept -> std::u8string_view override { return _value.raw(); }
     [[nodiscard]] auto deepCopy() const -> ValuePtr override { return std::make_shared<TextValue>(_value); }
 };
 
@@ -13,6 +13,8 @@
 #include "../../EscapeMode.hpp"
 
 #include <algorithm>
+#include <span>
+#include <string_view>
 #include <unordered_set>
 
 
@@ -20,19 +22,27 @@ namespace erbsland::conf::impl {
 
 
 void CharsConstraint::validateText(const ValidationContext &context, const String &value) const {
-    std::size_t index = 0;
-    U8StringView{value}.forEachChar([&](const Char character) -> void {
-        const auto inRanges = _charRanges.contains(character);
-        const auto isInvalid = isNegated() ? inRanges : !inRanges;
-        if (isInvalid) {
+    const auto expected = !isNegated();
+    // Identifiers and host names are mostly ASCII, so test the ASCII prefix without decoding the text.
+    const auto data = std::as_bytes(std::span{value.raw()});
+    std::size_t index = _charSet.countAsciiPrefix(data, expected);
+    if (index == data.size()) {
+        return;
+    }
+    U8StringView{std::u8string_view{value.raw()}.substr(index)}.forEachChar([&](const Char character) -> void {
+        if (context.hasFailed()) {
+            return; // only report the first forbidden character.
+        }
+        if (_charSet.contains(character) != expected) {
             if (context.rule != nullptr && context.rule->isSecret()) {
-                throwValidationError(u8format(
+                context.fail(u8format(
                     u8"The text contains a forbidden character at position {} in a secret value",
                     index));
+                return;
             }
             String chText;
             character.appendEscaped(chText, EscapeMode::ErrorText);
-            throwValidationError(u8format(
+            context.fail(u8format(
                 u8"The text contains a forbidden character at position {}: \"{}\"",
                 index,
                 chText));
@@ -7,6 +7,7 @@
 #include "ConstraintHandlerContext.hpp"
 
 #include "../char/CharRanges.hpp"
+#include "../char/CharSet.hpp"
 
 #include <vector>
 
@@ -19,7 +20,7 @@ class CharsConstraint final : public Constraint {
 
 public:
     explicit CharsConstraint(const std::vector<String> &expectedValue) {
-        _charRanges = parseTextRanges(expectedValue);
+        _charSet = CharSet{parseTextRanges(expectedValue)};
         setType(vr::ConstraintType::Chars);
     }
 
@@ -47,7 +48,7 @@ private:
 
 
 private:
-    CharRanges _charRanges;
+    CharSet _charSet; ///< The allowed (or forbidden) characters, compiled when the rules are created.
 };
 
 
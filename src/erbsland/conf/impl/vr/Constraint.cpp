@@ -53,22 +53,35 @@ void Constraint::setLocation(const Location &newLocation) noexcept {
 
 
 void Constraint::validate(const ValidationContext &context) const {
-    try {
-        if (context.target == ValidationTarget::Value) {
-            validateValue(context);
-        } else {
-            validateName(context);
-        }
-    } catch (const Error &error) {
-        if (error.location().isUndefined()) {
-            // Add the name path and location to the error if it is missing.
-            throw error.withNamePathAndLocation(context.value->namePath(), context.value->location());
-        }
-        throw;
+    if (auto error = check(context); error.has_value()) {
+        throw std::move(error).value();
     }
 }
 
 
+auto Constraint::check(const ValidationContext &context) const -> std::optional<Error> {
+    context.failureMessage.reset();
+    if (context.target == ValidationTarget::Value) {
+        validateValue(context);
+    } else {
+        validateText(context, context.value->name().asText());
+    }
+    if (!context.hasFailed()) {
+        return std::nullopt;
+    }
+    auto message = std::move(context.failureMessage).value();
+    context.failureMessage.reset();
+    if (context.target == ValidationTarget::Name) {
+        message = String{u8"Value name validation failed: "} + message;
+    }
+    return Error{
+        ErrorCategory::Validation,
+        std::move(message),
+        context.value->namePath(),
+        context.value->location()};
+}
+
+
 void Constraint::validateValue(const ValidationContext &context) const {
     const auto &value = context.value;
     switch (value->type().raw()) {
@@ -124,14 +137,6 @@ void Constraint::validateValue(const ValidationContext &context) const {
 }
 
 
-void Constraint::validateName(const ValidationContext &context) const {
-    try {
-        validateText(context, context.value->name().asText());
-    } catch (const Error &error) {
-        throw error.withMessagePrefix(u8"Value name validation failed: ");
-    }
-}
-
 void Constraint::validateInteger(
     [[maybe_unused]] const ValidationContext &context,
     [[maybe_unused]] const Integer value) const {
@@ -3,9 +3,12 @@
 #pragma once
 
 
+#include "../../Error.hpp"
 #include "../../Value.hpp"
 #include "../../vr/Constraint.hpp"
 
+#include <optional>
+
 
 namespace erbsland::conf::impl {
 
@@ -35,7 +38,11 @@ public: // implement vr::Constraint
 
     // the internal interface.
     /// Validate a value using a context.
-    virtual void validate(const ValidationContext &context) const;
+    /// @throws Error (Validation) if the value does not meet this constraint.
+    void validate(const ValidationContext &context) const;
+    /// Check a value using a context, without throwing an exception for a failed constraint.
+    /// @return The validation error, or an empty optional if the value meets this constraint.
+    [[nodiscard]] auto check(const ValidationContext &context) const -> std::optional<Error>;
     /// Set the name of this constraint.
     /// @param name The new name.
     void setName(String name);
@@ -57,10 +64,10 @@ public: // implement vr::Constraint
 private:
     /// Validate the value target for this context.
     void validateValue(const ValidationContext &context) const;
-    /// Validate the name target for this context.
-    void validateName(const ValidationContext &context) const;
 
 protected:
+    // The `validate...` methods report a failure using `ValidationContext::fail()`.
+
     /// Validate an integer value.
     /// @param context The validation context to use.
     /// @param value The integer value to validate.
@@ -8,10 +8,10 @@
 
 #include "../utilities/InternalError.hpp"
 #include "../value/ValueHelper.hpp"
+#include "../value/ValueTreeGeneration.hpp"
 
 #include <ranges>
 #include <set>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -19,15 +19,22 @@
 namespace erbsland::conf::impl {
 
 
-DocumentValidator::DocumentValidator(RulePtr root, conf::ValuePtr value, const Integer version)
+DocumentValidator::DocumentValidator(
+    ValidationPlanPtr plan,
+    conf::ValuePtr value,
+    vr::ValidationReport *report,
+    Scratch *scratch)
 :
-    _root{std::move(root)},
+    _plan{std::move(plan)},
     _value{std::move(value)},
-    _version{version} {
+    _report{report},
+    _scratch{scratch != nullptr ? *scratch : _ownScratch} {
 
-    ERBSLAND_CONF_REQUIRE_SAFETY(_root != nullptr, "The root rule must not be null");
+    ERBSLAND_CONF_REQUIRE_SAFETY(_plan != nullptr, "The validation plan must not be null");
     ERBSLAND_CONF_REQUIRE_SAFETY(_value != nullptr, "The value must not be null");
-    ERBSLAND_CONF_REQUIRE_DEBUG(_root->type() == vr::RuleType::Section, "The root rule must be a section");
+    ERBSLAND_CONF_REQUIRE_DEBUG(
+        _plan->rule(ValidationPlan::cRootRule)->type() == vr::RuleType::Section,
+        "The root rule must be a section");
     ERBSLAND_CONF_REQUIRE_DEBUG(
         _value->isDocument() || _value->isSectionWithNames(),
         "The value must be a document or a section with names");
@@ -35,37 +42,43 @@ DocumentValidator::DocumentValidator(RulePtr root, conf::ValuePtr value, const I
 
 
 void DocumentValidator::validate() {
-    if (_root->empty()) {
+    if (_plan->node(ValidationPlan::cRootRule).childCount == 0) {
         return;
     }
 
+    // Default values are removed and added below, so all cached lookups into the value tree become invalid.
+    ValueTreeGeneration::advanceFor(*_value);
     validatePass1();
     validatePass2();
+    // Discard content hashes that were calculated while the tree was modified.
+    ValueTreeGeneration::advanceFor(*_value);
 }
 
 
 void DocumentValidator::validatePass1() {
 
     // initialize the use-indexes flag with root key definitions
-    _useIndexes = _root->hasKeyDefinitions();
+    _useIndexes = _plan->rule(ValidationPlan::cRootRule)->hasKeyDefinitions();
 
-    std::vector<Frame> stack;
+    auto &stack = _scratch.stack;
+    stack.clear();
     stack.reserve(32);
-    stack.emplace_back(Frame{.valueNode=_value, .ruleNode=_root});
+    stack.emplace_back(Frame{.valueNode=_value, .ruleId=ValidationPlan::cRootRule});
 
     while (!stack.empty()) {
-        auto [value, rule] = stack.back();
+        auto [value, ruleId] = stack.back();
         stack.pop_back();
         ERBSLAND_CONF_REQUIRE_SAFETY(value != nullptr, "The value node must not be null");
-        ERBSLAND_CONF_REQUIRE_SAFETY(rule != nullptr, "The rule node must not be null");
+        ERBSLAND_CONF_REQUIRE_SAFETY(ruleId != ValidationPlan::cNoRule, "The rule node must not be null");
         if (value != _value) { // do not validate the root value.
             const auto valueImpl = getImplValue(value);
             // Drop defaults from previous validations for this node before evaluating constraints and descendants.
             valueImpl->removeDefaultValues();
-            rule = validate(rule, valueImpl);
-            if (rule == nullptr) { // = skip this branch (not-validated or no matching alternative)
+            ruleId = validate(ruleId, valueImpl);
+            if (ruleId == ValidationPlan::cNoRule) { // = skip this branch (not-validated or no matching alternative)
                 continue; // skip this branch
             }
+            const auto &rule = _plan->rule(ruleId);
             valueImpl->setValidationRule(rule);
             if (rule->type() == vr::RuleType::ValueList || rule->type() == vr::RuleType::ValueMatrix) {
                 // Value list and matrix entries are already validated at this point.
@@ -73,26 +86,35 @@ void DocumentValidator::validatePass1() {
                 continue;
             }
         } else { // for the root value, only remove defaults and assign the root rule to mark it as validated.
-            callImplValueFn(value, [&rule](auto &&valueImpl) -> void {
+            callImplValueFn(value, [this, ruleId](auto &&valueImpl) -> void {
                 valueImpl->removeDefaultValues();
-                valueImpl->setValidationRule(rule);
+                valueImpl->setValidationRule(_plan->rule(ruleId));
             });
         }
         // Descend into the child values:
         // Add in reverse order to preserve the original order of validation.
-        std::unordered_set<RulePtr> rulesWithMatchingValues;
+        const auto &node = _plan->node(ruleId);
+        const bool tracksMatches = !node.requiredChildren.empty();
+        if (tracksMatches) {
+            _scratch.matchedChildren.assign(node.childCount, false);
+        }
         for (const auto &child : std::ranges::reverse_view(*value)) {
             auto nextValue = getImplValue(child);
-            auto nextRule = nextRuleForValue(rule, nextValue); // may throw
-            rulesWithMatchingValues.insert(nextRule);
-            stack.emplace_back(Frame{.valueNode=std::move(nextValue), .ruleNode=std::move(nextRule)});
+            const auto nextRuleId = nextRuleForValue(ruleId, nextValue);
+            if (nextRuleId == ValidationPlan::cNoRule) {
+                continue; // the unexpected value was reported, skip this branch.
+            }
+            if (tracksMatches) {
+                _scratch.matchedChildren[_plan->childPosition(ruleId, nextRuleId)] = true;
+            }
+            stack.emplace_back(Frame{.valueNode=std::move(nextValue), .ruleId=nextRuleId});
         }
-        // Now handle the rules that had no matching values.
-        for (const auto &childRule : rule->childrenImpl()) {
-            if (rulesWithMatchingValues.contains(childRule)) {
+        // Now handle the required rules that had no matching values.
+        for (const auto childRuleId : node.requiredChildren) {
+            if (_scratch.matchedChildren[_plan->childPosition(ruleId, childRuleId)]) {
                 continue; // ignore all rules we already matched with values.
             }
-            handleMissingValues(childRule, value);
+            handleMissingValues(childRuleId, value);
         }
     }
 }
@@ -120,7 +142,7 @@ void DocumentValidator::validatePass2() {
 
     std::vector<Pass2Frame> stack;
     stack.reserve(32);
-    stack.emplace_back(Pass2Frame::createEnter(_value, _root));
+    stack.emplace_back(Pass2Frame::createEnter(_value, _plan->rule(ValidationPlan::cRootRule)));
     KeyIndexList keyIndexStack;
 
     while (!stack.empty()) {
@@ -236,26 +258,27 @@ auto DocumentValidator::buildKeyIndexAndValidateUniqueness(
         auto success = keyIndex->tryAddKey(Key{keyElements});
         if (!success) {
             if (valuePaths.size() == 1) {
-                throwValidationError(u8format(
+                reportError(validationError(u8format(
                     u8"The key '{}' is not unique in the list '{}'. Found a duplicate",
                     valuePaths.front().toText(),
                     listValue->namePath()),
                     entry->namePath(),
-                    entry->location());
+                    entry->location()));
+                continue;
             }
             StringList keyNamePathsForError;
             for (const auto &valuePath : valuePaths) {
                 keyNamePathsForError.emplace_back(valuePath.toText());
             }
-            throwValidationError(u8format(
+            reportError(validationError(u8format(
                 u8"The combines keys '{}' are not unique in the list '{}'. Found a duplicate",
                 String{u8"', '"}.join(keyNamePathsForError),
                 listValue->namePath()),
                 entry->namePath(),
-                entry->location());
+                entry->location()));
         }
     }
-    return keyIndex; // At this point, no duplicates were found and the index was successfully created.
+    return keyIndex; // At this point, all duplicates were reported and the index was successfully created.
 }
 
 
@@ -307,12 +330,13 @@ void DocumentValidator::validateKeyConstraint(
     }
     if (!foundKey) {
         if (keyConstraint->hasCustomError()) {
-            throwValidationError(keyConstraint->customError(), value->namePath(), value->location());
+            reportError(validationError(keyConstraint->customError(), value->namePath(), value->location()));
+            return;
         }
-        throwValidationError(
+        reportError(validationError(
             u8"This value must refer to an existing key, but no matching entry was found",
             value->namePath(),
-            value->location());
+            value->location()));
     }
 }
 
@@ -339,7 +363,8 @@ void DocumentValidator::validateDependencies(const conf::ValuePtr &value, const
         }
         if (!dependency->mode().isValid(hasSource, hasTarget)) {
             if (dependency->hasErrorMessage()) {
-                throwValidationError(dependency->errorMessage(), value->namePath(), value->location());
+                reportError(validationError(dependency->errorMessage(), value->namePath(), value->location()));
+                continue;
             }
 
             String message;
@@ -380,10 +405,18 @@ void DocumentValidator::validateDependencies(const conf::ValuePtr &value, const
                 message = u8"Unknown dependency mode";
                 break;
             }
-            throwValidationError(message, value->namePath(), value->location());
+            reportError(validationError(message, value->namePath(), value->location()));
         }
     }
 }
 
 
+void DocumentValidator::reportError(Error error) {
+    if (_report == nullptr) {
+        throw std::move(error);
+    }
+    _report->addError(std::move(error));
+}
+
+
 }
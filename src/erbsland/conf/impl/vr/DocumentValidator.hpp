@@ -5,9 +5,13 @@
 
 #include "KeyIndex.hpp"
 #include "Rule.hpp"
+#include "ValidationPlan.hpp"
 
 #include "../value/Value.hpp"
 
+#include "../../vr/ValidationReport.hpp"
+
+#include <optional>
 #include <vector>
 
 
@@ -16,20 +20,44 @@ namespace erbsland::conf::impl {
 
 /// The document validator.
 /// Used by the validation rules to validate documents and value trees.
+///
+/// The validator walks the value tree along a precompiled `ValidationPlan`. All rule lookups, version checks
+/// and the tracking of matched rules use the dense rule IDs of the plan.
+///
+/// *Multithreading*: The validator only reads the plan and the rules. Multiple validators can share a plan and
+/// run in parallel, as long as each validator uses its own value tree and scratch buffers.
+///
+/// Without a report, the first validation error is thrown as exception. With a report, all errors are added
+/// to the report and the validation continues. In both modes, constraints and alternatives are checked without
+/// throwing exceptions.
 class DocumentValidator final {
 private:
     /// Frame for the validation stack.
     struct Frame {
         conf::ValuePtr valueNode;
-        RulePtr ruleNode;
+        ValidationPlan::RuleId ruleId;
+    };
+
+    using RuleId = ValidationPlan::RuleId;
+
+public:
+    /// Buffers that are reused if one thread validates multiple documents.
+    struct Scratch {
+        std::vector<Frame> stack; ///< The stack for the first pass.
+        std::vector<bool> matchedChildren; ///< Marks the child rules of a section that matched a value.
     };
 
 public:
     /// Create a new validator instance.
-    /// @param root The root of the rule tree for validation.
+    /// @param plan The validation plan, compiled for the version of the document format to validate.
     /// @param value The root value to validate.
-    /// @param version The version of the document format to validate.
-    DocumentValidator(RulePtr root, conf::ValuePtr value, Integer version);
+    /// @param report An optional report to collect all errors, instead of throwing the first one.
+    /// @param scratch Optional scratch buffers to reuse. If omitted, the validator uses its own buffers.
+    DocumentValidator(
+        ValidationPlanPtr plan,
+        conf::ValuePtr value,
+        vr::ValidationReport *report = nullptr,
+        Scratch *scratch = nullptr);
 
     // defaults and deletions
     ~DocumentValidator() = default;
@@ -52,17 +80,17 @@ private:
     void validatePass2();
 
     /// Validate the given value against the given rule.
-    /// @param rule The rule to validate against.
+    /// @param ruleId The rule to validate against.
     /// @param value The value to validate.
-    /// @return The next parent rule to validate the child values against, or nullptr if no children
-    ///     should be validated (because the branch is marked as not validated).
-    [[nodiscard]] auto validate(const RulePtr &rule, const ValuePtr &value) -> RulePtr;
+    /// @return The next parent rule to validate the child values against, or `cNoRule` if no children
+    ///     should be validated (because the branch is marked as not validated, or the value is invalid).
+    [[nodiscard]] auto validate(RuleId ruleId, const ValuePtr &value) -> RuleId;
 
     /// Handle missing values.
-    /// @param rule The rule that has a missing value.
+    /// @param ruleId The rule that has a missing value.
     /// @param parentValue The parent value where the value is missing.
     ///     This can be any node, including the document itself.
-    void handleMissingValues(const RulePtr &rule, const conf::ValuePtr &parentValue);
+    void handleMissingValues(RuleId ruleId, const conf::ValuePtr &parentValue);
 
     /// Copy default value.
     /// @param rule The rule with the default value to copy.
@@ -71,49 +99,46 @@ private:
     void copyDefaultValue(const RulePtr &rule, const conf::ValuePtr &parentValue);
 
     /// Handle unvalidated values.
-    /// @param rule The rule to validate against.
+    /// @param ruleId The rule to validate against.
     /// @param value The value to validate.
-    [[nodiscard]] auto handleNotValidatedValues(const RulePtr &rule, const ValuePtr &value) -> RulePtr;
+    [[nodiscard]] auto handleNotValidatedValues(RuleId ruleId, const ValuePtr &value) -> RuleId;
 
     /// Handle alternatives.
-    /// @param rule The rule to validate against.
+    /// @param ruleId The rule to validate against.
     /// @param value The value to validate.
-    [[nodiscard]] auto handleAlternatives(const RulePtr &rule, const ValuePtr &value) -> RulePtr;
+    /// @return The matching alternative, or `cNoRule` if no alternative matched.
+    [[nodiscard]] auto handleAlternatives(RuleId ruleId, const ValuePtr &value) -> RuleId;
 
     /// Handle section lists.
-    /// @param rule The rule to validate against.
+    /// @param ruleId The rule to validate against.
     /// @param value The value to validate.
-    [[nodiscard]] auto handleSectionLists(const RulePtr &rule, const ValuePtr &value) -> RulePtr;
+    [[nodiscard]] auto handleSectionLists(RuleId ruleId, const ValuePtr &value) -> RuleId;
 
     /// Handle value lists or matrices.
-    /// @param rule The rule to validate against.
+    /// @param ruleId The rule to validate against.
     /// @param value The value to validate.
-    /// @return The value rule used to validate the individual values.
-    [[nodiscard]] auto handleValueListOrMatrixPreCheck(
-        const RulePtr &rule,
-        const ValuePtr &value) -> RulePtr;
+    /// @return The value rule used to validate the individual values, or `cNoRule` if the value is invalid.
+    [[nodiscard]] auto handleValueListOrMatrixPreCheck(RuleId ruleId, const ValuePtr &value) -> RuleId;
 
     /// Validate a single value is a list or matrix.
-    /// @param valueRule The rule used to validate the value.
+    /// @param valueRuleId The rule used to validate the value.
     /// @param value The value to validate.
-    void validateListOrMatrixValue(
-        const RulePtr &valueRule,
-        const ValuePtr &value);
+    void validateListOrMatrixValue(RuleId valueRuleId, const ValuePtr &value);
 
     /// Handle value lists.
-    /// @param rule The rule to validate against.
+    /// @param ruleId The rule to validate against.
     /// @param value The value to validate.
-    [[nodiscard]] auto handleValueLists(const RulePtr &rule, const ValuePtr &value) -> RulePtr;
+    [[nodiscard]] auto handleValueLists(RuleId ruleId, const ValuePtr &value) -> RuleId;
 
     /// Handle value matrices.
-    /// @param rule The rule to validate against.
+    /// @param ruleId The rule to validate against.
     /// @param value The value to validate.
-    [[nodiscard]] auto handleValueMatrix(const RulePtr &rule, const ValuePtr &value) -> RulePtr;
+    [[nodiscard]] auto handleValueMatrix(RuleId ruleId, const ValuePtr &value) -> RuleId;
 
     /// Handle regular sections and scalar values.
-    /// @param rule The rule to validate against.
+    /// @param ruleId The rule to validate against.
     /// @param value The value to validate.
-    [[nodiscard]] auto handleCommonValues(const RulePtr &rule, const ValuePtr &value) -> RulePtr;
+    [[nodiscard]] auto handleCommonValues(RuleId ruleId, const ValuePtr &value) -> RuleId;
 
     /// Build all key indexes for a given rule.
     /// @param value The value node that is entered.
@@ -123,8 +148,7 @@ private:
     /// Build a key index and validate the uniqueness of all values.
     /// @param value The value node that is entered which is the base node for the index.
     /// @param keyDefinition The key definition that is used to build the index.
-    /// @return The key index that was built.
-    /// @throws Error if the key index is invalid, or if the key values are not unique.
+    /// @return The key index that was built. Duplicate keys are reported and not added to the index.
     [[nodiscard]] auto buildKeyIndexAndValidateUniqueness(
         const conf::ValuePtr &value,
         const KeyDefinitionPtr &keyDefinition) -> KeyIndexPtr;
@@ -144,23 +168,39 @@ private:
     void validateDependencies(const conf::ValuePtr &value, const RulePtr &rule);
 
     /// Select the matching rule for the given value.
-    /// @param parentRule The parent rule that contains child-rules that should match `value`.
+    /// @param parentRuleId The parent rule that contains child-rules that should match `value`.
     /// @param value The value for which a suitable rule shall be found.
-    /// @return The matching child rule. Never nullptr - will throw on failure.
-    [[nodiscard]] auto nextRuleForValue(const RulePtr &parentRule, const ValuePtr &value) const -> RulePtr;
+    /// @return The matching child rule, or `cNoRule` if the value is unexpected.
+    [[nodiscard]] auto nextRuleForValue(RuleId parentRuleId, const ValuePtr &value) -> RuleId;
 
     /// Validate the name constraints of a rule for the name of a given value.
-    /// @param rule The rule with the name constraints.
+    /// @param ruleId The rule with the name constraints.
     /// @param value The value for which the name constraints shall be validated.
-    static void validateNameConstraints(const RulePtr &rule, const ValuePtr &value) ;
+    /// @return `true` if the name is valid.
+    [[nodiscard]] auto validateNameConstraints(RuleId ruleId, const ValuePtr &value) -> bool;
 
     /// Validate the main constraints of a rule.
     /// @param rule The rule to validate.
     /// @param value The value to validate against the rule.
-    void validateValueConstraints(const RulePtr &rule, const ValuePtr &value);
+    /// @return `true` if the value is valid.
+    [[nodiscard]] auto validateValueConstraints(const RulePtr &rule, const ValuePtr &value) -> bool;
+
+    /// Check the main constraints of a rule, without reporting the error.
+    /// @param rule The rule to check.
+    /// @param value The value to check against the rule.
+    /// @return The first error, or an empty optional if the value meets all constraints.
+    [[nodiscard]] static auto checkValueConstraints(const RulePtr &rule, const ValuePtr &value) -> std::optional<Error>;
+
+    /// Check the actual constraints of the rule using a given validation context.
+    /// @return The first error, or an empty optional if the value meets all constraints.
+    [[nodiscard]] static auto checkConstraints(
+        const RulePtr &rule,
+        const ValidationContext &validationContext) -> std::optional<Error>;
 
-    /// Validate the actual constraints of the rule using a given validation context.
-    static void validateConstraints(const RulePtr &rule, const ValidationContext &validationContext);
+    /// Report a validation error.
+    /// Without a report, the error is thrown, otherwise it is added to the report.
+    /// @param error The error to report.
+    void reportError(Error error);
 
     /// Get a textual representation of the expected value type, based on the given rule.
     /// @param rule The rule.
@@ -170,8 +210,8 @@ private:
     /// Get an error text description for the parent location, based on a value.
     [[nodiscard]] static auto parentLocationText(const conf::ValuePtr &value) -> String;
 
-    /// Throw an error showing the expected and actual value for a given rule.
-    [[noreturn]] void throwExpectedVsActual(const RulePtr &rule, const ValuePtr &value) const;
+    /// Report an error showing the expected and actual value for a given rule.
+    void reportExpectedVsActual(const RulePtr &rule, const ValuePtr &value);
 
     /// Get a list of paths for an error message.
     [[nodiscard]] static auto errorNamePathsOr(
@@ -179,11 +219,13 @@ private:
         bool forNegation) -> String;
 
 private:
-    RulePtr _root; ///< The root node for the rule-tree.
+    ValidationPlanPtr _plan; ///< The validation plan for the user-selected version.
     conf::ValuePtr _value; ///< The root node for the value-tree.
-    Integer _version{0}; ///< The user-selected version for the validation.
     bool _useIndexes{false}; ///< True if the validation-rules make use of indexes.
     bool _useDependencies{false}; ///< True if the validation-rules make use of dependencies.
+    vr::ValidationReport *_report{nullptr}; ///< The optional report that collects all errors.
+    Scratch _ownScratch; ///< The scratch buffers, if none were passed to the constructor.
+    Scratch &_scratch; ///< The scratch buffers used for this validation.
 };
 
 
@@ -12,64 +12,79 @@
 namespace erbsland::conf::impl {
 
 
-void DocumentValidator::validateNameConstraints(const RulePtr &rule, const ValuePtr &value) {
-    if (!rule->hasNameConstraints()) {
-        return; // skip if this rule has no name constraints.
+auto DocumentValidator::validateNameConstraints(const RuleId ruleId, const ValuePtr &value) -> bool {
+    const auto nameRuleId = _plan->node(ruleId).nameChild;
+    if (nameRuleId == ValidationPlan::cNoRule) {
+        return true; // skip if this rule has no name constraints.
     }
-    const auto name = value->name();
     if (value->name().type() == NameType::Index || value->name().type() == NameType::TextIndex) {
-        throwValidationError(
+        reportError(validationError(
             u8"Expected a named value, but got a list entry or text index",
             value->namePath(),
-            value->location());
+            value->location()));
+        return false;
     }
-    const auto nameRule = rule->nameConstraints();
-    ERBSLAND_CONF_REQUIRE_SAFETY(nameRule != nullptr, "Unexpected missing name rule");
+    const auto &nameRule = _plan->rule(nameRuleId);
     const auto validationContext = ValidationContext{
         .target = ValidationTarget::Name,
         .value = value,
         .rule = nameRule,
     };
-    validateConstraints(nameRule, validationContext);
+    if (auto error = checkConstraints(nameRule, validationContext); error.has_value()) {
+        reportError(std::move(error).value());
+        return false;
+    }
+    return true;
+}
+
+
+auto DocumentValidator::validateValueConstraints(const RulePtr &rule, const ValuePtr &value) -> bool {
+    if (auto error = checkValueConstraints(rule, value); error.has_value()) {
+        reportError(std::move(error).value());
+        return false;
+    }
+    return true;
 }
 
 
-void DocumentValidator::validateValueConstraints(const RulePtr &rule, const ValuePtr &value) {
+auto DocumentValidator::checkValueConstraints(const RulePtr &rule, const ValuePtr &value) -> std::optional<Error> {
     const auto validationContext = ValidationContext{
         .target = ValidationTarget::Value,
         .value = value,
         .rule = rule,
     };
-    validateConstraints(rule, validationContext);
+    return checkConstraints(rule, validationContext);
 }
 
 
-void DocumentValidator::validateConstraints(const RulePtr &rule, const ValidationContext &validationContext) {
+auto DocumentValidator::checkConstraints(
+    const RulePtr &rule,
+    const ValidationContext &validationContext) -> std::optional<Error> {
+
     for (const auto &constraint : rule->constraintsImpl()) {
         ERBSLAND_CONF_REQUIRE_SAFETY(constraint->type() != vr::ConstraintType::Undefined, "Unexpected constraint type");
         ERBSLAND_CONF_REQUIRE_SAFETY(constraint->type() != vr::ConstraintType::Version, "Unexpected constraint type");
         if (constraint->type() == vr::ConstraintType::Key) {
             continue; // ignore key constraints for now.
         }
-        try {
-            constraint->validate(validationContext);
-        } catch (const Error &error) {
-            if (error.category() == ErrorCategory::Validation) {
-                if (constraint->hasCustomError()) {
-                    throw error.withMessage(constraint->customError());
-                }
-                if (rule->hasCustomError()) {
-                    throw error.withMessage(rule->customError());
-                }
-            }
-            throw;
+        auto error = constraint->check(validationContext);
+        if (!error.has_value()) {
+            continue;
+        }
+        if (constraint->hasCustomError()) {
+            return error->withMessage(constraint->customError());
+        }
+        if (rule->hasCustomError()) {
+            return error->withMessage(rule->customError());
         }
+        return error;
     }
+    return std::nullopt;
 }
 
 
 auto DocumentValidator::expectedValueTypeText(const RulePtr &rule) const -> String {
-    return impl::expectedValueTypeText(rule, _version);
+    return impl::expectedValueTypeText(rule, _plan->version());
 }
 
 
@@ -88,8 +103,8 @@ auto DocumentValidator::parentLocationText(const conf::ValuePtr &value) -> Strin
 }
 
 
-void DocumentValidator::throwExpectedVsActual(const RulePtr &rule, const ValuePtr &value) const {
-    impl::throwExpectedVsActual(rule, value, _version);
+void DocumentValidator::reportExpectedVsActual(const RulePtr &rule, const ValuePtr &value) {
+    reportError(expectedVsActualError(rule, value, _plan->version()));
 }
 
 
@@ -16,44 +16,41 @@
 namespace erbsland::conf::impl {
 
 
-auto DocumentValidator::validate(const RulePtr &rule, const ValuePtr &value) -> RulePtr {
-    validateNameConstraints(rule, value);
-    if (rule->hasKeyDefinitions() || rule->hasConstraint(vr::ConstraintType::Key)) {
+auto DocumentValidator::validate(const RuleId ruleId, const ValuePtr &value) -> RuleId {
+    if (!validateNameConstraints(ruleId, value)) {
+        return ValidationPlan::cNoRule;
+    }
+    const auto &node = _plan->node(ruleId);
+    if (node.usesIndexes) {
         _useIndexes = true;
     }
-    if (rule->hasDependencyDefinitions()) {
+    if (node.usesDependencies) {
         _useDependencies = true;
     }
-    switch (rule->type()) {
-        case vr::RuleType::NotValidated: return handleNotValidatedValues(rule, value);
-        case vr::RuleType::Alternatives: return handleAlternatives(rule, value);
-        case vr::RuleType::SectionList: return handleSectionLists(rule, value);
-        case vr::RuleType::ValueList: return handleValueLists(rule, value);
-        case vr::RuleType::ValueMatrix: return handleValueMatrix(rule, value);
+    switch (node.rule->type()) {
+        case vr::RuleType::NotValidated: return handleNotValidatedValues(ruleId, value);
+        case vr::RuleType::Alternatives: return handleAlternatives(ruleId, value);
+        case vr::RuleType::SectionList: return handleSectionLists(ruleId, value);
+        case vr::RuleType::ValueList: return handleValueLists(ruleId, value);
+        case vr::RuleType::ValueMatrix: return handleValueMatrix(ruleId, value);
         default: break;
     }
-    return handleCommonValues(rule, value);
+    return handleCommonValues(ruleId, value);
 }
 
 
-void DocumentValidator::handleMissingValues(const RulePtr &rule, const conf::ValuePtr &parentValue) {
-    ERBSLAND_CONF_REQUIRE_SAFETY(rule != nullptr, "The rule must not be null");
+void DocumentValidator::handleMissingValues(const RuleId ruleId, const conf::ValuePtr &parentValue) {
     ERBSLAND_CONF_REQUIRE_SAFETY(parentValue != nullptr, "The parent value must not be null");
-    if (rule->type() == vr::RuleType::NotValidated ||
-        !rule->versionMask().matches(_version) ||
-        rule->ruleName().isReservedValidationRule() ||
-        rule->isOptional()) {
-        return; // ignore values that do not need to exit.
-    }
+    // Only rules that are active for the version, validated, not reserved and not optional are passed here.
+    const auto &node = _plan->node(ruleId);
+    const auto &rule = node.rule;
     if (rule->hasDefault()) {
         copyDefaultValue(rule, parentValue); // if we have a default value, apply it, done.
         return;
     }
     if (rule->type() == vr::RuleType::Alternatives) {
-        for (const auto &alternativeRule : rule->childrenImpl()) {
-            if (!alternativeRule->versionMask().matches(_version)) {
-                continue; // only consider rules that are active for the current version.
-            }
+        for (const auto alternativeRuleId : node.activeChildren) {
+            const auto &alternativeRule = _plan->rule(alternativeRuleId);
             if (alternativeRule->isOptional()) {
                 return; // ignore optional values.
             }
@@ -64,14 +61,14 @@ void DocumentValidator::handleMissingValues(const RulePtr &rule, const conf::Val
         }
     }
     // at this point, the missing value for the rule couldn't be resolved.
-    throwValidationError(
+    reportError(validationError(
         u8format(
             u8"In {}, expected {} with the name '{}'",
             parentLocationText(parentValue),
             expectedValueTypeText(rule),
             rule->targetName().toPathText()),
         parentValue->namePath(),
-        parentValue->location());
+        parentValue->location()));
 }
 
 
@@ -94,175 +91,170 @@ void DocumentValidator::copyDefaultValue(const RulePtr &rule, const conf::ValueP
 }
 
 
-auto DocumentValidator::handleNotValidatedValues(const RulePtr &rule, const ValuePtr &value) -> RulePtr {
-    ERBSLAND_CONF_REQUIRE_SAFETY(rule != nullptr, "The rule must not be null");
+auto DocumentValidator::handleNotValidatedValues(const RuleId ruleId, const ValuePtr &value) -> RuleId {
     ERBSLAND_CONF_REQUIRE_SAFETY(value != nullptr, "The value must not be null");
     // Mark the whole branch in the value-tree as not-validated.
+    const auto &rule = _plan->rule(ruleId);
     ValueTreeWalker treeWalker;
     treeWalker.setRoot(value);
     treeWalker.walk([&rule](const conf::ValuePtr &value) -> void {
         const auto valueImpl = getImplValue(value);
         valueImpl->setValidationRule(rule);
     });
-    return {};
+    return ValidationPlan::cNoRule;
 }
 
 
-auto DocumentValidator::handleAlternatives(const RulePtr &rule, const ValuePtr &value) -> RulePtr {
-    ERBSLAND_CONF_REQUIRE_SAFETY(rule != nullptr, "The rule must not be null");
+auto DocumentValidator::handleAlternatives(const RuleId ruleId, const ValuePtr &value) -> RuleId {
     ERBSLAND_CONF_REQUIRE_SAFETY(value != nullptr, "The value must not be null");
     // validate all alternatives and return the first matching rule.
-    std::vector<RulePtr> matchingRules;
-    matchingRules.reserve(rule->childrenImpl().size());
-    for (const auto &alternativeRule : rule->childrenImpl()) {
-        if (alternativeRule->versionMask().matches(_version) &&
-            alternativeRule->type().matchesValueType(value->type())) {
-
-            matchingRules.emplace_back(alternativeRule);
-        }
-    }
-    // if we have no rules that match by version and type, report an error showing all possible types.
-    if (matchingRules.empty()) {
-        throwExpectedVsActual(rule, value);
-    }
-    // if we have one or more matching rules, search one that matches.
+    const auto &node = _plan->node(ruleId);
     std::optional<Error> firstError;
-    RulePtr matchingRule = {};
-    for (const auto &alternativeRule : matchingRules) {
-        try {
-            validateValueConstraints(alternativeRule, value);
-            matchingRule = alternativeRule;
-            break;
-        } catch (const Error &error) {
-            if (!firstError.has_value()) {
-                firstError = error;
-            }
+    bool hasMatchingType = false;
+    for (const auto alternativeRuleId : node.activeChildren) {
+        const auto &alternativeRule = _plan->rule(alternativeRuleId);
+        if (!alternativeRule->type().matchesValueType(value->type())) {
+            continue;
+        }
+        hasMatchingType = true;
+        auto error = checkValueConstraints(alternativeRule, value);
+        if (!error.has_value()) {
+            return alternativeRuleId;
+        }
+        if (!firstError.has_value()) {
+            firstError = std::move(error);
         }
     }
-    // if no matching rule was found, throw an error
-    if (matchingRule == nullptr) {
-        ERBSLAND_CONF_REQUIRE_SAFETY(firstError.has_value(), "Expected having an error to throw");
-        throw Error{firstError.value()};
+    // if we have no rules that match by version and type, report an error showing all possible types.
+    if (!hasMatchingType) {
+        reportExpectedVsActual(node.rule, value);
+        return ValidationPlan::cNoRule;
     }
-    return matchingRule;
+    // if no matching rule was found, report the error of the first alternative.
+    ERBSLAND_CONF_REQUIRE_SAFETY(firstError.has_value(), "Expected having an error to report");
+    reportError(std::move(firstError).value());
+    return ValidationPlan::cNoRule;
 }
 
 
-auto DocumentValidator::handleSectionLists(const RulePtr &rule, const ValuePtr &value) -> RulePtr {
-    ERBSLAND_CONF_REQUIRE_SAFETY(rule != nullptr, "The rule must not be null");
+auto DocumentValidator::handleSectionLists(const RuleId ruleId, const ValuePtr &value) -> RuleId {
     ERBSLAND_CONF_REQUIRE_SAFETY(value != nullptr, "The value must not be null");
+    const auto &rule = _plan->rule(ruleId);
     if (value->type() != ValueType::SectionList) {
-        throwExpectedVsActual(rule, value);
+        reportExpectedVsActual(rule, value);
+        return ValidationPlan::cNoRule;
     }
-    validateValueConstraints(rule, value);
-    return rule;
+    if (!validateValueConstraints(rule, value)) {
+        return ValidationPlan::cNoRule;
+    }
+    return ruleId;
 }
 
 
-auto DocumentValidator::handleValueListOrMatrixPreCheck(
-    const RulePtr &rule,
-    const ValuePtr &value) -> RulePtr {
-
-    ERBSLAND_CONF_REQUIRE_SAFETY(rule != nullptr, "The rule must not be null");
+auto DocumentValidator::handleValueListOrMatrixPreCheck(const RuleId ruleId, const ValuePtr &value) -> RuleId {
     ERBSLAND_CONF_REQUIRE_SAFETY(value != nullptr, "The value must not be null");
     // Check the constraints for the list's size.
-    validateValueConstraints(rule, value);
+    if (!validateValueConstraints(_plan->rule(ruleId), value)) {
+        return ValidationPlan::cNoRule;
+    }
     // Make sure we actually got a list of values or scalar.
     if (value->type() != ValueType::ValueList && !value->type().isScalar()) {
-        throwValidationError(u8format(
+        reportError(validationError(u8format(
             u8"Expected a list of values, but found {}",
-            value->type().toValueDescription(true)));
+            value->type().toValueDescription(true))));
+        return ValidationPlan::cNoRule;
     }
     // If this is true, we are sure that the value can be converted into a value list.
-    const auto valueRule = rule->child(vrc::cReservedEntry);
-    ERBSLAND_CONF_REQUIRE_SAFETY(valueRule != nullptr, "Missing 'vr_entry' rule for list rule");
-    return valueRule;
+    const auto valueRuleId = _plan->node(ruleId).entryChild;
+    ERBSLAND_CONF_REQUIRE_SAFETY(valueRuleId != ValidationPlan::cNoRule, "Missing 'vr_entry' rule for list rule");
+    return valueRuleId;
 }
 
 
-void DocumentValidator::validateListOrMatrixValue(
-    const RulePtr &valueRule,
-    const ValuePtr &value) {
-
-    ERBSLAND_CONF_REQUIRE_DEBUG(valueRule != nullptr, "The value rule must not be null");
+void DocumentValidator::validateListOrMatrixValue(const RuleId valueRuleId, const ValuePtr &value) {
     ERBSLAND_CONF_REQUIRE_DEBUG(value != nullptr, "The value must not be null");
+    const auto &valueRule = _plan->rule(valueRuleId);
     ERBSLAND_CONF_REQUIRE_SAFETY(valueRule->type().isScalar() || valueRule->type() == vr::RuleType::Alternatives,
         "Unexpected rule type for 'vr_entry'");
 
     // Use the regular handlers to validate the list/matrix values.
-    RulePtr validatedRule;
+    RuleId validatedRuleId;
     if (valueRule->type() == vr::RuleType::Alternatives) {
-        validatedRule = handleAlternatives(valueRule, value);
+        validatedRuleId = handleAlternatives(valueRuleId, value);
     } else {
-        validatedRule = handleCommonValues(valueRule, value);
+        validatedRuleId = handleCommonValues(valueRuleId, value);
     }
     // Assign the rule that was used to validate the value.
-    value->setValidationRule(validatedRule);
+    if (validatedRuleId != ValidationPlan::cNoRule) {
+        value->setValidationRule(_plan->rule(validatedRuleId));
+    }
 }
 
 
-auto DocumentValidator::handleValueLists(const RulePtr &rule, const ValuePtr &value) -> RulePtr {
-    const auto valueRule = handleValueListOrMatrixPreCheck(rule, value);
+auto DocumentValidator::handleValueLists(const RuleId ruleId, const ValuePtr &value) -> RuleId {
+    const auto valueRuleId = handleValueListOrMatrixPreCheck(ruleId, value);
+    if (valueRuleId == ValidationPlan::cNoRule) {
+        return ValidationPlan::cNoRule;
+    }
     for (const auto &valueListEntry : value->toValueList()) {
-        validateListOrMatrixValue(valueRule, getImplValue(valueListEntry));
+        validateListOrMatrixValue(valueRuleId, getImplValue(valueListEntry));
     }
-    return rule;
+    return ruleId;
 }
 
 
-auto DocumentValidator::handleValueMatrix(const RulePtr &rule, const ValuePtr &value) -> RulePtr {
-    const auto valueRule = handleValueListOrMatrixPreCheck(rule, value);
+auto DocumentValidator::handleValueMatrix(const RuleId ruleId, const ValuePtr &value) -> RuleId {
+    const auto valueRuleId = handleValueListOrMatrixPreCheck(ruleId, value);
+    if (valueRuleId == ValidationPlan::cNoRule) {
+        return ValidationPlan::cNoRule;
+    }
     const auto valueMatrix = value->toValueMatrix();
     for (std::size_t row = 0; row < valueMatrix.rowCount(); ++row) {
         for (std::size_t column = 0; column < valueMatrix.columnCount(); ++column) {
             if (valueMatrix.isDefined(row, column)) {
-                validateListOrMatrixValue(valueRule, getImplValue(valueMatrix.value(row, column)));
+                validateListOrMatrixValue(valueRuleId, getImplValue(valueMatrix.value(row, column)));
             }
         }
     }
-    return rule;
+    return ruleId;
 }
 
 
-auto DocumentValidator::handleCommonValues(const RulePtr &rule, const ValuePtr &value) -> RulePtr {
+auto DocumentValidator::handleCommonValues(const RuleId ruleId, const ValuePtr &value) -> RuleId {
     // Validate the expected value type.
+    const auto &rule = _plan->rule(ruleId);
     if (!rule->type().matchesValueType(value->type())) {
-        throwExpectedVsActual(rule, value);
+        reportExpectedVsActual(rule, value);
+        return ValidationPlan::cNoRule;
     }
-    validateValueConstraints(rule, value);
-    return rule;
+    if (!validateValueConstraints(rule, value)) {
+        return ValidationPlan::cNoRule;
+    }
+    return ruleId;
 }
 
 
-auto DocumentValidator::nextRuleForValue(const RulePtr &parentRule, const ValuePtr &value) const -> RulePtr {
-    const auto name = value->name();
+auto DocumentValidator::nextRuleForValue(const RuleId parentRuleId, const ValuePtr &value) -> RuleId {
+    const auto &name = value->nameImpl();
     if (name.isIndex()) {
         // An index as the name means that this is an entry of a list.
         // therefore, the vr_entry rule is used to validate the list entry.
-        auto entryRule = parentRule->child(vrc::cReservedEntry);
-        ERBSLAND_CONF_REQUIRE_SAFETY(entryRule != nullptr, "Missing entry rule for list rule");
-        return entryRule;
+        const auto entryRuleId = _plan->node(parentRuleId).entryChild;
+        ERBSLAND_CONF_REQUIRE_SAFETY(entryRuleId != ValidationPlan::cNoRule, "Missing entry rule for list rule");
+        return entryRuleId;
     }
-    RulePtr anyRule = {};
-    for (const auto &childRule : parentRule->childrenImpl()) {
-        if (!childRule->versionMask().matches(_version)) {
-            continue; // ignore all rules that do not match the current version
-        }
-        if (childRule->ruleName() == vrc::cReservedAny) {
-            anyRule = childRule; // store the "any" rule for later. It is evaluated if no other rule matches.
-            continue;
-        }
-        if (childRule->targetName() == name) {
-            return childRule;
-        }
+    if (const auto childRuleId = _plan->namedChild(parentRuleId, name); childRuleId != ValidationPlan::cNoRule) {
+        return childRuleId;
     }
-    if (anyRule != nullptr) {
-        return anyRule;
+    // The "any" rule is only evaluated if no other rule matches.
+    if (const auto anyRuleId = _plan->node(parentRuleId).anyChild; anyRuleId != ValidationPlan::cNoRule) {
+        return anyRuleId;
     }
-    throwValidationError(
+    reportError(validationError(
         u8format(u8"Found an unexpected {} in this document", value->type().toValueDescription(false)),
         value->namePath(),
-        value->location());
+        value->location()));
+    return ValidationPlan::cNoRule;
 }
 
 
@@ -3,6 +3,7 @@
 #include "EqualsConstraint.hpp"
 
 
+#include "ValidationContext.hpp"
 #include "ValidationError.hpp"
 
 #include "../value/Value.hpp"
@@ -17,49 +18,49 @@ EqualsIntegerConstraint::EqualsIntegerConstraint(const Integer value) : EqualsCo
 
 void EqualsIntegerConstraint::validateInteger(const ValidationContext &context, const Integer value) const {
     if (isNotValid(value, context)) {
-        throwValidationError(u8format(u8"The value {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The value {} {}", comparisonText(), _value));
     }
 }
 
 
 void EqualsIntegerConstraint::validateText(const ValidationContext &context, const String &value) const {
     if (isNotValid(static_cast<Integer>(value.characterLength()), context)) {
-        throwValidationError(u8format(u8"The number of characters in this text {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of characters in this text {} {}", comparisonText(), _value));
     }
 }
 
 
 void EqualsIntegerConstraint::validateBytes(const ValidationContext &context, const Bytes &value) const {
     if (isNotValid(static_cast<Integer>(value.size()), context)) {
-        throwValidationError(u8format(u8"The number of bytes {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of bytes {} {}", comparisonText(), _value));
     }
 }
 
 
 void EqualsIntegerConstraint::validateValueList(const ValidationContext &context) const {
     if (isNotValid(static_cast<Integer>(context.value->asValueList().size()), context)) {
-        throwValidationError(u8format(u8"The number of values in this list {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of values in this list {} {}", comparisonText(), _value));
     }
 }
 
 
 void EqualsIntegerConstraint::validateSectionWithNames(const ValidationContext &context) const {
     if (isNotValid(static_cast<Integer>(context.value->size()), context)) {
-        throwValidationError(u8format(u8"The number of entries in this section {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of entries in this section {} {}", comparisonText(), _value));
     }
 }
 
 
 void EqualsIntegerConstraint::validateSectionWithTexts(const ValidationContext &context) const {
     if (isNotValid(static_cast<Integer>(context.value->size()), context)) {
-        throwValidationError(u8format(u8"The number of entries in this section {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of entries in this section {} {}", comparisonText(), _value));
     }
 }
 
 
 void EqualsIntegerConstraint::validateSectionList(const ValidationContext &context) const {
     if (isNotValid(static_cast<Integer>(context.value->size()), context)) {
-        throwValidationError(u8format(u8"The number of entries in this section list {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of entries in this section list {} {}", comparisonText(), _value));
     }
 }
 
@@ -71,7 +72,7 @@ EqualsBooleanConstraint::EqualsBooleanConstraint(const bool value) : EqualsConst
 void EqualsBooleanConstraint::validateBoolean(const ValidationContext &context, const bool value) const {
     if (isNotValid(value, context)) {
         const auto expectedValue = isNegated() ? !_value : _value;
-        throwValidationError(u8format(u8"The value must be {}", expectedValue ? String{u8"true"} : String{u8"false"}));
+        context.fail(u8format(u8"The value must be {}", expectedValue ? String{u8"true"} : String{u8"false"}));
     }
 }
 
@@ -82,14 +83,14 @@ EqualsFloatConstraint::EqualsFloatConstraint(const Float value) : EqualsConstrai
 
 void EqualsFloatConstraint::validateFloat(const ValidationContext &context, const Float value) const {
     if (isNotValid(value, context)) {
-        throwValidationError(u8format(u8"The value {} {:.6} (within platform tolerance)", comparisonText(), _value));
+        context.fail(u8format(u8"The value {} {:.6} (within platform tolerance)", comparisonText(), _value));
     }
 }
 
 
 void EqualsTextConstraint::validateText(const ValidationContext &context, const String &value) const {
     if (isNotValid(value, context)) {
-        throwValidationError(u8format(
+        context.fail(u8format(
             u8"The text {} \"{}\" ({})",
             comparisonText(),
             _value.toEscaped(EscapeMode::ErrorText),
@@ -100,7 +101,7 @@ void EqualsTextConstraint::validateText(const ValidationContext &context, const
 
 void EqualsBytesConstraint::validateBytes(const ValidationContext &context, const Bytes &value) const {
     if (isNotValid(value, context)) {
-        throwValidationError(u8format(u8"The byte sequence {} \"{}\"", comparisonText(), _value.toHexForErrors()));
+        context.fail(u8format(u8"The byte sequence {} \"{}\"", comparisonText(), _value.toHexForErrors()));
     }
 }
 
@@ -122,11 +123,13 @@ auto EqualsMatrixConstraint::isNotValidColumns(
 void EqualsMatrixConstraint::validateValueList(const ValidationContext &context) const {
     const auto &value = context.value;
     if (isNotValid(static_cast<Integer>(value->size()), context)) {
-        throwValidationError(u8format(u8"The number of rows {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of rows {} {}", comparisonText(), _value));
+        return;
     }
     for (const auto &columns : *value) {
         if (isNotValidColumns(static_cast<Integer>(columns->size()), context)) {
-            throwValidationError(u8format(u8"The number of columns {} {}", comparisonText(), _columns));
+            context.fail(u8format(u8"The number of columns {} {}", comparisonText(), _columns));
+            return;
         }
     }
 }
@@ -3,6 +3,7 @@
 #include "InConstraint.hpp"
 
 
+#include "ValidationContext.hpp"
 #include "ValidationError.hpp"
 
 
@@ -11,42 +12,30 @@ namespace erbsland::conf::impl {
 
 void InIntegerConstraint::validateInteger(const ValidationContext &context, const Integer value) const {
     if (isNotValid(value, context)) {
-        String expected;
-        for (std::size_t i = 0; i < _values.size(); ++i) {
-            if (i != 0) {
-                expected.append(u8" or ");
-            }
-            expected.append(u8format(u8"{}", _values[i]));
-        }
-        throwValidationError(u8format(u8"The value {} {}", comparisonText(), expected));
+        const auto expected = expectedText([](String &text, const Integer expectedValue) -> void {
+            text.append(u8format(u8"{}", expectedValue));
+        });
+        context.fail(u8format(u8"The value {} {}", comparisonText(), expected));
     }
 }
 
 
 void InFloatConstraint::validateFloat(const ValidationContext &context, const Float value) const {
     if (isNotValid(value, context)) {
-        String expected;
-        for (std::size_t i = 0; i < _values.size(); ++i) {
-            if (i != 0) {
-                expected.append(u8" or ");
-            }
-            expected.append(u8format(u8"{:.6}", _values[i]));
-        }
-        throwValidationError(u8format(u8"The value {} {} (within platform tolerance)", comparisonText(), expected));
+        const auto expected = expectedText([](String &text, const Float expectedValue) -> void {
+            text.append(u8format(u8"{:.6}", expectedValue));
+        });
+        context.fail(u8format(u8"The value {} {} (within platform tolerance)", comparisonText(), expected));
     }
 }
 
 
 void InTextConstraint::validateText(const ValidationContext &context, const String &value) const {
     if (isNotValid(value, context)) {
-        String expected;
-        for (std::size_t i = 0; i < _values.size(); ++i) {
-            if (i != 0) {
-                expected.append(u8" or ");
-            }
-            expected.append(u8format(u8"\"{}\"", _values[i].toEscaped(EscapeMode::ErrorText)));
-        }
-        throwValidationError(u8format(u8"The text {} {} ({})",
+        const auto expected = expectedText([](String &text, const String &expectedValue) -> void {
+            text.append(u8format(u8"\"{}\"", expectedValue.toEscaped(EscapeMode::ErrorText)));
+        });
+        context.fail(u8format(u8"The text {} {} ({})",
             comparisonText(),
             expected,
             context.rule->caseSensitivity()));
@@ -56,14 +45,10 @@ void InTextConstraint::validateText(const ValidationContext &context, const Stri
 
 void InBytesConstraint::validateBytes(const ValidationContext &context, const Bytes &value) const {
     if (isNotValid(value, context)) {
-        String expected;
-        for (std::size_t i = 0; i < _values.size(); ++i) {
-            if (i != 0) {
-                expected.append(u8" or ");
-            }
-            expected.append(u8format(u8"\"{}\"", _values[i].toHexForErrors()));
-        }
-        throwValidationError(u8format(u8"The byte sequence {} {}", comparisonText(), expected));
+        const auto expected = expectedText([](String &text, const Bytes &expectedValue) -> void {
+            text.append(u8format(u8"\"{}\"", expectedValue.toHexForErrors()));
+        });
+        context.fail(u8format(u8"The byte sequence {} {}", comparisonText(), expected));
     }
 }
 
@@ -5,12 +5,17 @@
 
 #include "Constraint.hpp"
 #include "ConstraintHandlerContext.hpp"
+#include "Key.hpp"
 #include "ValidationContext.hpp"
 
 #include "../../CaseSensitivity.hpp"
 #include "../../Error.hpp"
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <cstdint>
+#include <functional>
 #include <limits>
 #include <utility>
 #include <vector>
@@ -19,20 +24,71 @@
 namespace erbsland::conf::impl {
 
 
+/// A hashed index for the values of an `in` constraint.
+///
+/// The hash of each value is stored in an open-addressing table with the `index + 1` of the value. Text is hashed
+/// with its lower-case characters, so values that are equal in a case-insensitive comparison have the same hash,
+/// and the same index works for case-sensitive and case-insensitive rules. Floating-point values are compared
+/// with a tolerance and cannot be hashed; for these, the values are scanned.
+///
+/// The index does not store the values; the same list of values must be passed to all methods.
+///
 template<typename T>
-class InConstraint : public Constraint {
+class InValueIndex final {
 public:
-    template<typename Fwd>
-    requires (std::is_same_v<std::remove_cvref_t<Fwd>, std::vector<T>>)
-    explicit InConstraint(Fwd &&values) : _values(std::forward<Fwd>(values)) {
-        setType(vr::ConstraintType::In);
+    /// If the values of this type are hashed.
+    ///
+    constexpr static bool cIsHashed = !std::is_floating_point_v<T>;
+
+public:
+    InValueIndex() = default;
+
+    /// Build the index for a list of values.
+    ///
+    explicit InValueIndex(const std::vector<T> &values) {
+        if constexpr (cIsHashed) {
+            _hashes.reserve(values.size());
+            _table.assign(std::bit_ceil(values.size() * 2 + 1), 0);
+            const auto mask = _table.size() - 1;
+            for (std::size_t index = 0; index < values.size(); ++index) {
+                const auto hash = hashValue(values[index]);
+                _hashes.emplace_back(hash);
+                auto slot = hash & mask;
+                while (_table[slot] != 0) {
+                    slot = (slot + 1) & mask;
+                }
+                _table[slot] = static_cast<uint32_t>(index + 1);
+            }
+        }
     }
 
 public:
-    [[nodiscard]] static auto hasDuplicate(const std::vector<T> &values, const CaseSensitivity cs) -> bool {
-        for (std::size_t i = 0; i < values.size(); ++i) {
-            for (std::size_t j = i + 1; j < values.size(); ++j) {
-                if (areEqual(values[i], values[j], cs)) {
+    /// Find a value in the list.
+    ///
+    /// @param values The values used to build the index.
+    /// @param value The value to search.
+    /// @param cs The case sensitivity for text values.
+    /// @param ignoredIndex An index of a value that is ignored.
+    /// @return `true` if the value was found.
+    ///
+    [[nodiscard]] auto contains(
+        const std::vector<T> &values,
+        const T &value,
+        const CaseSensitivity cs,
+        const std::size_t ignoredIndex = std::numeric_limits<std::size_t>::max()) const -> bool {
+
+        if constexpr (cIsHashed) {
+            const auto hash = hashValue(value);
+            const auto mask = _table.size() - 1;
+            for (auto slot = hash & mask; _table[slot] != 0; slot = (slot + 1) & mask) {
+                const std::size_t index = _table[slot] - 1;
+                if (index != ignoredIndex && _hashes[index] == hash && areEqual(values[index], value, cs)) {
+                    return true;
+                }
+            }
+        } else {
+            for (std::size_t index = 0; index < values.size(); ++index) {
+                if (index != ignoredIndex && areEqual(values[index], value, cs)) {
                     return true;
                 }
             }
@@ -40,11 +96,19 @@ public:
         return false;
     }
 
-protected:
-    [[nodiscard]] auto isEqual(const T &a, const T &b, const ValidationContext &context) const -> bool {
-        return areEqual(a, b, context.rule->caseSensitivity());
+    /// Test if the list contains a value twice.
+    ///
+    [[nodiscard]] auto hasDuplicate(const std::vector<T> &values, const CaseSensitivity cs) const -> bool {
+        for (std::size_t index = 0; index < values.size(); ++index) {
+            if (contains(values, values[index], cs, index)) {
+                return true;
+            }
+        }
+        return false;
     }
 
+    /// Test if two values are equal.
+    ///
     [[nodiscard]] static auto areEqual(const T &a, const T &b, const CaseSensitivity cs) -> bool {
         if constexpr (std::is_same_v<T, String>) {
             return a.characterCompare(b, cs) == std::strong_ordering::equal;
@@ -57,13 +121,47 @@ protected:
         }
     }
 
-    [[nodiscard]] auto contains(const T &value, const ValidationContext &context) const -> bool {
-        for (const auto &v : _values) {
-            if (isEqual(v, value, context)) {
-                return true;
-            }
+private:
+    [[nodiscard]] static auto hashValue(const T &value) noexcept -> std::size_t {
+        if constexpr (std::is_same_v<T, String>) {
+            return Key::elementHash(value, CaseSensitivity::CaseInsensitive);
+        } else if constexpr (std::is_integral_v<T>) {
+            // Spread the bits, as the standard hash for integers is often the value itself.
+            const auto mixed = static_cast<uint64_t>(value) * 0x9e3779b97f4a7c15ULL;
+            return static_cast<std::size_t>(mixed ^ (mixed >> 32U));
+        } else {
+            return std::hash<T>{}(value);
         }
-        return false;
+    }
+
+private:
+    std::vector<std::size_t> _hashes; ///< The hashes of the values, in the same order as the values.
+    std::vector<uint32_t> _table; ///< Open-addressing table with `index + 1` of the values.
+};
+
+
+template<typename T>
+class InConstraint : public Constraint {
+public:
+    /// The maximum number of values listed in an error message.
+    ///
+    constexpr static std::size_t cMaximumListedValues = 10;
+
+public:
+    template<typename Fwd>
+    requires (std::is_same_v<std::remove_cvref_t<Fwd>, std::vector<T>>)
+    explicit InConstraint(Fwd &&values) : _values(std::forward<Fwd>(values)), _index{_values} {
+        setType(vr::ConstraintType::In);
+    }
+
+public:
+    [[nodiscard]] static auto hasDuplicate(const std::vector<T> &values, const CaseSensitivity cs) -> bool {
+        return InValueIndex<T>{values}.hasDuplicate(values, cs);
+    }
+
+protected:
+    [[nodiscard]] auto contains(const T &value, const ValidationContext &context) const -> bool {
+        return _index.contains(_values, value, context.rule->caseSensitivity());
     }
 
     [[nodiscard]] auto isNotValid(const T &validatedValue, const ValidationContext &context) const -> bool {
@@ -81,8 +179,31 @@ protected:
         return isNegated() ? notInText : inText;
     }
 
+    /// Create the list of values for an error message.
+    ///
+    /// Only the first `cMaximumListedValues` values are listed, so the message stays short for long lists.
+    ///
+    /// @param formatValue A function that appends one formatted value to the text.
+    ///
+    template<typename Fn>
+    [[nodiscard]] auto expectedText(Fn formatValue) const -> String {
+        String result;
+        const auto listedCount = std::min(_values.size(), cMaximumListedValues);
+        for (std::size_t i = 0; i < listedCount; ++i) {
+            if (i != 0) {
+                result.append(u8" or ");
+            }
+            formatValue(result, _values[i]);
+        }
+        if (listedCount < _values.size()) {
+            result.append(u8format(u8" or one of {} more values", _values.size() - listedCount));
+        }
+        return result;
+    }
+
 protected:
     std::vector<T> _values;
+    InValueIndex<T> _index; ///< The index for the values, built when the constraint is created.
 };
 
 
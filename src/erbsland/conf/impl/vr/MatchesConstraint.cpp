@@ -3,6 +3,7 @@
 #include "MatchesConstraint.hpp"
 
 
+#include "ValidationContext.hpp"
 #include "ValidationError.hpp"
 
 
@@ -12,6 +13,7 @@ namespace erbsland::conf::impl {
 MatchesConstraint::MatchesConstraint(
     [[maybe_unused]] const String &pattern,
     [[maybe_unused]] const bool isVerbose) {
+    setType(vr::ConstraintType::Matches);
 #ifdef ERBSLAND_CONF_VR_RE_STD
     try {
         _regex = std::regex(pattern.toCharString());
@@ -41,7 +43,7 @@ void MatchesConstraint::validateText(
     [[maybe_unused]] const String &value) const {
 #ifdef ERBSLAND_CONF_VR_RE_STD
     if (!std::regex_search(value.toCharString(), _regex)) {
-        throwValidationError("The text does not match an expected pattern");
+        context.fail("The text does not match an expected pattern");
     }
 #else
 #ifdef ERBSLAND_CONF_VR_RE_ERBSLAND
@@ -53,10 +55,10 @@ void MatchesConstraint::validateText(
         match = _regex->findFirst(value.toCharString());
 #endif
         if (match == nullptr) {
-            throwValidationError("The text does not match an expected pattern");
+            context.fail("The text does not match an expected pattern");
         }
     } catch (const re::Error &error) {
-        throwValidationError(u8format("The text could not be validated because of an error: {}", error));
+        context.fail(u8format("The text could not be validated because of an error: {}", error));
     }
 #else
     // ignore if disabled.
@@ -19,6 +19,11 @@
 namespace erbsland::conf::impl {
 
 
+/// The `matches` constraint.
+///
+/// The expression is compiled when the rules are created and only read while validating, so one constraint can
+/// be used by multiple threads at the same time.
+///
 class MatchesConstraint : public Constraint {
 public:
 #ifdef ERBSLAND_CONF_VR_RE_STD
@@ -39,7 +44,7 @@ protected:
     void validateText(const ValidationContext &context, const String &value) const override;
 
 private:
-    RegEx _regex; ///< The compiled regular expression
+    RegEx _regex; ///< The compiled regular expression, never modified after construction.
 };
 
 
@@ -28,7 +28,7 @@ void MinMaxIntegerConstraint::validateInteger(
     const Integer value) const {
 
     if (isNotValid(value)) {
-        throwValidationError(u8format(u8"The value must be {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The value must be {} {}", comparisonText(), _value));
     }
 }
 
@@ -38,7 +38,7 @@ void MinMaxIntegerConstraint::validateText(
     const String &value) const {
 
     if (isNotValid(toInteger(value.characterLength()))) {
-        throwValidationError(u8format(u8"The number of characters in this text must be {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of characters in this text must be {} {}", comparisonText(), _value));
     }
 }
 
@@ -48,7 +48,7 @@ void MinMaxIntegerConstraint::validateBytes(
     const Bytes &value) const {
 
     if (isNotValid(toInteger(value.size()))) {
-        throwValidationError(u8format(u8"The number of bytes must be {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of bytes must be {} {}", comparisonText(), _value));
     }
 }
 
@@ -59,28 +59,28 @@ void MinMaxIntegerConstraint::validateValueList(const ValidationContext &context
         valueCount = context.value->size();
     }
     if (isNotValid(toInteger(valueCount))) {
-        throwValidationError(u8format(u8"The number of values in this list must be {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of values in this list must be {} {}", comparisonText(), _value));
     }
 }
 
 
 void MinMaxIntegerConstraint::validateSectionList(const ValidationContext &context) const {
     if (isNotValid(toInteger(context.value->size()))) {
-        throwValidationError(u8format(u8"The number of entries in this section list must be {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of entries in this section list must be {} {}", comparisonText(), _value));
     }
 }
 
 
 void MinMaxIntegerConstraint::validateSectionWithNames(const ValidationContext &context) const {
     if (isNotValid(toInteger(context.value->size()))) {
-        throwValidationError(u8format(u8"The number of entries in this section must be {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of entries in this section must be {} {}", comparisonText(), _value));
     }
 }
 
 
 void MinMaxIntegerConstraint::validateSectionWithTexts(const ValidationContext &context) const {
     if (isNotValid(toInteger(context.value->size()))) {
-        throwValidationError(u8format(u8"The number of entries in this section must be {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The number of entries in this section must be {} {}", comparisonText(), _value));
     }
 }
 
@@ -90,7 +90,7 @@ void MinMaxFloatConstraint::validateFloat(
     const Float value) const {
 
     if (std::isnan(value) || isNotValid(value)) {
-        throwValidationError(u8format(u8"The value must be {} {}", comparisonText(), _value));
+        context.fail(u8format(u8"The value must be {} {}", comparisonText(), _value));
     }
 }
 
@@ -110,8 +110,9 @@ void MinMaxMatrixConstraint::validateValueList(const ValidationContext &context)
         rowCount = value->size();
     }
     if (isNotValid(toInteger(rowCount))) {
-        throwValidationError(
+        context.fail(
             u8format(u8"The number of rows in this value matrix must be {} {}", comparisonText(), _value));
+        return;
     }
     for (const auto &columns : *value) {
         std::size_t columnCount = 1;
@@ -119,10 +120,9 @@ void MinMaxMatrixConstraint::validateValueList(const ValidationContext &context)
             columnCount = columns->size();
         }
         if (isSecondNotValid(toInteger(columnCount))) {
-            throwValidationError(
-                u8format(u8"The number of columns in this row must be {} {}", comparisonText(), _second),
-                value->namePath(),
-                value->location());
+            context.fail(
+                u8format(u8"The number of columns in this row must be {} {}", comparisonText(), _second));
+            return;
         }
     }
 }
@@ -133,7 +133,7 @@ void MinMaxDateConstraint::validateDate(
     const Date &value) const {
 
     if (isNotValid(value)) {
-        throwValidationError(u8format(u8"The date must be {} {}", comparisonText(), _value.toText()));
+        context.fail(u8format(u8"The date must be {} {}", comparisonText(), _value.toText()));
     }
 }
 
@@ -143,7 +143,7 @@ void MinMaxDateConstraint::validateDateTime(
     const DateTime &value) const {
 
     if (isNotValid(value.date())) {
-        throwValidationError(u8format(u8"The date in this date-time must be {} {}", comparisonText(), _value.toText()));
+        context.fail(u8format(u8"The date in this date-time must be {} {}", comparisonText(), _value.toText()));
     }
 }
 
@@ -153,7 +153,7 @@ void MinMaxDateTimeConstraint::validateDate(
     const Date &value) const {
 
     if (isNotValid(DateTime{value, Time{}})) {
-        throwValidationError(u8format(u8"The date must be {} {}", comparisonText(), _value.date().toText()));
+        context.fail(u8format(u8"The date must be {} {}", comparisonText(), _value.date().toText()));
     }
 }
 
@@ -163,7 +163,7 @@ void MinMaxDateTimeConstraint::validateDateTime(
     const DateTime &value) const {
 
     if (isNotValid(value)) {
-        throwValidationError(u8format(u8"The date-time must be {} {}", comparisonText(), _value.toText()));
+        context.fail(u8format(u8"The date-time must be {} {}", comparisonText(), _value.toText()));
     }
 }
 
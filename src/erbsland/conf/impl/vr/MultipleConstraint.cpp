@@ -45,7 +45,7 @@ void MultipleIntegerConstraint::validateInteger(
     const Integer value) const {
 
     if (isNotValid(value)) {
-        throwValidationError(u8format(u8"The value {} {}", comparisonText(), _divisor));
+        context.fail(u8format(u8"The value {} {}", comparisonText(), _divisor));
     }
 }
 
@@ -55,7 +55,7 @@ void MultipleIntegerConstraint::validateText(
     const String &value) const {
 
     if (isNotValid(static_cast<Integer>(value.characterLength()))) {
-        throwValidationError(u8format(u8"The number of characters in this text {} {}", comparisonText(), _divisor));
+        context.fail(u8format(u8"The number of characters in this text {} {}", comparisonText(), _divisor));
     }
 }
 
@@ -65,35 +65,35 @@ void MultipleIntegerConstraint::validateBytes(
     const Bytes &value) const {
 
     if (isNotValid(static_cast<Integer>(value.size()))) {
-        throwValidationError(u8format(u8"The number of bytes {} {}", comparisonText(), _divisor));
+        context.fail(u8format(u8"The number of bytes {} {}", comparisonText(), _divisor));
     }
 }
 
 
 void MultipleIntegerConstraint::validateValueList(const ValidationContext &context) const {
     if (isNotValid(static_cast<Integer>(context.value->asValueList().size()))) {
-        throwValidationError(u8format(u8"The number of values in this list {} {}", comparisonText(), _divisor));
+        context.fail(u8format(u8"The number of values in this list {} {}", comparisonText(), _divisor));
     }
 }
 
 
 void MultipleIntegerConstraint::validateSectionWithNames(const ValidationContext &context) const {
     if (isNotValid(static_cast<Integer>(context.value->size()))) {
-        throwValidationError(u8format(u8"The number of entries in this section {} {}", comparisonText(), _divisor));
+        context.fail(u8format(u8"The number of entries in this section {} {}", comparisonText(), _divisor));
     }
 }
 
 
 void MultipleIntegerConstraint::validateSectionWithTexts(const ValidationContext &context) const {
     if (isNotValid(static_cast<Integer>(context.value->size()))) {
-        throwValidationError(u8format(u8"The number of entries in this section {} {}", comparisonText(), _divisor));
+        context.fail(u8format(u8"The number of entries in this section {} {}", comparisonText(), _divisor));
     }
 }
 
 
 void MultipleIntegerConstraint::validateSectionList(const ValidationContext &context) const {
     if (isNotValid(static_cast<Integer>(context.value->size()))) {
-        throwValidationError(u8format(u8"The number of entries in this section list {} {}", comparisonText(), _divisor));
+        context.fail(u8format(u8"The number of entries in this section list {} {}", comparisonText(), _divisor));
     }
 }
 
@@ -122,7 +122,7 @@ void MultipleFloatConstraint::validateFloat(
     [[maybe_unused]] const ValidationContext &context,
     const Float value) const {
     if (isNotValid(value)) {
-        throwValidationError(u8format(u8"The value {} {:.6} (within platform tolerance)", comparisonText(), _divisor));
+        context.fail(u8format(u8"The value {} {:.6} (within platform tolerance)", comparisonText(), _divisor));
     }
 }
 
@@ -160,11 +160,13 @@ auto MultipleMatrixConstraint::isNotValidColumns(const Integer tested) const ->
 void MultipleMatrixConstraint::validateValueList(const ValidationContext &context) const {
     const auto &value = context.value;
     if (isNotValidRows(static_cast<Integer>(value->size()))) {
-        throwValidationError(u8format(u8"The number of rows {} {}", comparisonText(), _divisor));
+        context.fail(u8format(u8"The number of rows {} {}", comparisonText(), _divisor));
+        return;
     }
     for (const auto &columns : *value) {
         if (isNotValidColumns(static_cast<Integer>(columns->size()))) {
-            throwValidationError(u8format(u8"The number of columns {} {}", comparisonText(), _columnsDivisor));
+            context.fail(u8format(u8"The number of columns {} {}", comparisonText(), _columnsDivisor));
+            return;
         }
     }
 }
@@ -8,10 +8,15 @@
 #include "ValidationError.hpp"
 
 #include "../utilities/InternalError.hpp"
+#include "../utilities/WorkerPool.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <ranges>
 #include <stdexcept>
+#include <thread>
+#include <tuple>
 
 
 namespace erbsland::conf::impl {
@@ -23,14 +28,80 @@ Rules::Rules() : _root{std::make_shared<Rule>()} {
 
 
 void Rules::validate(const conf::ValuePtr &value, const Integer version) {
-    if (value == nullptr) {
-        throwValidationError(u8"Cannot validate a null value");
+    requireValidationTarget(value);
+    auto validator = DocumentValidator{validationPlan(version), value};
+    validator.validate();
+}
+
+
+auto Rules::validateWithReport(const conf::ValuePtr &value, const Integer version) -> vr::ValidationReport {
+    requireValidationTarget(value);
+    vr::ValidationReport report;
+    auto validator = DocumentValidator{validationPlan(version), value, &report};
+    validator.validate();
+    return report;
+}
+
+
+void Rules::compile(const Integer version) {
+    std::ignore = validationPlan(version);
+}
+
+
+auto Rules::validateBatch(
+    const std::span<const DocumentPtr> documents,
+    const Integer version,
+    const vr::BatchExecutor &executor) -> vr::ValidationReportList {
+
+    vr::ValidationReportList reports(documents.size());
+    if (documents.empty()) {
+        return reports;
     }
-    if (!(value->isDocument() || value->isSectionWithNames())) {
-        throwValidationError(u8"The value to validate must be a document or a section with names");
+    const auto plan = validationPlan(version);
+    const auto taskCount = batchTaskCount(documents.size());
+    std::atomic<std::size_t> nextIndex{0};
+    std::mutex exceptionMutex;
+    std::exception_ptr firstException;
+    const std::function<void()> task = [&]() -> void {
+        try {
+            // Each task validates documents until none are left, reusing its scratch buffers.
+            DocumentValidator::Scratch scratch;
+            for (auto index = nextIndex.fetch_add(1); index < documents.size(); index = nextIndex.fetch_add(1)) {
+                auto &report = reports[index];
+                try {
+                    requireValidationTarget(documents[index]);
+                    auto validator = DocumentValidator{plan, documents[index], &report, &scratch};
+                    validator.validate();
+                } catch (const Error &error) {
+                    report.addError(error);
+                }
+            }
+        } catch (...) {
+            std::scoped_lock lock{exceptionMutex};
+            if (firstException == nullptr) {
+                firstException = std::current_exception();
+            }
+        }
+    };
+    if (executor) {
+        executor(taskCount, task);
+    } else if (taskCount == 1) {
+        task();
+    } else {
+        WorkerPool pool{taskCount};
+        std::vector<std::future<void>> futures;
+        futures.reserve(taskCount);
+        for (std::size_t i = 0; i < taskCount; ++i) {
+            futures.emplace_back(pool.submit(task));
+        }
+        for (auto &future : futures) {
+            future.get();
+        }
     }
-    auto validator = DocumentValidator{_root, value, version};
-    validator.validate();
+    if (firstException != nullptr) {
+        std::rethrow_exception(firstException);
+    }
+    return reports;
 }
 
 
@@ -62,6 +133,7 @@ auto Rules::addRule(const RulePtr &rule) -> void {
     rule->setParent(parentRule);
     parentRule->addChild(rule);
     _isDefinitionValidated = false;
+    clearValidationPlans();
 }
 
 
@@ -103,6 +175,7 @@ auto Rules::addAlternativeRule(const RulePtr &rule) -> void {
     rule->setParent(alternativeRule);
     alternativeRule->addChild(rule);
     _isDefinitionValidated = false;
+    clearValidationPlans();
 }
 
 
@@ -118,6 +191,17 @@ void Rules::validateDefinition() {
     RulesDefinitionValidator validator{_root};
     validator.validate();
     _isDefinitionValidated = true;
+    clearValidationPlans();
+}
+
+
+auto Rules::validationPlan(const Integer version) -> ValidationPlanPtr {
+    std::scoped_lock lock{_validationPlanMutex};
+    auto &plan = _validationPlans[version];
+    if (plan == nullptr) {
+        plan = ValidationPlan::create(_root, version);
+    }
+    return plan;
 }
 
 
@@ -141,6 +225,28 @@ auto Rules::ruleForNamePath(const NamePath &path, std::size_t maxDepth) const ->
 }
 
 
+void Rules::requireValidationTarget(const conf::ValuePtr &value) {
+    if (value == nullptr) {
+        throwValidationError(u8"Cannot validate a null value");
+    }
+    if (!(value->isDocument() || value->isSectionWithNames())) {
+        throwValidationError(u8"The value to validate must be a document or a section with names");
+    }
+}
+
+
+void Rules::clearValidationPlans() {
+    std::scoped_lock lock{_validationPlanMutex};
+    _validationPlans.clear();
+}
+
+
+auto Rules::batchTaskCount(const std::size_t documentCount) noexcept -> std::size_t {
+    const auto coreCount = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    return std::min(documentCount, coreCount);
+}
+
+
 #ifdef ERBSLAND_CONF_INTERNAL_VIEWS
 auto internalView(const Rules &rule) -> InternalViewPtr {
     return internalView(rule._root);
@@ -4,9 +4,13 @@
 
 
 #include "Rule.hpp"
+#include "ValidationPlan.hpp"
 
 #include "../../vr/Rules.hpp"
 
+#include <mutex>
+#include <unordered_map>
+
 
 namespace erbsland::conf::impl {
 
@@ -19,6 +23,9 @@ class DocumentValidator;
 
 /// A set of validation rules.
 ///
+/// The methods of the implementation interface that modify the rules must only be used while building the rules,
+/// before they are shared. Validation only reads the rules. The compiled plans are cached and protected by a mutex.
+///
 class Rules : public vr::Rules {
 public:
     Rules();
@@ -28,6 +35,12 @@ public:
 
 public: // public interface
     void validate(const conf::ValuePtr &value, Integer version) override;
+    [[nodiscard]] auto validateWithReport(const conf::ValuePtr &value, Integer version) -> vr::ValidationReport override;
+    void compile(Integer version) override;
+    [[nodiscard]] auto validateBatch(
+        std::span<const DocumentPtr> documents,
+        Integer version,
+        const vr::BatchExecutor &executor = {}) -> vr::ValidationReportList override;
 
 public: // implementation interface
     /// Test if there are no rules defined.
@@ -53,6 +66,11 @@ public: // implementation interface
     /// Validate this rules definition for correctness.
     /// @throws Error (Validation) for any invalid rule definition.
     void validateDefinition();
+    /// Get the validation plan for a version.
+    /// The plan is compiled on first use and cached until the rules are modified.
+    /// @param version The version of the document format.
+    /// @return The compiled plan.
+    [[nodiscard]] auto validationPlan(Integer version) -> ValidationPlanPtr;
 
 public: // tests
 #ifdef ERBSLAND_CONF_INTERNAL_VIEWS
@@ -60,12 +78,23 @@ public: // tests
     friend auto internalView(const RulesPtr &rule) -> InternalViewPtr;
 #endif
 
+private:
+    /// Make sure the value can be validated.
+    /// @throws Error (Validation) if the value is null, or is no document or section with names.
+    static void requireValidationTarget(const conf::ValuePtr &value);
+    /// Remove all cached validation plans, after the rules were modified.
+    void clearValidationPlans();
+    /// Get the number of tasks for a batch validation.
+    [[nodiscard]] static auto batchTaskCount(std::size_t documentCount) noexcept -> std::size_t;
+
 private:
     friend class DocumentValidator;
 
 private:
     RulePtr _root; ///< The root rule of this set. Always a `Section` rule with no constraints.
     bool _isDefinitionValidated{false}; ///< If this rules definition was validated for correctness.
+    std::mutex _validationPlanMutex; ///< Protects the cached validation plans.
+    std::unordered_map<Integer, ValidationPlanPtr> _validationPlans; ///< The compiled plans for each version.
 };
 
 
@@ -4,6 +4,7 @@
 
 
 #include "MinMaxConstraint.hpp"
+#include "ValidationContext.hpp"
 #include "ValidationError.hpp"
 
 
@@ -26,7 +27,7 @@ void StringPartConstraint::validateText(const ValidationContext &context, const
             }
             expected.append(u8format(u8"\"{}\"", expValue.toSafeText()));
         }
-        throwValidationError(u8format(
+        context.fail(u8format(
             u8"The text {} {} {} ({})",
             isNegated() ? String{u8"must not"} : String{u8"does not"},
             partText(),
@@ -6,8 +6,11 @@
 #include "Rule.hpp"
 #include "ValidationTarget.hpp"
 
+#include "../../String.hpp"
 #include "../../Value.hpp"
 
+#include <optional>
+
 
 namespace erbsland::conf::impl {
 
@@ -25,10 +28,24 @@ public:
     conf::ValuePtr value;
     /// The validation rule.
     RulePtr rule;
+    /// The message of the first failure, reported by the constraint that is checked.
+    mutable std::optional<String> failureMessage;
 
 public:
-
+    /// Report that the value does not meet the checked constraint.
+    /// Only the first failure is kept.
+    /// @param message The error message for the failure.
+    void fail(String message) const {
+        if (!failureMessage.has_value()) {
+            failureMessage = std::move(message);
+        }
+    }
+
+    /// Test if a failure was reported.
+    [[nodiscard]] auto hasFailed() const noexcept -> bool {
+        return failureMessage.has_value();
+    }
 };
 
 
-}
\ No newline at end of file
+}
@@ -46,8 +46,8 @@ auto expectedValueTypeText(const RulePtr &rule, const Integer version) -> String
 }
 
 
-void throwExpectedVsActual(const RulePtr &rule, const ValuePtr &value, const Integer version) {
-    throwValidationError(
+auto expectedVsActualError(const RulePtr &rule, const ValuePtr &value, const Integer version) -> Error {
+    return validationError(
         u8format(
             u8"Expected {} but got {}",
             expectedValueTypeText(rule, version),
@@ -57,6 +57,9 @@ void throwExpectedVsActual(const RulePtr &rule, const ValuePtr &value, const Int
 }
 
 
+void throwExpectedVsActual(const RulePtr &rule, const ValuePtr &value, const Integer version) {
+    throw expectedVsActualError(rule, value, version);
 }
 
 
+}
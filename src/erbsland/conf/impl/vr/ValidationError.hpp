@@ -19,15 +19,21 @@ class Value;
 using ValuePtr = std::shared_ptr<Value>;
 
 
-/// Throw a validation error.
+/// Create a validation error.
 template<typename Msg, typename... Args>
-[[noreturn]] void throwValidationError(Msg &&message, Args&&... args) {
-    throw Error(
+[[nodiscard]] auto validationError(Msg &&message, Args&&... args) -> Error {
+    return Error(
         ErrorCategory::Validation,
         std::forward<Msg>(message),
         std::forward<Args>(args)...);
 }
 
+/// Throw a validation error.
+template<typename Msg, typename... Args>
+[[noreturn]] void throwValidationError(Msg &&message, Args&&... args) {
+    throw validationError(std::forward<Msg>(message), std::forward<Args>(args)...);
+}
+
 /// Create a text with possible types.
 [[nodiscard]] auto expectedRuleTypesText(const std::vector<vr::RuleType> &ruleTypes) -> String;
 
@@ -37,6 +43,13 @@ template<typename Msg, typename... Args>
 /// @return The textual representation of the expected value type.
 [[nodiscard]] auto expectedValueTypeText(const RulePtr &rule, Integer version) -> String;
 
+/// Create an error message when we got a value of an unexpected type.
+/// @param rule The rule.
+/// @param value The value with the unexpected type.
+/// @param version The version of the document.
+/// @return The validation error.
+[[nodiscard]] auto expectedVsActualError(const RulePtr &rule, const ValuePtr &value, Integer version) -> Error;
+
 /// Throw an error message when we got a value of an unexpected type.
 /// @param rule The rule.
 /// @param value The value with the unexpected type.
@@ -0,0 +1,129 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "ValidationPlan.hpp"
+
+
+#include "../utilities/InternalError.hpp"
+
+#include <bit>
+
+
+namespace erbsland::conf::impl {
+
+
+ValidationPlan::ValidationPlan(const RulePtr &root, const Integer version) : _version{version} {
+    ERBSLAND_CONF_REQUIRE_SAFETY(root != nullptr, "The root rule must not be null");
+    _nodes.emplace_back(Node{.rule = root});
+    // Assign the IDs breadth first, so the children of each rule get consecutive IDs.
+    for (std::size_t id = 0; id < _nodes.size(); ++id) {
+        const auto &children = _nodes[id].rule->childrenImpl();
+        if (!children.empty()) {
+            ERBSLAND_CONF_REQUIRE_SAFETY(
+                _nodes.size() + children.size() < cNoRule,
+                "Too many rules for a validation plan");
+            _nodes[id].firstChild = static_cast<RuleId>(_nodes.size());
+            _nodes[id].childCount = static_cast<uint32_t>(children.size());
+            for (const auto &child : children) {
+                _nodes.emplace_back(Node{.rule = child});
+            }
+        }
+        compileNode(static_cast<RuleId>(id));
+    }
+}
+
+
+auto ValidationPlan::create(const RulePtr &root, const Integer version) -> ValidationPlanPtr {
+    return std::make_shared<const ValidationPlan>(root, version);
+}
+
+
+auto ValidationPlan::namedChild(const RuleId parentId, const Name &name) const noexcept -> RuleId {
+    const auto &node = _nodes[parentId];
+    const auto hash = name.hash();
+    if (node.namedChildTable.empty()) {
+        // Scan forward, so the first child with a matching name wins, like in the index table.
+        for (std::size_t index = 0; index < node.namedChildren.size(); ++index) {
+            const auto childId = node.namedChildren[index];
+            if (node.namedChildHashes[index] == hash && _nodes[childId].rule->targetName() == name) {
+                return childId;
+            }
+        }
+        return cNoRule;
+    }
+    const auto mask = node.namedChildTable.size() - 1;
+    for (auto slot = hash & mask; node.namedChildTable[slot] != 0; slot = (slot + 1) & mask) {
+        const std::size_t index = node.namedChildTable[slot] - 1;
+        const auto childId = node.namedChildren[index];
+        if (node.namedChildHashes[index] == hash && _nodes[childId].rule->targetName() == name) {
+            return childId;
+        }
+    }
+    return cNoRule;
+}
+
+
+void ValidationPlan::compileNode(const RuleId id) {
+    auto &node = _nodes[id];
+    const auto &rule = node.rule;
+    node.usesIndexes = rule->hasKeyDefinitions() || rule->hasConstraint(vr::ConstraintType::Key);
+    node.usesDependencies = rule->hasDependencyDefinitions();
+    for (uint32_t position = 0; position < node.childCount; ++position) {
+        const auto childId = static_cast<RuleId>(node.firstChild + position);
+        const auto &childRule = _nodes[childId].rule;
+        const auto &ruleName = childRule->ruleName();
+        // The entry and name rules are used independently of the version.
+        if (ruleName == vrc::cReservedEntry) {
+            node.entryChild = childId;
+        } else if (ruleName == vrc::cReservedName) {
+            node.nameChild = childId;
+        }
+        if (!childRule->versionMask().matches(_version)) {
+            continue; // all other lookups only consider rules that are active for the version.
+        }
+        node.activeChildren.emplace_back(childId);
+        if (ruleName == vrc::cReservedAny) {
+            node.anyChild = childId; // the "any" rule is only used if no other rule matches.
+            continue;
+        }
+        node.namedChildren.emplace_back(childId);
+        node.namedChildHashes.emplace_back(childRule->targetName().hash());
+        if (childRule->type() != vr::RuleType::NotValidated &&
+            !ruleName.isReservedValidationRule() &&
+            !childRule->isOptional()) {
+            node.requiredChildren.emplace_back(childId);
+        }
+    }
+    buildNamedChildTable(id);
+}
+
+
+void ValidationPlan::buildNamedChildTable(const RuleId id) {
+    auto &node = _nodes[id];
+    if (node.namedChildren.size() <= cLinearScanLimit) {
+        return;
+    }
+    node.namedChildTable.assign(std::bit_ceil(node.namedChildren.size() * 2), 0);
+    const auto mask = node.namedChildTable.size() - 1;
+    for (std::size_t index = 0; index < node.namedChildren.size(); ++index) {
+        const auto hash = node.namedChildHashes[index];
+        const auto &name = _nodes[node.namedChildren[index]].rule->targetName();
+        auto slot = hash & mask;
+        bool isDuplicate = false;
+        while (node.namedChildTable[slot] != 0) {
+            const std::size_t existingIndex = node.namedChildTable[slot] - 1;
+            if (node.namedChildHashes[existingIndex] == hash &&
+                _nodes[node.namedChildren[existingIndex]].rule->targetName() == name) {
+                isDuplicate = true; // keep the first child with this name.
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+        if (!isDuplicate) {
+            node.namedChildTable[slot] = static_cast<uint32_t>(index + 1);
+        }
+    }
+}
+
+
+}
+
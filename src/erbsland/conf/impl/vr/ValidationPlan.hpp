@@ -0,0 +1,153 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "Rule.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+
+namespace erbsland::conf::impl {
+
+
+class ValidationPlan;
+using ValidationPlanPtr = std::shared_ptr<const ValidationPlan>;
+
+
+/// A flat, version-filtered plan to validate documents against a rule tree.
+///
+/// The plan is compiled once for a rule tree and a version. All rules are stored in a single list and are
+/// addressed by dense IDs. The children of a rule have consecutive IDs, so the position of a child in its
+/// parent can be used as an index into a bitset. For each rule, the plan resolves everything the validator
+/// needs for the selected version in advance: the children that are matched by name, including a lookup table
+/// with cached name hashes, the `vr_any`, `vr_entry` and `vr_name` children, the active alternatives and the
+/// children that must exist in a document.
+///
+/// A plan is immutable after it was created. It keeps the rules alive, but it does not observe changes to
+/// the rule tree. If the rules change, a new plan must be compiled.
+///
+/// @tested `VrValidationPlanTest`
+///
+class ValidationPlan final {
+public:
+    using RuleId = uint32_t;
+    using RuleIdList = std::vector<RuleId>;
+    using HashList = std::vector<std::size_t>;
+    using IndexTable = std::vector<uint32_t>;
+
+    /// The ID that is used if there is no rule.
+    ///
+    constexpr static RuleId cNoRule = std::numeric_limits<RuleId>::max();
+
+    /// The ID of the root rule.
+    ///
+    constexpr static RuleId cRootRule = 0;
+
+    /// The maximum number of named children that are searched using a linear scan.
+    ///
+    constexpr static std::size_t cLinearScanLimit = 16;
+
+    /// A single rule in the plan.
+    ///
+    struct Node {
+        RulePtr rule; ///< The rule of this node.
+        RuleId firstChild{cNoRule}; ///< The ID of the first child, or `cNoRule` if the rule has no children.
+        uint32_t childCount{0}; ///< The number of children, including the ones inactive for the version.
+        RuleId anyChild{cNoRule}; ///< The active `vr_any` child, or `cNoRule`.
+        RuleId entryChild{cNoRule}; ///< The `vr_entry` child, or `cNoRule`.
+        RuleId nameChild{cNoRule}; ///< The `vr_name` child with the name constraints, or `cNoRule`.
+        RuleIdList namedChildren; ///< The active children matched by their target name, in definition order.
+        HashList namedChildHashes; ///< The hashes of the target names, in the same order as `namedChildren`.
+        IndexTable namedChildTable; ///< Open-addressing table with `index + 1` of the named children, or empty.
+        RuleIdList requiredChildren; ///< The active children that must have a value, or a default.
+        RuleIdList activeChildren; ///< All children that are active for the version, in definition order.
+        bool usesIndexes{false}; ///< If this rule has key definitions or a key constraint.
+        bool usesDependencies{false}; ///< If this rule has dependency definitions.
+    };
+
+    using NodeList = std::vector<Node>;
+
+public:
+    /// Compile a new plan.
+    ///
+    /// @param root The root of the rule tree.
+    /// @param version The version to compile the plan for.
+    ///
+    ValidationPlan(const RulePtr &root, Integer version);
+
+    // defaults and deletions
+    ~ValidationPlan() = default;
+    ValidationPlan(const ValidationPlan&) = delete;
+    ValidationPlan(ValidationPlan&&) = delete;
+    auto operator=(const ValidationPlan&) -> ValidationPlan& = delete;
+    auto operator=(ValidationPlan&&) -> ValidationPlan& = delete;
+
+public:
+    /// Compile a new shared plan.
+    ///
+    /// @param root The root of the rule tree.
+    /// @param version The version to compile the plan for.
+    ///
+    [[nodiscard]] static auto create(const RulePtr &root, Integer version) -> ValidationPlanPtr;
+
+public:
+    /// The version this plan was compiled for.
+    ///
+    [[nodiscard]] auto version() const noexcept -> Integer { return _version; }
+
+    /// The number of rules in this plan.
+    ///
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return _nodes.size(); }
+
+    /// Access a node.
+    ///
+    /// @param id A valid rule ID.
+    ///
+    [[nodiscard]] auto node(const RuleId id) const noexcept -> const Node& { return _nodes[id]; }
+
+    /// Access the rule of a node.
+    ///
+    /// @param id A valid rule ID.
+    ///
+    [[nodiscard]] auto rule(const RuleId id) const noexcept -> const RulePtr& { return _nodes[id].rule; }
+
+    /// Get the position of a rule in the children of its parent.
+    ///
+    /// @param parentId The ID of the parent rule.
+    /// @param childId The ID of a child of the parent rule.
+    ///
+    [[nodiscard]] auto childPosition(const RuleId parentId, const RuleId childId) const noexcept -> std::size_t {
+        return childId - _nodes[parentId].firstChild;
+    }
+
+    /// Find the active child rule that matches a name.
+    ///
+    /// This only considers children that are active for the version. The `vr_any` child is never returned.
+    ///
+    /// @param parentId The ID of the parent rule.
+    /// @param name The name of the value.
+    /// @return The ID of the first matching child, or `cNoRule` if no child has this name.
+    ///
+    [[nodiscard]] auto namedChild(RuleId parentId, const Name &name) const noexcept -> RuleId;
+
+private:
+    /// Resolve the children of a node, after its child nodes were added to the list.
+    ///
+    void compileNode(RuleId id);
+
+    /// Build the lookup table for the named children of a node.
+    ///
+    void buildNamedChildTable(RuleId id);
+
+private:
+    Integer _version; ///< The version this plan was compiled for.
+    NodeList _nodes; ///< All rules, with the root at index zero.
+};
+
+
+}
+
@@ -4,11 +4,15 @@
 
 
 #include "Rule.hpp"
+#include "ValidationReport.hpp"
 
 #include "../Document.hpp"
 #include "../Value.hpp"
 
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <span>
 #include <vector>
 
 
@@ -17,10 +21,23 @@ namespace erbsland::conf::vr {
 
 class Rules;
 using RulesPtr = std::shared_ptr<Rules>;
+using ValidationReportList = std::vector<ValidationReport>;
+
+/// A function that runs the tasks of a batch validation.
+///
+/// The executor must call `task` exactly `taskCount` times and return after all calls have finished. The calls
+/// may run in parallel on any threads, e.g., using a thread pool of the application.
+///
+using BatchExecutor = std::function<void(std::size_t taskCount, const std::function<void()> &task)>;
 
 
 /// A set of validation rules.
 ///
+/// *Multithreading*: Rules are immutable after they were created. All methods of this interface can be called
+/// concurrently from multiple threads, sharing one instance of the rules, as long as each thread validates
+/// a different document. A document must not be validated by multiple threads at the same time, as the validation
+/// assigns meta-data to its values and adds missing default values.
+///
 class Rules {
 public:
     /// Default destructor.
@@ -37,6 +54,47 @@ public:
     /// @throws Error (Validation) On any validation error.
     virtual void validate(const ValuePtr &value, Integer version) = 0;
 
+    /// Validate a document or document branch and collect all errors in a report.
+    ///
+    /// In contrast to `validate()`, this method does not stop at the first error. If a value fails the
+    /// validation, the error is added to the report and the validation continues with the next value. The
+    /// values in the branch of a failed value are not validated.
+    ///
+    /// Like `validate()`, the validation assigns meta-data to the values and adds missing values with defaults.
+    ///
+    /// @param value The value or document to validate.
+    /// @param version The version of the document to validate.
+    /// @return The report with all validation errors.
+    /// @throws Error (Validation) If the value is null, or is no document or section with names.
+    [[nodiscard]] virtual auto validateWithReport(const ValuePtr &value, Integer version) -> ValidationReport = 0;
+
+    /// Compile these rules for a version in advance.
+    ///
+    /// Before the first document is validated for a version, the rules are compiled into a flat plan that
+    /// only contains the lookups required for this version. The plan is kept and reused for all subsequent
+    /// validations with the same version. Calling this method is optional. Use it to move the one-time cost of
+    /// compiling the rules out of the first validation.
+    ///
+    /// @param version The version of the documents that will be validated.
+    virtual void compile(Integer version) = 0;
+
+    /// Validate multiple documents in parallel and collect the errors of each document in a report.
+    ///
+    /// Each document is validated like with `validateWithReport()`. The documents are distributed to a number of
+    /// tasks, which validate the documents one after the other, reusing their internal buffers. Without an
+    /// executor, the tasks run on a temporary pool with one thread per available core.
+    ///
+    /// If a document is null, or is no document or section with names, its report contains the error.
+    ///
+    /// @param documents The documents to validate. Each document must only be passed once.
+    /// @param version The version of the documents to validate.
+    /// @param executor An optional executor that runs the tasks. If empty, an internal thread pool is used.
+    /// @return One report for each document, in the same order as the documents.
+    [[nodiscard]] virtual auto validateBatch(
+        std::span<const DocumentPtr> documents,
+        Integer version,
+        const BatchExecutor &executor = {}) -> ValidationReportList = 0;
+
 public:
     /// Create and validate rules from a rules-definition document.
     ///
@@ -0,0 +1,26 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "ValidationReport.hpp"
+
+
+namespace erbsland::conf::vr {
+
+
+void ValidationReport::addError(Error error) {
+    _errors.emplace_back(std::move(error));
+}
+
+
+void ValidationReport::throwIfInvalid() const {
+    if (!_errors.empty()) {
+        throw _errors.front();
+    }
+}
+
+
+void ValidationReport::clear() noexcept {
+    _errors.clear();
+}
+
+
+}
@@ -0,0 +1,81 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "../Error.hpp"
+
+#include <vector>
+
+
+namespace erbsland::conf::vr {
+
+
+/// The result of a validation that collects all errors.
+///
+/// The report is created by `Rules::validateWithReport()`. Each error contains the message, as well as the
+/// name-path and location of the value that failed the validation.
+///
+/// @tested `VrValidationReportTest`
+///
+class ValidationReport final {
+public:
+    /// The list of errors.
+    using ErrorList = std::vector<Error>;
+
+public:
+    /// Create an empty report.
+    ValidationReport() = default;
+
+    /// Default copy constructor.
+    ValidationReport(const ValidationReport&) = default;
+    /// Default move constructor.
+    ValidationReport(ValidationReport&&) noexcept = default;
+    /// Default destructor.
+    ~ValidationReport() = default;
+    /// Default copy assignment.
+    auto operator=(const ValidationReport&) -> ValidationReport& = default;
+    /// Default move assignment.
+    auto operator=(ValidationReport&&) noexcept -> ValidationReport& = default;
+
+public:
+    /// Test if the validated document met all rules.
+    ///
+    [[nodiscard]] auto isValid() const noexcept -> bool { return _errors.empty(); }
+
+    /// Test if the report contains errors.
+    ///
+    [[nodiscard]] auto hasErrors() const noexcept -> bool { return !_errors.empty(); }
+
+    /// Get the number of errors.
+    ///
+    [[nodiscard]] auto errorCount() const noexcept -> std::size_t { return _errors.size(); }
+
+    /// Access all errors.
+    ///
+    [[nodiscard]] auto errors() const noexcept -> const ErrorList& { return _errors; }
+
+    /// Add an error to this report.
+    ///
+    /// @param error The error to add.
+    ///
+    void addError(Error error);
+
+    /// Throw the first error of this report.
+    ///
+    /// Does nothing if the report contains no errors.
+    ///
+    /// @throws Error (Validation) The first error of the report.
+    ///
+    void throwIfInvalid() const;
+
+    /// Remove all errors from this report.
+    ///
+    void clear() noexcept;
+
+private:
+    ErrorList _errors; ///< The collected errors.
+};
+
+
+}
@@ -11,5 +11,6 @@
 #include "RuleType.hpp"
 #include "Rules.hpp"
 #include "RulesBuilder.hpp"
+#include "ValidationReport.hpp"
 
 
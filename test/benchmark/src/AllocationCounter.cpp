@@ -0,0 +1,69 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "AllocationCounter.hpp"
+
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+namespace {
+
+
+std::atomic<std::size_t> gAllocations{0}; ///< The number of allocations.
+std::atomic<std::size_t> gAllocatedBytes{0}; ///< The number of allocated bytes.
+
+
+auto countedAllocate(const std::size_t size) -> void* {
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    gAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (auto *ptr = std::malloc(size == 0 ? 1 : size); ptr != nullptr) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+
+}
+
+
+auto AllocationCounter::allocations() noexcept -> std::size_t {
+    return gAllocations.load(std::memory_order_relaxed);
+}
+
+
+auto AllocationCounter::allocatedBytes() noexcept -> std::size_t {
+    return gAllocatedBytes.load(std::memory_order_relaxed);
+}
+
+
+// Replacements of the global allocation functions. Only the benchmark executable uses these.
+auto operator new(const std::size_t size) -> void* {
+    return countedAllocate(size);
+}
+
+
+auto operator new[](const std::size_t size) -> void* {
+    return countedAllocate(size);
+}
+
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+
+void operator delete[](void *ptr) noexcept {
+    std::free(ptr);
+}
+
+
+void operator delete(void *ptr, std::size_t /*size*/) noexcept {
+    std::free(ptr);
+}
+
+
+void operator delete[](void *ptr, std::size_t /*size*/) noexcept {
+    std::free(ptr);
+}
@@ -0,0 +1,23 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include <cstddef>
+
+
+/// Counts the heap allocations made by the benchmark process.
+///
+/// The counter is fed by replacements of the global `operator new` and `operator new[]` in
+/// `AllocationCounter.cpp`. Aligned allocations are not counted, as the parser does not use over-aligned types.
+///
+class AllocationCounter final {
+public:
+    /// Get the total number of allocations since the start of the process.
+    ///
+    [[nodiscard]] static auto allocations() noexcept -> std::size_t;
+
+    /// Get the total number of allocated bytes since the start of the process.
+    ///
+    [[nodiscard]] static auto allocatedBytes() noexcept -> std::size_t;
+};
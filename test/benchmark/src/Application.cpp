@@ -0,0 +1,186 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "Application.hpp"
+
+
+#include "CorpusGenerator.hpp"
+
+#include <erbsland/conf/Error.hpp>
+
+#include <algorithm>
+#include <format>
+#include <iostream>
+#include <ranges>
+#include <stdexcept>
+#include <string_view>
+
+
+using namespace el::conf;
+
+
+auto Application::run(const int argc, char *argv[]) -> int {
+    if (const auto returnCode = parseArguments(argc, argv); returnCode != 0) {
+        return std::max(returnCode, 0); // a negative value requests a regular exit, e.g. after `--help`.
+    }
+    try {
+        std::filesystem::create_directories(_argWorkDirectory);
+        CorpusGenerator generator{_argWorkDirectory, _argSizeMB * 1'000'000U};
+        printHeader();
+        for (const auto &corpusName : _argCorpora) {
+            const auto corpus = generator.generate(corpusName);
+            StageRunner runner{
+                corpus,
+                _argIterations,
+                _argMappedFiles,
+                _argGenerator ? el::conf::impl::LexerEngine::Generator : el::conf::impl::LexerEngine::StateMachine,
+                _argArena};
+            for (const auto stage : _argStages) {
+                printResult(runner.run(stage));
+            }
+        }
+        if (!_argKeepFiles) {
+            std::filesystem::remove_all(_argWorkDirectory);
+        }
+    } catch (const Error &error) {
+        std::cerr << "Error: " << error.toText().toCharString() << "\n";
+        return 1;
+    } catch (const std::exception &error) {
+        std::cerr << "Unexpected exception: " << error.what() << "\n";
+        return 2;
+    }
+    return 0;
+}
+
+
+auto Application::parseArguments(const int argc, char *argv[]) -> int {
+    std::vector<std::string_view> args(argv + 1, argv + argc);
+    const auto corpusNames = CorpusGenerator::names();
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const auto &arg = args[i];
+        auto nextArg = [&]() -> std::string_view {
+            if (args.size() <= i + 1) {
+                throw std::invalid_argument(std::format("Missing argument for {}.", arg));
+            }
+            return args[++i];
+        };
+        try {
+            if (arg == "--help" || arg == "-h") {
+                printHelp(argv[0]);
+                return -1;
+            }
+            if (arg == "--corpus") {
+                const auto name = nextArg();
+                if (std::ranges::find(corpusNames, name) == corpusNames.end()) {
+                    throw std::invalid_argument(std::format("Unknown corpus: {}", name));
+                }
+                _argCorpora.emplace_back(name);
+            } else if (arg == "--stage") {
+                const auto name = nextArg();
+                const auto stages = StageRunner::allStages();
+                const auto it = std::ranges::find_if(stages, [&](const Stage stage) -> bool {
+                    return StageRunner::stageName(stage) == name;
+                });
+                if (it == stages.end()) {
+                    throw std::invalid_argument(std::format("Unknown stage: {}", name));
+                }
+                _argStages.push_back(*it);
+            } else if (arg == "--size") {
+                _argSizeMB = std::stoul(std::string{nextArg()});
+                if (_argSizeMB == 0 || _argSizeMB > 100) {
+                    throw std::invalid_argument("The size must be between 1 and 100 MB.");
+                }
+            } else if (arg == "--iterations") {
+                _argIterations = std::stoul(std::string{nextArg()});
+                if (_argIterations == 0) {
+                    throw std::invalid_argument("At least one iteration is required.");
+                }
+            } else if (arg == "--work-dir") {
+                _argWorkDirectory = std::filesystem::path{nextArg()};
+            } else if (arg == "--csv") {
+                _argCsv = true;
+            } else if (arg == "--keep-files") {
+                _argKeepFiles = true;
+            } else if (arg == "--mapped-files") {
+                _argMappedFiles = true;
+            } else if (arg == "--generator") {
+                _argGenerator = true;
+            } else if (arg == "--arena") {
+                _argArena = true;
+            } else {
+                throw std::invalid_argument(std::format("Unknown argument: {}", arg));
+            }
+        } catch (const std::exception &error) {
+            std::cerr << "Error: " << error.what() << "\n";
+            return 2;
+        }
+    }
+    if (_argCorpora.empty()) {
+        _argCorpora.assign(corpusNames.begin(), corpusNames.end());
+    }
+    if (_argStages.empty()) {
+        _argStages = StageRunner::allStages();
+    }
+    if (_argWorkDirectory.empty()) {
+        _argWorkDirectory = std::filesystem::temp_directory_path() / "erbsland-configuration-benchmarks";
+    }
+    return 0;
+}
+
+
+void Application::printHelp(const std::string_view command) const {
+    std::cout << "Benchmarks for the individual stages of the Erbsland Configuration Parser.\n\n"
+        << "Usage: " << command << " [options]\n\n"
+        << "Options:\n"
+        << "  --help                 Displays this help text\n"
+        << "  --corpus <name>        Run only the given corpus (can be repeated)\n"
+        << "  --stage <name>         Run only the given stage (can be repeated)\n"
+        << "  --size <MB>            The size of each generated corpus in MB (default: 8)\n"
+        << "  --iterations <count>   The number of runs per stage, the fastest is reported (default: 3)\n"
+        << "  --work-dir <path>      The directory for the generated files\n"
+        << "  --keep-files           Keep the generated files after the run\n"
+        << "  --mapped-files         Read the files using memory-mapped sources\n"
+        << "  --generator            Use the coroutine generators in the lexer, assignments and builder stages\n"
+        << "  --arena                Parse the documents using arena allocation\n"
+        << "  --csv                  Write the results as CSV\n\n"
+        << "Corpora:";
+    for (const auto name : CorpusGenerator::names()) {
+        std::cout << " " << name;
+    }
+    std::cout << "\nStages:";
+    for (const auto stage : StageRunner::allStages()) {
+        std::cout << " " << StageRunner::stageName(stage);
+    }
+    std::cout << "\n";
+}
+
+
+void Application::printHeader() const {
+    if (_argCsv) {
+        std::cout << "corpus,stage,bytes,assignments,values,seconds,mb_per_second,"
+            "assignments_per_second,allocations,allocations_per_value,peak_rss_bytes\n";
+    } else {
+        std::cout << std::format("{:<18} {:<12} {:>10} {:>10} {:>14} {:>12} {:>12}\n",
+            "corpus", "stage", "time [ms]", "MB/s", "assignments/s", "alloc/value", "peak RSS MB");
+        std::cout << std::string(94, '-') << "\n";
+    }
+}
+
+
+void Application::printResult(const StageResult &result) const {
+    const auto seconds = std::chrono::duration<double>(result.measurement.duration).count();
+    const auto megabytesPerSecond = seconds > 0.0 ? static_cast<double>(result.bytes) / 1'000'000.0 / seconds : 0.0;
+    const auto assignmentsPerSecond = seconds > 0.0 ? static_cast<double>(result.assignments) / seconds : 0.0;
+    const auto allocationsPerValue = result.values > 0
+        ? static_cast<double>(result.measurement.allocations) / static_cast<double>(result.values) : 0.0;
+    if (_argCsv) {
+        std::cout << std::format("{},{},{},{},{},{:.6f},{:.3f},{:.1f},{},{:.3f},{}\n",
+            result.corpusName, StageRunner::stageName(result.stage), result.bytes, result.assignments,
+            result.values, seconds, megabytesPerSecond, assignmentsPerSecond, result.measurement.allocations,
+            allocationsPerValue, result.measurement.peakResidentSetSize);
+    } else {
+        std::cout << std::format("{:<18} {:<12} {:>10.1f} {:>10.2f} {:>14.0f} {:>12.2f} {:>12.1f}\n",
+            result.corpusName, StageRunner::stageName(result.stage), seconds * 1000.0, megabytesPerSecond,
+            assignmentsPerSecond, allocationsPerValue,
+            static_cast<double>(result.measurement.peakResidentSetSize) / 1'000'000.0);
+    }
+}
@@ -0,0 +1,42 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "StageRunner.hpp"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+
+/// The benchmark application.
+///
+/// Generates the synthetic corpora, runs the selected stages for each corpus and prints the results.
+///
+class Application final {
+public:
+    Application() = default;
+    ~Application() = default;
+
+public:
+    auto run(int argc, char *argv[]) -> int;
+
+private:
+    auto parseArguments(int argc, char *argv[]) -> int;
+    void printHelp(std::string_view command) const;
+    void printHeader() const;
+    void printResult(const StageResult &result) const;
+
+private:
+    std::vector<std::string> _argCorpora; ///< The selected corpora.
+    std::vector<Stage> _argStages; ///< The selected stages.
+    std::size_t _argSizeMB{8}; ///< The size of each corpus in MB.
+    std::size_t _argIterations{3}; ///< The number of iterations for each stage.
+    std::filesystem::path _argWorkDirectory; ///< The directory for the generated files.
+    bool _argCsv{false}; ///< If the output is written as CSV.
+    bool _argKeepFiles{false}; ///< If the generated files are kept after the run.
+    bool _argMappedFiles{false}; ///< If the files are read using memory-mapped sources.
+    bool _argGenerator{false}; ///< If the lexer stages use the coroutine generators.
+    bool _argArena{false}; ///< If the parser uses arena allocation.
+};
@@ -0,0 +1,38 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+
+/// A generated set of configuration documents used as input for the benchmark stages.
+///
+struct Corpus final {
+    /// The name of the corpus, as used on the command line.
+    ///
+    std::string name;
+
+    /// The document that is passed to the parser.
+    ///
+    std::filesystem::path mainFile;
+
+    /// All files of this corpus, including the main file and all included files.
+    ///
+    std::vector<std::filesystem::path> files;
+
+    /// The total size of all files in bytes.
+    ///
+    std::size_t totalSize{0};
+
+    /// The validation-rules document for the validator stage.
+    ///
+    std::string rulesText;
+
+    /// If the documents in this corpus are signed.
+    ///
+    bool isSigned{false};
+};
@@ -0,0 +1,310 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "CorpusGenerator.hpp"
+
+
+#include <erbsland/conf/Signer.hpp>
+
+#include <array>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+
+
+using namespace el::conf;
+
+
+namespace {
+
+
+/// The number of documents included by the main document of the include corpus.
+constexpr std::size_t cIncludeFileCount = 64;
+
+/// The number of lines for each multi-line text.
+constexpr std::size_t cMultiLineTextLines = 40;
+
+/// The number of lines for each code block.
+constexpr std::size_t cCodeBlockLines = 20;
+
+/// The number of rows and columns of the integer matrices.
+constexpr std::size_t cIntegerMatrixSize = 16;
+
+/// The number of rows and columns of the float matrices.
+constexpr std::size_t cFloatMatrixSize = 8;
+
+/// The words used to build texts.
+constexpr std::array<std::string_view, 16> cWords = {
+    "configuration", "parser", "value", "section", "cluster", "network", "timeout", "service",
+    "replica", "storage", "index", "policy", "region", "endpoint", "retry", "gateway"};
+
+
+/// A signer for the signed corpus, that just places the document digest into the signature.
+///
+class BenchmarkSignatureSigner final : public SignatureSigner {
+public:
+    auto sign(const SignatureSignerData &data) -> String override {
+        return data.signingPersonText + u8";" + data.documentDigest;
+    }
+};
+
+
+}
+
+
+CorpusGenerator::CorpusGenerator(std::filesystem::path directory, const std::size_t targetSize)
+:
+    _directory{std::move(directory)},
+    _targetSize{targetSize} {
+}
+
+
+auto CorpusGenerator::names() -> std::vector<std::string_view> {
+    return {"wide-sections", "deep-name-paths", "multi-line-texts", "value-matrices", "include-files", "signed"};
+}
+
+
+auto CorpusGenerator::generate(const std::string_view name) -> Corpus {
+    // Reset the random generator, so each corpus is the same, no matter which other corpora are generated.
+    _random.seed(0x45524253);
+    if (name == "wide-sections") {
+        return wideSections();
+    }
+    if (name == "deep-name-paths") {
+        return deepNamePaths();
+    }
+    if (name == "multi-line-texts") {
+        return multiLineTexts();
+    }
+    if (name == "value-matrices") {
+        return valueMatrices();
+    }
+    if (name == "include-files") {
+        return includeFiles();
+    }
+    if (name == "signed") {
+        return signedDocuments();
+    }
+    throw std::invalid_argument(std::format("Unknown corpus: {}", name));
+}
+
+
+auto CorpusGenerator::wideSections() -> Corpus {
+    Corpus corpus{.name = "wide-sections"};
+    const auto directory = createCorpusDirectory(corpus.name);
+    const auto content = generateContent(_targetSize, [this](std::string &text, const std::size_t index) {
+        writeWideSection(text, index);
+    });
+    corpus.mainFile = directory / "main.elcl";
+    corpus.files.push_back(corpus.mainFile);
+    corpus.totalSize = writeFile(corpus.mainFile, content);
+    corpus.rulesText = wideSectionRules();
+    return corpus;
+}
+
+
+auto CorpusGenerator::deepNamePaths() -> Corpus {
+    Corpus corpus{.name = "deep-name-paths"};
+    const auto directory = createCorpusDirectory(corpus.name);
+    const auto content = generateContent(_targetSize, [this](std::string &text, const std::size_t index) {
+        // Use nine name path elements in total, which is close to the limit of ten elements.
+        text += std::format(
+            "[tree_{}.node_{}.level_3.level_4.level_5.level_6.level_7.level_8]\n",
+            index / 64, index % 64);
+        text += std::format("leaf_count: {}\n", _random() % 100'000);
+        text += std::format("leaf_name: \"{}-{}\"\n", cWords[index % cWords.size()], index);
+    });
+    corpus.mainFile = directory / "main.elcl";
+    corpus.files.push_back(corpus.mainFile);
+    corpus.totalSize = writeFile(corpus.mainFile, content);
+    std::string rules = "[vr_any]\ntype: \"section\"\n[vr_any.vr_any]\ntype: \"section\"\n";
+    std::string path = "vr_any.vr_any";
+    for (std::size_t level = 3; level <= 8; ++level) {
+        path += std::format(".level_{}", level);
+        rules += std::format("[{}]\ntype: \"section\"\n", path);
+    }
+    rules += std::format("[{}.leaf_count]\ntype: \"integer\"\nminimum: 0\n", path);
+    rules += std::format("[{}.leaf_name]\ntype: \"text\"\nmaximum: 100\n", path);
+    corpus.rulesText = std::move(rules);
+    return corpus;
+}
+
+
+auto CorpusGenerator::multiLineTexts() -> Corpus {
+    Corpus corpus{.name = "multi-line-texts"};
+    const auto directory = createCorpusDirectory(corpus.name);
+    const auto content = generateContent(_targetSize, [this](std::string &text, const std::size_t index) {
+        text += std::format("[document_{}]\n", index);
+        text += "description: \"\"\"\n";
+        for (std::size_t line = 0; line < cMultiLineTextLines; ++line) {
+            text += "    ";
+            for (std::size_t word = 0; word < 12; ++word) {
+                if (word > 0) {
+                    text += ' ';
+                }
+                text += cWords[_random() % cWords.size()];
+            }
+            text += (line % 8 == 7) ? "\\n\n" : "\n";
+        }
+        text += "    \"\"\"\n";
+        text += "script:\n    ```shell\n";
+        for (std::size_t line = 0; line < cCodeBlockLines; ++line) {
+            text += std::format(
+                "    run --{}={} --{} \"{}\"\n",
+                cWords[_random() % cWords.size()], _random() % 1000,
+                cWords[_random() % cWords.size()], cWords[_random() % cWords.size()]);
+        }
+        text += "    ```\n";
+    });
+    corpus.mainFile = directory / "main.elcl";
+    corpus.files.push_back(corpus.mainFile);
+    corpus.totalSize = writeFile(corpus.mainFile, content);
+    corpus.rulesText =
+        "[vr_any]\ntype: \"section\"\n"
+        "[vr_any.description]\ntype: \"text\"\nminimum: 1\n"
+        "[vr_any.script]\ntype: \"text\"\nminimum: 1\n";
+    return corpus;
+}
+
+
+auto CorpusGenerator::valueMatrices() -> Corpus {
+    Corpus corpus{.name = "value-matrices"};
+    const auto directory = createCorpusDirectory(corpus.name);
+    const auto content = generateContent(_targetSize, [this](std::string &text, const std::size_t index) {
+        text += std::format("[matrix_{}]\n", index);
+        text += "integers:\n";
+        for (std::size_t row = 0; row < cIntegerMatrixSize; ++row) {
+            text += "    * ";
+            for (std::size_t column = 0; column < cIntegerMatrixSize; ++column) {
+                if (column > 0) {
+                    text += ", ";
+                }
+                text += std::format("{}", static_cast<int>(_random() % 20'000) - 10'000);
+            }
+            text += '\n';
+        }
+        text += "floats:\n";
+        for (std::size_t row = 0; row < cFloatMatrixSize; ++row) {
+            text += "    * ";
+            for (std::size_t column = 0; column < cFloatMatrixSize; ++column) {
+                if (column > 0) {
+                    text += ", ";
+                }
+                text += std::format("{}.{:04}", _random() % 100, _random() % 10'000);
+            }
+            text += '\n';
+        }
+    });
+    corpus.mainFile = directory / "main.elcl";
+    corpus.files.push_back(corpus.mainFile);
+    corpus.totalSize = writeFile(corpus.mainFile, content);
+    corpus.rulesText =
+        "[vr_any]\ntype: \"section\"\n"
+        "[vr_any.integers]\ntype: \"value_matrix\"\n"
+        "[vr_any.integers.vr_entry]\ntype: \"integer\"\nminimum: -10000\nmaximum: 10000\n"
+        "[vr_any.floats]\ntype: \"value_matrix\"\n"
+        "[vr_any.floats.vr_entry]\ntype: \"float\"\nminimum: 0.0\n";
+    return corpus;
+}
+
+
+auto CorpusGenerator::includeFiles() -> Corpus {
+    Corpus corpus{.name = "include-files"};
+    const auto directory = createCorpusDirectory(corpus.name);
+    corpus.mainFile = directory / "main.elcl";
+    corpus.files.push_back(corpus.mainFile);
+    corpus.totalSize = writeFile(corpus.mainFile, "# The main document.\n@include: \"parts/*.elcl\"\n");
+    std::filesystem::create_directories(directory / "parts");
+    const auto partSize = _targetSize / cIncludeFileCount;
+    for (std::size_t fileIndex = 0; fileIndex < cIncludeFileCount; ++fileIndex) {
+        const auto prefix = std::format("part_{}_section", fileIndex);
+        const auto content = generateContent(partSize, [&, this](std::string &text, const std::size_t index) {
+            writeWideSection(text, index, prefix);
+        });
+        const auto path = directory / "parts" / std::format("part_{:03}.elcl", fileIndex);
+        corpus.files.push_back(path);
+        corpus.totalSize += writeFile(path, content);
+    }
+    corpus.rulesText = wideSectionRules();
+    return corpus;
+}
+
+
+auto CorpusGenerator::signedDocuments() -> Corpus {
+    Corpus corpus{.name = "signed", .isSigned = true};
+    const auto directory = createCorpusDirectory(corpus.name);
+    const auto content = generateContent(_targetSize, [this](std::string &text, const std::size_t index) {
+        writeWideSection(text, index);
+    });
+    const auto unsignedFile = directory / "unsigned.elcl";
+    (void)writeFile(unsignedFile, content);
+    corpus.mainFile = directory / "main.elcl";
+    Signer signer{std::make_shared<BenchmarkSignatureSigner>()};
+    signer.sign(unsignedFile, corpus.mainFile, u8"benchmark");
+    std::filesystem::remove(unsignedFile);
+    corpus.files.push_back(corpus.mainFile);
+    corpus.totalSize = static_cast<std::size_t>(std::filesystem::file_size(corpus.mainFile));
+    corpus.rulesText = wideSectionRules();
+    return corpus;
+}
+
+
+auto CorpusGenerator::generateContent(
+    const std::size_t targetSize,
+    const std::function<void(std::string&, std::size_t)> &writeBlock) const -> std::string {
+
+    std::string content;
+    content.reserve(targetSize + 4096);
+    content += "# Generated by erbsland-configuration-benchmarks.\n";
+    for (std::size_t index = 0; content.size() < targetSize; ++index) {
+        writeBlock(content, index);
+    }
+    return content;
+}
+
+
+void CorpusGenerator::writeWideSection(std::string &content, const std::size_t index, const std::string_view prefix) {
+    content += std::format("[{}_{:06}]\n", prefix, index);
+    content += std::format("host: \"node-{}.cluster-{}.example.com\"\n", index, _random() % 16);
+    content += std::format("port: {}\n", 1024 + _random() % 60'000);
+    content += std::format("timeout: {} seconds\n", 1 + _random() % 300);
+    content += std::format("enabled: {}\n", (_random() % 2 == 0) ? "yes" : "no");
+    content += std::format("ratio: 0.{:04}\n", _random() % 10'000);
+    content += std::format("created: 2026-{:02}-{:02} {:02}:{:02}:00z\n",
+        1 + _random() % 12, 1 + _random() % 28, _random() % 24, _random() % 60);
+    content += std::format("tags: \"{}\", \"{}\", \"{}\"\n",
+        cWords[_random() % 4], cWords[4 + _random() % 4], cWords[8 + _random() % 4]);
+}
+
+
+auto CorpusGenerator::writeFile(const std::filesystem::path &path, const std::string &content) const -> std::size_t {
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    if (!file.is_open()) {
+        throw std::runtime_error(std::format("Could not write the file: {}", path.string()));
+    }
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    return content.size();
+}
+
+
+auto CorpusGenerator::createCorpusDirectory(const std::string_view name) const -> std::filesystem::path {
+    const auto directory = _directory / name;
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    return directory;
+}
+
+
+auto CorpusGenerator::wideSectionRules() -> std::string {
+    return
+        "[vr_any]\ntype: \"section\"\n"
+        "[vr_any.host]\ntype: \"text\"\nchars: \"(a-z)\", \"digits\", \"[.-]\"\n"
+        "[vr_any.port]\ntype: \"integer\"\nminimum: 1\nmaximum: 65535\n"
+        "[vr_any.timeout]\ntype: \"time_delta\"\n"
+        "[vr_any.enabled]\ntype: \"boolean\"\n"
+        "[vr_any.ratio]\ntype: \"float\"\nminimum: 0.0\nmaximum: 1.0\n"
+        "[vr_any.created]\ntype: \"datetime\"\n"
+        "[vr_any.tags]\ntype: \"value_list\"\n"
+        "[vr_any.tags.vr_entry]\ntype: \"text\"\n"
+        "in: \"configuration\", \"parser\", \"value\", \"section\", \"cluster\", \"network\", \"timeout\", "
+        "\"service\", \"replica\", \"storage\", \"index\", \"policy\"\n";
+}
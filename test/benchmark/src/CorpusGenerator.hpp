@@ -0,0 +1,78 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "Corpus.hpp"
+
+#include <functional>
+#include <random>
+#include <string_view>
+
+
+/// Generates synthetic configuration documents for the benchmarks.
+///
+/// Each generator writes its documents into a subdirectory of the working directory and grows the
+/// content until the requested size is reached. The generated content is deterministic, so results
+/// of different runs and revisions can be compared.
+///
+class CorpusGenerator final {
+public:
+    /// Create a new generator.
+    ///
+    /// @param directory The working directory for the generated files.
+    /// @param targetSize The approximate size of each corpus in bytes.
+    ///
+    CorpusGenerator(std::filesystem::path directory, std::size_t targetSize);
+
+public:
+    /// Get the names of all available corpora.
+    ///
+    [[nodiscard]] static auto names() -> std::vector<std::string_view>;
+
+    /// Generate a corpus by name.
+    ///
+    /// @param name The name of the corpus.
+    /// @return The generated corpus.
+    /// @throws std::invalid_argument if there is no corpus with the given name.
+    ///
+    [[nodiscard]] auto generate(std::string_view name) -> Corpus;
+
+private:
+    /// Many sections with a mix of typical scalar values.
+    [[nodiscard]] auto wideSections() -> Corpus;
+    /// Sections with deep name paths.
+    [[nodiscard]] auto deepNamePaths() -> Corpus;
+    /// Long multi-line texts and code blocks.
+    [[nodiscard]] auto multiLineTexts() -> Corpus;
+    /// Big value matrices with integers and floats.
+    [[nodiscard]] auto valueMatrices() -> Corpus;
+    /// A main document that includes many small documents.
+    [[nodiscard]] auto includeFiles() -> Corpus;
+    /// A signed document with wide sections.
+    [[nodiscard]] auto signedDocuments() -> Corpus;
+
+private:
+    /// Generate content by repeatedly calling a block writer until the target size is reached.
+    ///
+    [[nodiscard]] auto generateContent(
+        std::size_t targetSize,
+        const std::function<void(std::string&, std::size_t)> &writeBlock) const -> std::string;
+
+    /// Write a wide section block.
+    void writeWideSection(std::string &content, std::size_t index, std::string_view prefix = "section");
+
+    /// Write a file into the corpus directory.
+    [[nodiscard]] auto writeFile(const std::filesystem::path &path, const std::string &content) const -> std::size_t;
+
+    /// Create a new empty directory for a corpus.
+    [[nodiscard]] auto createCorpusDirectory(std::string_view name) const -> std::filesystem::path;
+
+    /// The validation rules for the wide sections.
+    [[nodiscard]] static auto wideSectionRules() -> std::string;
+
+private:
+    std::filesystem::path _directory; ///< The working directory.
+    std::size_t _targetSize; ///< The target size for each corpus.
+    std::mt19937 _random{0x45524253}; ///< Deterministic random numbers for the generated values.
+};
@@ -0,0 +1,84 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "Measurement.hpp"
+
+
+#include "AllocationCounter.hpp"
+
+#include <fstream>
+#include <string>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+
+Measurement::Measurement() noexcept {
+    resetPeakResidentSetSize();
+    _startAllocations = AllocationCounter::allocations();
+    _startTime = std::chrono::steady_clock::now();
+}
+
+
+auto Measurement::finish() const noexcept -> MeasurementResult {
+    const auto endTime = std::chrono::steady_clock::now();
+    const auto endAllocations = AllocationCounter::allocations();
+    return MeasurementResult{
+        .duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - _startTime),
+        .allocations = endAllocations - _startAllocations,
+        .peakResidentSetSize = peakResidentSetSize()
+    };
+}
+
+
+auto Measurement::peakResidentSetSize() noexcept -> std::size_t {
+#if defined(__linux__)
+    // `VmHWM` can be reset, which gives us a peak for each individual stage.
+    std::ifstream status{"/proc/self/status"};
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with("VmHWM:")) {
+            try {
+                return static_cast<std::size_t>(std::stoull(line.substr(6))) * 1024U;
+            } catch (const std::exception&) {
+                return 0;
+            }
+        }
+    }
+    return 0;
+#elif defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<std::size_t>(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#elif defined(__APPLE__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return static_cast<std::size_t>(usage.ru_maxrss); // bytes on macOS
+    }
+    return 0;
+#elif defined(__unix__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return static_cast<std::size_t>(usage.ru_maxrss) * 1024U; // kilobytes on most other systems
+    }
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+
+void Measurement::resetPeakResidentSetSize() noexcept {
+#if defined(__linux__)
+    // Writing "5" resets the peak resident set size (`VmHWM`) to the current value.
+    std::ofstream clearRefs{"/proc/self/clear_refs"};
+    if (clearRefs.is_open()) {
+        clearRefs << "5";
+    }
+#endif
+}
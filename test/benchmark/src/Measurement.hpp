@@ -0,0 +1,51 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include <chrono>
+#include <cstddef>
+
+
+/// The result of a single measured run.
+///
+struct MeasurementResult final {
+    std::chrono::nanoseconds duration{}; ///< The elapsed wall-clock time.
+    std::size_t allocations{0}; ///< The number of heap allocations during the run.
+    std::size_t peakResidentSetSize{0}; ///< The peak resident set size in bytes, or zero if unknown.
+};
+
+
+/// Measures the time, heap allocations and peak memory of a block of code.
+///
+/// Create an instance right before the measured block and call `finish()` right after it.
+///
+/// The peak resident set size can only be reset on Linux. On other platforms, the reported value is the
+/// peak of the whole process up to this point.
+///
+class Measurement final {
+public:
+    /// Start a new measurement.
+    ///
+    Measurement() noexcept;
+
+public:
+    /// Finish the measurement.
+    ///
+    [[nodiscard]] auto finish() const noexcept -> MeasurementResult;
+
+public:
+    /// Get the peak resident set size of this process.
+    ///
+    /// @return The size in bytes, or zero if the platform doesn't provide this information.
+    ///
+    [[nodiscard]] static auto peakResidentSetSize() noexcept -> std::size_t;
+
+    /// Try to reset the peak resident set size of this process.
+    ///
+    static void resetPeakResidentSetSize() noexcept;
+
+private:
+    std::chrono::steady_clock::time_point _startTime; ///< The start time.
+    std::size_t _startAllocations; ///< The allocation count at the start.
+};
@@ -0,0 +1,323 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include "StageRunner.hpp"
+
+
+#include <erbsland/conf/impl/assignment/AssignmentStream.hpp>
+#include <erbsland/conf/impl/char/CharStream.hpp>
+#include <erbsland/conf/impl/constants/Defaults.hpp>
+#include <erbsland/conf/impl/crypto/ShaHash.hpp>
+#include <erbsland/conf/impl/lexer/Lexer.hpp>
+#include <erbsland/conf/impl/value/DocumentBuilder.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <span>
+
+
+using namespace el::conf;
+
+
+namespace {
+
+
+/// Accepts all documents where the signature contains the document digest.
+///
+/// This matches the signatures created by the `signed` corpus generator.
+///
+class BenchmarkSignatureValidator final : public SignatureValidator {
+public:
+    auto validate(const SignatureValidatorData &data) -> SignatureValidatorResult override {
+        if (data.signatureText.ends_with(data.documentDigest)) {
+            return SignatureValidatorResult::Accept;
+        }
+        return SignatureValidatorResult::Reject;
+    }
+};
+
+
+}
+
+
+StageRunner::StageRunner(
+    const Corpus &corpus,
+    const std::size_t iterations,
+    const bool useMappedFiles,
+    const impl::LexerEngine lexerEngine,
+    const bool useArenaAllocation)
+:
+    _corpus{corpus},
+    _iterations{std::max<std::size_t>(iterations, 1)},
+    _useMappedFiles{useMappedFiles},
+    _lexerEngine{lexerEngine},
+    _useArenaAllocation{useArenaAllocation} {
+
+    countAssignments();
+}
+
+
+auto StageRunner::stageName(const Stage stage) -> std::string_view {
+    switch (stage) {
+    case Stage::Lexer: return "lexer";
+    case Stage::Assignments: return "assignments";
+    case Stage::Builder: return "builder";
+    case Stage::Parser: return "parser";
+    case Stage::Validator: return "validator";
+    case Stage::Release: return "release";
+    case Stage::Hash: return "hash";
+    }
+    return {};
+}
+
+
+auto StageRunner::allStages() -> std::vector<Stage> {
+    return {
+        Stage::Lexer, Stage::Assignments, Stage::Builder, Stage::Parser, Stage::Validator, Stage::Release,
+        Stage::Hash};
+}
+
+
+auto StageRunner::run(const Stage stage) -> StageResult {
+    StageResult result{
+        .corpusName = _corpus.name,
+        .stage = stage,
+        .bytes = _corpus.totalSize,
+        .assignments = _assignmentCount,
+        .values = _valueCount,
+    };
+    for (std::size_t iteration = 0; iteration < _iterations; ++iteration) {
+        const auto measurement = runOnce(stage);
+        if (iteration == 0 || measurement.duration < result.measurement.duration) {
+            result.measurement = measurement;
+        }
+    }
+    return result;
+}
+
+
+auto StageRunner::runOnce(const Stage stage) -> MeasurementResult {
+    switch (stage) {
+    case Stage::Lexer: return runLexer();
+    case Stage::Assignments: return runAssignments();
+    case Stage::Builder: return runBuilder();
+    case Stage::Parser: return runParser();
+    case Stage::Validator: return runValidator();
+    case Stage::Release: return runRelease();
+    case Stage::Hash: return runHash();
+    }
+    return {};
+}
+
+
+auto StageRunner::runLexer() -> MeasurementResult {
+    std::size_t tokenCount = 0;
+    const Measurement measurement;
+    for (const auto &path : _corpus.files) {
+        const auto lexer = createLexer(path);
+        if (_lexerEngine == impl::LexerEngine::StateMachine) {
+            impl::LexerToken token;
+            while (lexer->nextToken(token)) {
+                tokenCount += 1;
+            }
+        } else {
+            for (const auto &token : lexer->tokens()) {
+                (void)token;
+                tokenCount += 1;
+            }
+        }
+    }
+    auto result = measurement.finish();
+    if (tokenCount == 0) {
+        throw std::logic_error("The lexer returned no tokens.");
+    }
+    return result;
+}
+
+
+auto StageRunner::runAssignments() -> MeasurementResult {
+    std::size_t assignmentCount = 0;
+    const Measurement measurement;
+    for (const auto &path : _corpus.files) {
+        forEachAssignment(path, [&](const impl::Assignment &assignment) {
+            (void)assignment;
+            assignmentCount += 1;
+        });
+    }
+    auto result = measurement.finish();
+    if (assignmentCount == 0) {
+        throw std::logic_error("The assignment stream returned no assignments.");
+    }
+    return result;
+}
+
+
+auto StageRunner::runBuilder() -> MeasurementResult {
+    // Values are attached to the built document, therefore the assignments must be collected for each run.
+    const auto assignments = collectAssignments();
+    impl::DocumentBuilder builder;
+    const Measurement measurement;
+    for (const auto &assignment : assignments) {
+        switch (assignment.type()) {
+        case impl::AssignmentType::SectionMap:
+            builder.addSectionMap(assignment.namePath(), assignment.location());
+            break;
+        case impl::AssignmentType::SectionList:
+            builder.addSectionList(assignment.namePath(), assignment.location());
+            break;
+        case impl::AssignmentType::Value:
+            builder.addValue(assignment.namePath(), assignment.value(), assignment.location());
+            break;
+        default:
+            break;
+        }
+    }
+    const auto document = builder.getDocumentAndReset();
+    auto result = measurement.finish();
+    if (document->empty()) {
+        throw std::logic_error("The document builder created an empty document.");
+    }
+    return result;
+}
+
+
+auto StageRunner::runParser() -> MeasurementResult {
+    auto parser = createParser();
+    const Measurement measurement;
+    const auto document = parser.parseOrThrow(createSource(_corpus.mainFile));
+    auto result = measurement.finish();
+    if (document->empty()) {
+        throw std::logic_error("The parser created an empty document.");
+    }
+    return result;
+}
+
+
+auto StageRunner::runValidator() -> MeasurementResult {
+    if (_rules == nullptr) {
+        Parser rulesParser;
+        _rules = vr::Rules::createFromDocument(rulesParser.parseTextOrThrow(_corpus.rulesText));
+    }
+    auto parser = createParser();
+    // Validation adds default values and rule bindings, therefore each run requires a fresh document.
+    const auto document = parser.parseOrThrow(createSource(_corpus.mainFile));
+    const Measurement measurement;
+    _rules->validate(document, 0);
+    return measurement.finish();
+}
+
+
+auto StageRunner::runRelease() -> MeasurementResult {
+    auto parser = createParser();
+    auto document = parser.parseOrThrow(createSource(_corpus.mainFile));
+    const Measurement measurement;
+    document.reset();
+    return measurement.finish();
+}
+
+
+auto StageRunner::runHash() -> MeasurementResult {
+    // Read the files before the measurement, to measure the hash function only.
+    std::vector<std::vector<std::byte>> contents;
+    contents.reserve(_corpus.files.size());
+    for (const auto &path : _corpus.files) {
+        std::ifstream stream{path, std::ios::binary};
+        const std::vector<char> content{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+        auto &bytes = contents.emplace_back(content.size());
+        std::ranges::transform(content, bytes.begin(), [](const char c) -> std::byte {
+            return static_cast<std::byte>(c);
+        });
+    }
+    std::size_t digestSize = 0;
+    const Measurement measurement;
+    for (const auto &content : contents) {
+        impl::crypto::ShaHash hash{impl::defaults::documentHashAlgorithm};
+        // Like the character stream, add the document line by line.
+        auto remaining = std::span<const std::byte>{content};
+        while (!remaining.empty()) {
+            const auto lineEnd = std::ranges::find(remaining, std::byte{'\n'});
+            const auto lineLength = lineEnd == remaining.end()
+                ? remaining.size()
+                : static_cast<std::size_t>(std::distance(remaining.begin(), lineEnd)) + 1;
+            hash.update(remaining.first(lineLength));
+            remaining = remaining.subspan(lineLength);
+        }
+        digestSize += hash.digest().size();
+    }
+    auto result = measurement.finish();
+    if (digestSize == 0) {
+        throw std::logic_error("No file was hashed.");
+    }
+    return result;
+}
+
+
+auto StageRunner::createSource(const std::filesystem::path &path) const -> SourcePtr {
+    if (_useMappedFiles) {
+        return Source::fromMappedFile(path);
+    }
+    return Source::fromFile(path);
+}
+
+
+auto StageRunner::createLexer(const std::filesystem::path &path) const -> impl::LexerPtr {
+    auto source = createSource(path);
+    source->open();
+    return impl::Lexer::create(impl::CharStream::create(source));
+}
+
+
+template<typename Fn>
+void StageRunner::forEachAssignment(const std::filesystem::path &path, Fn fn) const {
+    const auto assignmentStream = impl::AssignmentStream::create(createLexer(path));
+    if (_lexerEngine == impl::LexerEngine::StateMachine) {
+        impl::Assignment assignment;
+        while (assignmentStream->nextAssignment(assignment)) {
+            fn(assignment);
+        }
+    } else {
+        for (const auto &assignment : assignmentStream->assignments()) {
+            fn(assignment);
+        }
+    }
+}
+
+
+auto StageRunner::collectAssignments() const -> std::vector<impl::Assignment> {
+    std::vector<impl::Assignment> result;
+    for (const auto &path : _corpus.files) {
+        forEachAssignment(path, [&](const impl::Assignment &assignment) {
+            if (assignment.type() != impl::AssignmentType::MetaValue &&
+                assignment.type() != impl::AssignmentType::EndOfDocument) {
+                result.push_back(assignment);
+            }
+        });
+    }
+    return result;
+}
+
+
+auto StageRunner::createParser() const -> Parser {
+    Parser parser;
+    parser.setArenaAllocation(_useArenaAllocation);
+    if (_corpus.isSigned) {
+        parser.setSignatureValidator(std::make_shared<BenchmarkSignatureValidator>());
+    }
+    return parser;
+}
+
+
+void StageRunner::countAssignments() {
+    for (const auto &path : _corpus.files) {
+        const auto assignmentStream = impl::AssignmentStream::create(createLexer(path));
+        for (const auto &assignment : assignmentStream->assignments()) {
+            if (assignment.type() == impl::AssignmentType::EndOfDocument) {
+                continue;
+            }
+            _assignmentCount += 1;
+            if (assignment.type() == impl::AssignmentType::Value) {
+                _valueCount += 1;
+            }
+        }
+    }
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+
+#include "Corpus.hpp"
+#include "Measurement.hpp"
+
+#include <erbsland/conf/impl/assignment/Assignment.hpp>
+#include <erbsland/conf/impl/lexer/Lexer.hpp>
+#include <erbsland/conf/impl/parser/ParserSettings.hpp>
+#include <erbsland/conf/Parser.hpp>
+#include <erbsland/conf/vr/Rules.hpp>
+
+#include <string_view>
+#include <vector>
+
+
+/// The measured stages of the parser.
+///
+enum class Stage : uint8_t {
+    Lexer, ///< `impl::Lexer::nextToken()` or `tokens()` for all files of the corpus.
+    Assignments, ///< `impl::AssignmentStream::nextAssignment()` or `assignments()` for all files of the corpus.
+    Builder, ///< `impl::DocumentBuilder`, fed with previously collected assignments.
+    Parser, ///< The complete `Parser::parseOrThrow()` call, including includes and signatures.
+    Validator, ///< `vr::Rules::validate()` for a previously parsed document.
+    Release, ///< Releasing a document created by `Parser::parseOrThrow()`.
+    Hash, ///< Hashing all files of the corpus line by line with the document hash algorithm.
+};
+
+
+/// The result of one stage for a corpus.
+///
+struct StageResult final {
+    std::string corpusName; ///< The name of the corpus.
+    Stage stage{}; ///< The measured stage.
+    std::size_t bytes{0}; ///< The number of processed bytes.
+    std::size_t assignments{0}; ///< The number of assignments in the corpus.
+    std::size_t values{0}; ///< The number of values in the corpus.
+    MeasurementResult measurement; ///< The measurement of the fastest iteration.
+};
+
+
+/// Runs the individual stages for a corpus.
+///
+class StageRunner final {
+public:
+    /// Create a new stage runner.
+    ///
+    /// @param corpus The corpus to process.
+    /// @param iterations The number of iterations for each stage. The fastest iteration is reported.
+    /// @param useMappedFiles If the main files are read using `Source::fromMappedFile()`.
+    /// @param lexerEngine The engine used in the lexer, assignments and builder stages.
+    /// @param useArenaAllocation If the parser allocates the documents in a memory arena.
+    ///
+    StageRunner(
+        const Corpus &corpus,
+        std::size_t iterations,
+        bool useMappedFiles,
+        el::conf::impl::LexerEngine lexerEngine,
+        bool useArenaAllocation);
+
+public:
+    /// Get the names of all stages.
+    ///
+    [[nodiscard]] static auto stageName(Stage stage) -> std::string_view;
+
+    /// Get a list with all stages.
+    ///
+    [[nodiscard]] static auto allStages() -> std::vector<Stage>;
+
+    /// Run a single stage.
+    ///
+    /// @param stage The stage to run.
+    /// @return The result for the stage.
+    /// @throws Error if the corpus could not be processed.
+    ///
+    [[nodiscard]] auto run(Stage stage) -> StageResult;
+
+private:
+    /// Run one iteration of a stage.
+    [[nodiscard]] auto runOnce(Stage stage) -> MeasurementResult;
+    [[nodiscard]] auto runLexer() -> MeasurementResult;
+    [[nodiscard]] auto runAssignments() -> MeasurementResult;
+    [[nodiscard]] auto runBuilder() -> MeasurementResult;
+    [[nodiscard]] auto runParser() -> MeasurementResult;
+    [[nodiscard]] auto runValidator() -> MeasurementResult;
+    [[nodiscard]] auto runRelease() -> MeasurementResult;
+    [[nodiscard]] auto runHash() -> MeasurementResult;
+
+    /// Create the source for a file of the corpus.
+    [[nodiscard]] auto createSource(const std::filesystem::path &path) const -> el::conf::SourcePtr;
+
+    /// Create a lexer for a file of the corpus.
+    [[nodiscard]] auto createLexer(const std::filesystem::path &path) const -> el::conf::impl::LexerPtr;
+
+    /// Read all assignments of a file of the corpus, using the selected engine.
+    template<typename Fn>
+    void forEachAssignment(const std::filesystem::path &path, Fn fn) const;
+
+    /// Collect all assignments for the document builder.
+    [[nodiscard]] auto collectAssignments() const -> std::vector<el::conf::impl::Assignment>;
+
+    /// Create a parser with the settings required for this corpus.
+    [[nodiscard]] auto createParser() const -> el::conf::Parser;
+
+    /// Count the assignments and values in the corpus.
+    void countAssignments();
+
+private:
+    const Corpus &_corpus; ///< The processed corpus.
+    std::size_t _iterations; ///< The number of iterations.
+    bool _useMappedFiles; ///< If the files are read using memory-mapped sources.
+    el::conf::impl::LexerEngine _lexerEngine; ///< The engine for the lexer stages.
+    bool _useArenaAllocation; ///< If the parser allocates the documents in a memory arena.
+    std::size_t _assignmentCount{0}; ///< The number of assignments in the corpus.
+    std::size_t _valueCount{0}; ///< The number of value assignments in the corpus.
+    el::conf::vr::RulesPtr _rules; ///< The rules for the validator stage.
+};
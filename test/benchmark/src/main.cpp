@@ -0,0 +1,11 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "Application.hpp"
+
+
+auto main(int argc, char *argv[]) -> int {
+    Application app;
+    return app.run(argc, argv);
+}
@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
@@ -12,7 +12,9 @@
 #include <cmath>
 #include <filesystem>
 #include <format>
+#include <optional>
 #include <sstream>
+#include <vector>
 
 
 using namespace el::conf;
@@ -53,9 +55,55 @@ public:
         }
     }
 
+    /// Convert an assignment into a text to compare the results of the lexer engines.
+    static auto assignmentToText(const Assignment &assignment) -> String {
+        String result{std::format("{} ", static_cast<int>(assignment.type()))};
+        result += assignment.namePath().toText();
+        result += u8" ";
+        result += assignment.location().toText();
+        if (assignment.value() != nullptr) {
+            result += u8" ";
+            result += assignment.value()->toTestText();
+        }
+        return result;
+    }
+
+    /// Read all assignments of the test file, using the generator or the state machine.
+    auto readWithEngine(const bool useStateMachine) -> std::pair<std::vector<String>, std::optional<String>> {
+        std::vector<String> assignments;
+        std::optional<String> errorText;
+        try {
+            auto engineSource = Source::fromFile(testFilePath);
+            engineSource->open();
+            auto engineStream = AssignmentStream::create(Lexer::create(CharStream::create(engineSource)));
+            if (useStateMachine) {
+                Assignment engineAssignment;
+                while (engineStream->nextAssignment(engineAssignment)) {
+                    assignments.emplace_back(assignmentToText(engineAssignment));
+                }
+            } else {
+                for (const auto &engineAssignment : engineStream->assignments()) {
+                    assignments.emplace_back(assignmentToText(engineAssignment));
+                }
+            }
+        } catch (const Error &error) {
+            errorText = error.toText();
+        }
+        return {std::move(assignments), std::move(errorText)};
+    }
+
+    /// Require that the state machine produces exactly the same assignments and error as the generator.
+    void requireSameAssignmentsFromStateMachine() {
+        const auto generatorResult = readWithEngine(false);
+        const auto stateMachineResult = readWithEngine(true);
+        REQUIRE(stateMachineResult.first == generatorResult.first);
+        REQUIRE(stateMachineResult.second == generatorResult.second);
+    }
+
     void setupAssignmentStream(const std::string &fileName) {
         using std::filesystem::path;
         testFilePath = path(unitTestExecutablePath()).parent_path() / "data" / "assignment_stream" / fileName;
+        requireSameAssignmentsFromStateMachine();
         source = Source::fromFile(testFilePath);
         REQUIRE_NOTHROW(source->open());
         lexer = Lexer::create(CharStream::create(source));
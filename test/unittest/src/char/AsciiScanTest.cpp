@@ -0,0 +1,224 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "TestHelper.hpp"
+
+#include <erbsland/conf/impl/char/AsciiScan.hpp>
+#include <erbsland/conf/impl/char/CharStream.hpp>
+#include <erbsland/conf/Source.hpp>
+
+#include <algorithm>
+#include <array>
+#include <format>
+
+
+using namespace el::conf;
+using impl::Char;
+using impl::CharClass;
+using impl::countAsciiPrefix;
+using impl::countBytesBeforeAny;
+using impl::countValidAsciiPrefix;
+using impl::decodeBase64Groups;
+using impl::decodeHexDigitPairs;
+
+
+TESTED_TARGETS(AsciiScan CharStream)
+class AsciiScanTest final : public UNITTEST_SUBCLASS(TestHelper) {
+public:
+    void tearDown() override {
+        cleanUpTestFileDirectory();
+    }
+
+    /// Create a buffer of `size` valid ASCII bytes.
+    static auto createValidData(const std::size_t size) -> std::vector<std::byte> {
+        std::vector<std::byte> result;
+        result.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            result.push_back(static_cast<std::byte>(0x20U + i % 0x5fU));
+        }
+        return result;
+    }
+
+    void testEmpty() {
+        REQUIRE_EQUAL(countValidAsciiPrefix({}), 0);
+    }
+
+    void testAllByteValues() {
+        for (unsigned value = 0; value < 0x100U; ++value) {
+            const auto byte = static_cast<std::byte>(value);
+            const bool expected = Char{static_cast<char32_t>(value)} == CharClass::ValidLang && value < 0x80U;
+            // Test the byte at every position in a block, as well as the scalar tail after the blocks.
+            for (std::size_t position = 0; position < 40; ++position) {
+                auto data = createValidData(40);
+                data[position] = byte;
+                runWithContext(SOURCE_LOCATION(), [&]() {
+                    REQUIRE_EQUAL(countValidAsciiPrefix(data), expected ? data.size() : position);
+                }, [&]() -> std::string {
+                    return std::format("value=0x{:02x} position={}", value, position);
+                });
+            }
+        }
+    }
+
+    void testSizes() {
+        for (std::size_t size = 0; size < 100; ++size) {
+            const auto data = createValidData(size);
+            REQUIRE_EQUAL(countValidAsciiPrefix(data), size);
+            REQUIRE_EQUAL(countValidAsciiPrefix(std::span{data}.subspan(size / 2)), size - size / 2);
+        }
+    }
+
+    void testCountAsciiPrefix() {
+        REQUIRE_EQUAL(countAsciiPrefix({}), 0);
+        for (unsigned value = 0; value < 0x100U; ++value) {
+            // Test the byte at every position in a block, as well as the scalar tail after the blocks.
+            for (std::size_t position = 0; position < 40; ++position) {
+                auto data = createValidData(40);
+                data[position] = static_cast<std::byte>(value);
+                REQUIRE_EQUAL(countAsciiPrefix(data), value < 0x80U ? data.size() : position);
+            }
+        }
+    }
+
+    void testCountBytesBeforeAny() {
+        const std::array stopBytes{std::byte{'"'}, std::byte{'\\'}, std::byte{'\n'}};
+        REQUIRE_EQUAL(countBytesBeforeAny({}, stopBytes), 0);
+        for (std::size_t size = 0; size < 50; ++size) {
+            const auto data = createValidData(size);
+            const auto expected = static_cast<std::size_t>(std::ranges::distance(
+                data.begin(), std::ranges::find_first_of(data, stopBytes)));
+            REQUIRE_EQUAL(countBytesBeforeAny(data, stopBytes), expected);
+            REQUIRE_EQUAL(countBytesBeforeAny(data, {}), size);
+        }
+        // Test each stop byte at every position in a block, as well as the scalar tail after the blocks.
+        for (const auto stopByte : stopBytes) {
+            for (std::size_t position = 0; position < 40; ++position) {
+                std::vector<std::byte> data(40, std::byte{'x'});
+                data[position] = stopByte;
+                data[39] = std::byte{'"'};
+                REQUIRE_EQUAL(countBytesBeforeAny(data, stopBytes), position);
+                REQUIRE_EQUAL(countBytesBeforeAny(std::span{data}.subspan(position + 1), stopBytes),
+                    position == 39 ? 0 : 38 - position);
+            }
+        }
+    }
+
+    /// Encode bytes as base64 digits, without padding.
+    static auto encodeBase64(const std::vector<std::byte> &data) -> std::vector<std::byte> {
+        constexpr std::string_view digits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        std::vector<std::byte> result;
+        for (std::size_t i = 0; i + 3 <= data.size(); i += 3) {
+            const auto group = (std::to_integer<uint32_t>(data[i]) << 16)
+                | (std::to_integer<uint32_t>(data[i + 1]) << 8)
+                | std::to_integer<uint32_t>(data[i + 2]);
+            for (int shift = 18; shift >= 0; shift -= 6) {
+                result.push_back(static_cast<std::byte>(digits[(group >> shift) & 0x3fU]));
+            }
+        }
+        return result;
+    }
+
+    void testDecodeHexDigitPairs() {
+        std::vector<std::byte> expected;
+        std::vector<std::byte> digits;
+        for (unsigned value = 0; value < 0x100U; ++value) {
+            expected.push_back(static_cast<std::byte>(value));
+            const auto hex = std::format(value % 3 == 0 ? "{:02X}" : "{:02x}", value);
+            digits.push_back(static_cast<std::byte>(hex[0]));
+            digits.push_back(static_cast<std::byte>(hex[1]));
+        }
+        std::vector<std::byte> output(expected.size());
+        REQUIRE_EQUAL(decodeHexDigitPairs(digits, output), expected.size());
+        REQUIRE(output == expected);
+        // Incomplete pairs and a full output stop the decoding.
+        REQUIRE_EQUAL(decodeHexDigitPairs({}, output), 0);
+        REQUIRE_EQUAL(decodeHexDigitPairs(std::span{digits}.first(41), output), 20);
+        REQUIRE_EQUAL(decodeHexDigitPairs(digits, std::span{output}.first(13)), 13);
+        // Test each invalid byte value at every position in a block, as well as the scalar tail after the blocks.
+        for (const auto invalidByte : {std::byte{'g'}, std::byte{'G'}, std::byte{'/'}, std::byte{':'},
+            std::byte{'@'}, std::byte{'`'}, std::byte{' '}, std::byte{0xc3}, std::byte{0x00}}) {
+            for (std::size_t position = 0; position < 40; ++position) {
+                auto data = std::vector<std::byte>(digits.begin(), digits.begin() + 40);
+                data[position] = invalidByte;
+                REQUIRE_EQUAL(decodeHexDigitPairs(data, output), position / 2);
+                REQUIRE(std::ranges::equal(std::span{output}.first(position / 2),
+                    std::span{expected}.first(position / 2)));
+            }
+        }
+    }
+
+    void testDecodeBase64Groups() {
+        std::vector<std::byte> expected;
+        for (unsigned value = 0; value < 0x100U; ++value) {
+            expected.push_back(static_cast<std::byte>(value * 7U));
+        }
+        expected.resize(255);
+        const auto digits = encodeBase64(expected);
+        std::vector<std::byte> output(expected.size());
+        REQUIRE_EQUAL(decodeBase64Groups(digits, output), expected.size());
+        REQUIRE(output == expected);
+        // Incomplete groups, padding and a full output stop the decoding.
+        REQUIRE_EQUAL(decodeBase64Groups({}, output), 0);
+        REQUIRE_EQUAL(decodeBase64Groups(std::span{digits}.first(23), output), 15);
+        REQUIRE_EQUAL(decodeBase64Groups(digits, std::span{output}.first(14)), 12);
+        const std::string_view text = "SGVsbG8sIFdvcmxkIQ==";
+        const auto textBytes = std::as_bytes(std::span{text});
+        REQUIRE_EQUAL(decodeBase64Groups(textBytes, output), 12);
+        REQUIRE(std::ranges::equal(std::span{output}.first(12), std::as_bytes(std::span{"Hello, World", 12})));
+        for (std::size_t position = 0; position < 40; ++position) {
+            auto data = std::vector<std::byte>(digits.begin(), digits.begin() + 40);
+            data[position] = std::byte{'-'};
+            REQUIRE_EQUAL(decodeBase64Groups(data, output), position / 4 * 3);
+        }
+    }
+
+    void testCharStreamSkipsCharacterRun() {
+        String content{u8"\"" + std::u8string(40, u8'x') + u8"→ä\\y\x01\"\n"};
+        auto source = Source::fromString(content);
+        source->open();
+        const auto charStream = impl::CharStream::create(source);
+        REQUIRE(charStream->next() == Char::DoubleQuote);
+        REQUIRE(charStream->next() == Char{U'x'});
+        // The run stops at the escape character and includes all Unicode characters before it.
+        REQUIRE_EQUAL(charStream->skipCharacterRun(u8"\"\\"), 41);
+        REQUIRE_EQUAL(charStream->readPosition().lineCurrentIndex, 46);
+        REQUIRE(charStream->readPosition().position == Position(1, 43));
+        auto decodedChar = charStream->next();
+        REQUIRE(decodedChar == Char::Backslash);
+        REQUIRE(decodedChar.position() == Position(1, 44));
+        // The run stops before the invalid control character, so `next()` reports the error at its position.
+        REQUIRE_EQUAL(charStream->skipCharacterRun(u8"\"\\"), 1);
+        REQUIRE_EQUAL(charStream->skipCharacterRun(u8"\"\\"), 0);
+        try {
+            [[maybe_unused]] auto unused = charStream->next();
+            REQUIRE(false);
+        } catch (const Error &error) {
+            REQUIRE_EQUAL(error.category(), ErrorCategory::Character);
+            REQUIRE(error.location().position() == Position(1, 46));
+        }
+    }
+
+    void testCharStreamUsesScanWithoutChangingErrors() {
+        // A long ASCII prefix, followed by UTF-8 and an invalid control character at a known column.
+        String content{u8"[main]\nvalue: \"" + std::u8string(60, u8'x') + u8"→ ok \x01\"\n"};
+        auto source = Source::fromString(content);
+        source->open();
+        const auto charStream = impl::CharStream::create(source);
+        std::u8string decoded;
+        try {
+            while (true) {
+                const auto decodedChar = charStream->next();
+                if (decodedChar == Char::EndOfData) {
+                    REQUIRE(false);
+                }
+                decodedChar.appendTo(decoded);
+            }
+        } catch (const Error &error) {
+            REQUIRE_EQUAL(error.category(), ErrorCategory::Character);
+            REQUIRE(error.location().position() == Position(2, 74));
+        }
+        REQUIRE(decoded == u8"[main]\nvalue: \"" + std::u8string(60, u8'x') + u8"→ ok ");
+    }
+};
+
@@ -29,6 +29,7 @@ public:
             {Char{Char::Digit9}, CharClass::LetterOrDigit},
             {Char{Char::Digit0}, CharClass::DecimalDigit},
             {Char{Char::UcF}, CharClass::HexDigit},
+            {Char{Char::Slash}, CharClass::Base64Digit},
             {Char{Char::Colon}, CharClass::NameValueSeparator},
             {Char{Char::DoubleQuote}, CharClass::OpeningBracket},
             {Char{Char::Minus}, CharClass::SectionStart},
@@ -92,6 +93,13 @@ public:
         REQUIRE_EQUAL(Char{Char::LcA}.toHexDigitValue(), uint8_t{10});
         REQUIRE_EQUAL(Char{Char::UcF}.toHexDigitValue(), uint8_t{15});
         REQUIRE_EQUAL(Char{U'G'}.toHexDigitValue(), uint8_t{0});
+
+        REQUIRE_EQUAL(Char{Char::UcA}.toBase64DigitValue(), uint8_t{0});
+        REQUIRE_EQUAL(Char{Char::LcA}.toBase64DigitValue(), uint8_t{26});
+        REQUIRE_EQUAL(Char{Char::Digit0}.toBase64DigitValue(), uint8_t{52});
+        REQUIRE_EQUAL(Char{Char::Plus}.toBase64DigitValue(), uint8_t{62});
+        REQUIRE_EQUAL(Char{Char::Slash}.toBase64DigitValue(), uint8_t{63});
+        REQUIRE_EQUAL(Char{Char::Equal}.toBase64DigitValue(), uint8_t{0});
     }
 };
 
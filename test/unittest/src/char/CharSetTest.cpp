@@ -0,0 +1,96 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "TestHelper.hpp"
+
+#include <erbsland/conf/impl/char/CharSet.hpp>
+
+
+using namespace el::conf;
+using impl::Char;
+using impl::CharRanges;
+using impl::CharSet;
+
+
+TESTED_TARGETS(CharSet)
+class CharSetTest final : public UNITTEST_SUBCLASS(TestHelper) {
+public:
+    /// Ranges across the ASCII limit, with overlapping and adjacent non-ASCII ranges in random order.
+    static auto createRanges() -> CharRanges {
+        return CharRanges{
+            {Char{U'a'}, Char{U'z'}},
+            {Char{0x3000U}, Char{0x3010U}},
+            {Char{0x7eU}, Char{0xa0U}},
+            {Char{0x2000U}, Char{0x2fffU}},
+            {Char{0x1000U}, Char{0x2010U}},
+            {Char{U'_'}, Char{U'_'}},
+            {Char{0x10fff0U}, Char{0x10ffffU}},
+        };
+    }
+
+    static auto toBytes(const std::u8string_view text) -> std::span<const std::byte> {
+        return std::as_bytes(std::span{text});
+    }
+
+    void testEmpty() {
+        const CharSet charSet;
+        REQUIRE_FALSE(charSet.contains(Char{U'a'}));
+        REQUIRE_FALSE(charSet.contains(Char{0x1000U}));
+        REQUIRE_EQUAL(charSet.countAsciiPrefix({}, true), 0);
+        REQUIRE_EQUAL(charSet.countAsciiPrefix(toBytes(u8"abc"), true), 0);
+        REQUIRE_EQUAL(charSet.countAsciiPrefix(toBytes(u8"abc"), false), 3);
+    }
+
+    void testContainsMatchesRanges() {
+        const auto ranges = createRanges();
+        const CharSet charSet{ranges};
+        for (char32_t unicode = 0; unicode < 0x4000U; ++unicode) {
+            runWithContext(SOURCE_LOCATION(), [&]() {
+                REQUIRE_EQUAL(charSet.contains(Char{unicode}), ranges.contains(Char{unicode}));
+            }, [&]() -> std::string {
+                return std::format("unicode=U+{:04X}", static_cast<unsigned>(unicode));
+            });
+        }
+        REQUIRE(charSet.contains(Char{0x10fff0U}));
+        REQUIRE(charSet.contains(Char{0x10ffffU}));
+        REQUIRE_FALSE(charSet.contains(Char{0x10ffefU}));
+    }
+
+    void testRangesAreMerged() {
+        const CharSet charSet{createRanges()};
+        const auto &ranges = charSet.nonAsciiRanges();
+        REQUIRE_EQUAL(ranges.size(), 3);
+        REQUIRE_EQUAL(ranges[0].first, 0x80U);
+        REQUIRE_EQUAL(ranges[0].last, 0xa0U);
+        // Overlapping and adjacent ranges are merged.
+        REQUIRE_EQUAL(ranges[1].first, 0x1000U);
+        REQUIRE_EQUAL(ranges[1].last, 0x3010U);
+        REQUIRE_EQUAL(ranges[2].first, 0x10fff0U);
+        REQUIRE_EQUAL(ranges[2].last, 0x10ffffU);
+    }
+
+    void testAsciiPrefix() {
+        const CharSet charSet{createRanges()};
+        // Test a mismatch at every position in a block, as well as in the scalar tail after the blocks.
+        for (std::size_t size = 0; size < 40; ++size) {
+            for (std::size_t position = 0; position <= size; ++position) {
+                std::u8string text(size, u8'a');
+                std::u8string negatedText(size, u8'A');
+                std::u8string utf8Text = text;
+                if (position < size) {
+                    text[position] = u8'A';
+                    negatedText[position] = u8'_';
+                    utf8Text.replace(position, 1, u8"→");
+                }
+                runWithContext(SOURCE_LOCATION(), [&]() {
+                    REQUIRE_EQUAL(charSet.countAsciiPrefix(toBytes(text), true), position);
+                    REQUIRE_EQUAL(charSet.countAsciiPrefix(toBytes(negatedText), false), position);
+                    REQUIRE_EQUAL(charSet.countAsciiPrefix(toBytes(utf8Text), true), position);
+                }, [&]() -> std::string {
+                    return std::format("size={} position={}", size, position);
+                });
+            }
+        }
+    }
+};
@@ -1,4 +1,4 @@
-// Copyright (c) 2024-2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2024-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 
 
@@ -8,12 +8,13 @@
 #include <utility>
 #include <format>
 #include <fstream>
+#include <random>
 
 
 using namespace el::conf;
 using impl::crypto::ShaHash;
 
-TESTED_TARGETS(ShaHash)
+TESTED_TARGETS(ShaHash Sha3 Keccak)
 class ShaHashTest final : public el::UnitTest {
 public:
     struct TestFile {
@@ -36,15 +37,43 @@ public:
         hash.update(messageSpan);
         auto actualDigest = hash.digest();
         REQUIRE_EQUAL(actualDigest, expectedDigest);
-        // Verify in chunks.
-        hash.reset();
-        constexpr std::size_t chunkSize = 10;
-        for (std::size_t i = 0; i < message.size(); i += chunkSize) {
-            auto chunk = messageSpan.subspan(i, std::min(chunkSize, message.size() - i));
-            hash.update(std::span(chunk.begin(), chunk.size()));
+        // Verify in chunks, smaller and larger than a block.
+        for (const std::size_t chunkSize : {1U, 10U, 71U, 137U}) {
+            hash.reset();
+            for (std::size_t i = 0; i < message.size(); i += chunkSize) {
+                auto chunk = messageSpan.subspan(i, std::min(chunkSize, message.size() - i));
+                hash.update(std::span(chunk.begin(), chunk.size()));
+            }
+            actualDigest = hash.digest();
+            REQUIRE_EQUAL(actualDigest, expectedDigest);
         }
-        actualDigest = hash.digest();
-        REQUIRE_EQUAL(actualDigest, expectedDigest);
+    }
+
+    void testPermutationMatchesReference() {
+        std::mt19937_64 random{0x5eed};
+        for (int i = 0; i < 100; ++i) {
+            impl::crypto::KeccakF1600State state;
+            for (auto &lane : state) {
+                lane = random();
+            }
+            auto expected = state;
+            impl::crypto::keccakF1600PermutationReference(expected);
+            impl::crypto::keccakF1600Permutation(state);
+            REQUIRE(state == expected);
+        }
+        impl::crypto::KeccakF1600State zeroState{};
+        auto expected = zeroState;
+        impl::crypto::keccakF1600PermutationReference(expected);
+        impl::crypto::keccakF1600Permutation(zeroState);
+        REQUIRE(zeroState == expected);
+    }
+
+    void testEmptyUpdate() {
+        ShaHash hash{ShaHash::Algorithm::Sha3_256};
+        hash.update(Bytes::fromHex("7465"));
+        hash.update(std::span<const std::byte>{});
+        hash.update(Bytes::fromHex("7374"));
+        REQUIRE_EQUAL(hash.digest(), Bytes::fromHex("36f028580bb02cc8272a9a020f4200e346e276ae664e45ee80745574e2f5ab80"));
     }
 
     void testZeroByte() {
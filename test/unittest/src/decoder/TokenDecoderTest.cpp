@@ -1,4 +1,4 @@
-// Copyright (c) 2024-2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2024-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 
 
@@ -226,6 +226,54 @@ public:
         WITH_CONTEXT(requireEndOfData());
     }
 
+    void testRollbackAtEndOfData() {
+        setupDecoder(u8"@signature: \"...\"\nvalue: 1😀");
+        while (decoder->character() != U'1') {
+            decoder->next();
+        }
+        {
+            auto transaction = impl::Transaction{*decoder};
+            WITH_CONTEXT(requireAndNext(U'1'));
+            WITH_CONTEXT(requireAndNext(U'😀'));
+            REQUIRE(decoder->character() == Char::EndOfData);
+            REQUIRE_EQUAL(transaction.capturedSize(), 2);
+            REQUIRE_EQUAL(transaction.capturedString(), String{u8"1😀"});
+        } // rollback
+        REQUIRE(decoder->location().position() == Position{2, 8});
+        WITH_CONTEXT(requireAndNext(U'1'));
+        WITH_CONTEXT(requireAndNext(U'😀'));
+        REQUIRE(decoder->location().position() == Position{2, 10});
+        auto token = decoder->createToken(TokenType::Text, u8"");
+        REQUIRE(token.rawText() == u8"value: 1😀");
+        WITH_CONTEXT(requireEndOfData());
+        // The digest must not change, when the end of the data is read twice.
+        const auto expectedDigest = decoder->digest();
+        REQUIRE_FALSE(expectedDigest.empty());
+        setupDecoder(u8"@signature: \"...\"\nvalue: 1😀");
+        while (decoder->character() != Char::EndOfData) {
+            decoder->next();
+        }
+        REQUIRE_EQUAL(decoder->digest(), expectedDigest);
+    }
+
+    void testRollbackBeforeEncodingError() {
+        setupDecoder(Bytes::fromHex("616263ff0a"));
+        {
+            auto transaction = impl::Transaction{*decoder};
+            WITH_CONTEXT(requireAndNext(U'a'));
+            WITH_CONTEXT(requireAndNext(U'b'));
+            WITH_CONTEXT(requireAndNext(U'c'));
+            REQUIRE(decoder->character() == Char::Error);
+            REQUIRE_EQUAL(transaction.capturedString(), String{u8"abc"});
+        } // rollback
+        WITH_CONTEXT(requireAndNext(U'a'));
+        WITH_CONTEXT(requireAndNext(U'b'));
+        WITH_CONTEXT(requireAndNext(U'c'));
+        REQUIRE(decoder->character() == Char::Error);
+        REQUIRE(decoder->location().position() == Position{1, 4});
+        REQUIRE_THROWS_AS(Error, decoder->checkForErrorAndThrowIt());
+    }
+
     void testDocumentWithDigest() {
         // verify the used algorithm.
         REQUIRE_EQUAL(impl::defaults::documentHashAlgorithm, impl::crypto::ShaHash::Algorithm::Sha3_256);
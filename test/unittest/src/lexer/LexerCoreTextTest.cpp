@@ -62,6 +62,26 @@ public:
         WITH_CONTEXT(verifyErrorInValue(u8R"("\u00atext")", ErrorCategory::Syntax));
     }
 
+    void testLongTextRuns() {
+        // Long runs of regular characters are decoded in blocks, and must stop exactly at escapes and terminators.
+        const auto run = std::u8string(50, u8'a');
+        WITH_CONTEXT(verifyValidText(String{u8"\"" + run + u8"\""}, String{run}));
+        WITH_CONTEXT(verifyValidText(String{u8"\"" + run + u8"\\n" + run + u8"\""}, String{run + u8"\n" + run}));
+        WITH_CONTEXT(verifyValidText(
+            String{u8"\"" + run + u8"→😄" + run + u8"\\\"\""},
+            String{run + u8"→😄" + run + u8"\""}));
+        WITH_CONTEXT(verifyValidText(
+            String{u8"\"→" + run + u8" \t" + run + u8"\""},
+            String{u8"→" + run + u8" \t" + run}));
+        WITH_CONTEXT(verifyValidCode(
+            String{u8"`" + run + u8"\\" + run + u8"\"`"},
+            String{run + u8"\\" + run + u8"\""}));
+        WITH_CONTEXT(verifyValidRegEx(String{u8"/" + run + u8"\\/" + run + u8"/"}, String{run + u8"/" + run}));
+        WITH_CONTEXT(verifyErrorInValue(String{u8"\"" + run + u8"\x01" + run + u8"\""}, ErrorCategory::Character));
+        WITH_CONTEXT(verifyErrorInValue(String{u8"\"" + run + u8"→\x01\""}, ErrorCategory::Character));
+        WITH_CONTEXT(verifyErrorInValue(String{u8"\"" + run + u8"\xff\""}, ErrorCategory::Encoding));
+    }
+
     void testBasicCode() {
         WITH_CONTEXT(verifyValidCode(u8R"(``)", u8""));
         WITH_CONTEXT(verifyValidCode(u8R"(`text`)", u8"text"));
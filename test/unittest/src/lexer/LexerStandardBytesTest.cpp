@@ -43,6 +43,49 @@ public:
         WITH_CONTEXT(verifyValidByteData(u8"<hex: ff    ee   >", Bytes::fromHex("ffee")));
     }
 
+    void testLongHexRuns() {
+        // Long runs of digits are decoded in blocks, test all lengths around the block size.
+        const auto digits = std::string{"00112233445566778899aabbccddeeffAABBCCDDEEFF0f1e2d3c4b5a69788796a5b4c3d2e1f0"};
+        for (std::size_t size = 2; size <= digits.size(); size += 2) {
+            const auto hex = digits.substr(0, size);
+            WITH_CONTEXT(verifyValidByteData(String{u8"<" + std::u8string{hex.begin(), hex.end()} + u8">"},
+                Bytes::fromHex(hex)));
+            WITH_CONTEXT(verifyValidByteData(String{u8"<hex:" + std::u8string{hex.begin(), hex.end()} + u8" 12>"},
+                Bytes::fromHex(hex + "12")));
+        }
+        // Errors after a long run are reported at the exact position.
+        WITH_CONTEXT(verifyErrorInValue(String{u8"<" + std::u8string(37, u8'a') + u8">"}, ErrorCategory::Syntax));
+        WITH_CONTEXT(verifyErrorInValue(String{u8"<" + std::u8string(36, u8'a') + u8"ag>"}, ErrorCategory::Syntax));
+        WITH_CONTEXT(verifyErrorInValue(String{u8"<" + std::u8string(34, u8'a') + u8"→>"}, ErrorCategory::Syntax));
+        WITH_CONTEXT(verifyErrorInValue(String{u8"<" + std::u8string(40, u8'a')},
+            {ErrorCategory::UnexpectedEnd, ErrorCategory::Syntax}));
+    }
+
+    void testBase64Bytes() {
+        WITH_CONTEXT(verifyValidByteData(u8"<base64:>", Bytes{}));
+        WITH_CONTEXT(verifyValidByteData(u8"<base64: >", Bytes{}));
+        WITH_CONTEXT(verifyValidByteData(u8"<base64:TWFu>", Bytes::fromHex("4d616e")));
+        WITH_CONTEXT(verifyValidByteData(u8"<BASE64:TWFu>", Bytes::fromHex("4d616e")));
+        WITH_CONTEXT(verifyValidByteData(u8"<base64:TWE=>", Bytes::fromHex("4d61")));
+        WITH_CONTEXT(verifyValidByteData(u8"<base64:TQ==>", Bytes::fromHex("4d")));
+        WITH_CONTEXT(verifyValidByteData(u8"<base64: TWFu TWE= >", Bytes::fromHex("4d616e4d61")));
+        WITH_CONTEXT(verifyValidByteData(u8"<base64:+/+/>", Bytes::fromHex("fbffbf")));
+        WITH_CONTEXT(verifyValidByteData(u8"<base64:SGVsbG8sIFdvcmxkIQ==>",
+            Bytes::fromHex("48656c6c6f2c20576f726c6421")));
+        // Incomplete groups.
+        WITH_CONTEXT(verifyErrorInValue(u8"<base64:TWF>", ErrorCategory::Syntax));
+        WITH_CONTEXT(verifyErrorInValue(u8"<base64:TW Fu>", ErrorCategory::Syntax));
+        WITH_CONTEXT(verifyErrorInValue(u8"<base64:TWFuT>", ErrorCategory::Syntax));
+        WITH_CONTEXT(verifyErrorInValue(u8"<base64:TWFu", {ErrorCategory::UnexpectedEnd, ErrorCategory::Syntax}));
+        WITH_CONTEXT(verifyErrorInValue(u8"<base64:TW", {ErrorCategory::UnexpectedEnd, ErrorCategory::Syntax}));
+        // Invalid characters and padding.
+        WITH_CONTEXT(verifyErrorInValue(u8"<base64:TW-u>", ErrorCategory::Syntax));
+        WITH_CONTEXT(verifyErrorInValue(u8"<base64:T===>", ErrorCategory::Syntax));
+        WITH_CONTEXT(verifyErrorInValue(u8"<base64:TW=u>", ErrorCategory::Syntax));
+        WITH_CONTEXT(verifyErrorInValue(u8"<base64:TQ==TWFu>", ErrorCategory::Syntax));
+        WITH_CONTEXT(verifyErrorInValue(u8"<base64:TQ== TWFu>", ErrorCategory::Syntax));
+    }
+
     void testInvalidBytes() {
         // unexpected end (with comment after value, it is a syntax error).
         WITH_CONTEXT(verifyErrorInValue(u8"<", {ErrorCategory::UnexpectedEnd, ErrorCategory::Syntax}));
@@ -67,6 +110,6 @@ public:
         WITH_CONTEXT(verifyErrorInValue(u8"<hex:h23456>", ErrorCategory::Syntax));
 
         // unknown format.
-        WITH_CONTEXT(verifyErrorInValue(u8"<base64:23456>", ErrorCategory::Unsupported));
+        WITH_CONTEXT(verifyErrorInValue(u8"<base32:23456>", ErrorCategory::Unsupported));
     }
 };
@@ -261,6 +261,49 @@ public:
         WITH_CONTEXT(verifyValidMultiLineBytes(testLines));
     }
 
+    void testBase64() {
+        setupTokenIterator("[section]\nvalue: <<<base64\n    TWFu TWFu\n\n    SGVsbG8=\n    >>>\n");
+        WITH_CONTEXT(verifyPrefix(PrefixFormat::SameLine));
+        WITH_CONTEXT(requireNextToken(TokenType::MultiLineBytesOpen, u8"<<<"));
+        WITH_CONTEXT(requireNextToken(TokenType::MultiLineBytesFormat, u8"base64"));
+        WITH_CONTEXT(requireNextToken(TokenType::LineBreak, u8"\n"));
+        WITH_CONTEXT(requireNextToken(TokenType::Indentation, u8"    "));
+        WITH_CONTEXT(requireNextBytesToken(TokenType::MultiLineBytes, Bytes::fromHex("4d616e4d616e"), u8"TWFu TWFu"));
+        WITH_CONTEXT(requireNextToken(TokenType::LineBreak, u8"\n"));
+        WITH_CONTEXT(requireNextToken(TokenType::LineBreak, u8"\n"));
+        WITH_CONTEXT(requireNextToken(TokenType::Indentation, u8"    "));
+        WITH_CONTEXT(requireNextBytesToken(TokenType::MultiLineBytes, Bytes::fromHex("48656c6c6f"), u8"SGVsbG8="));
+        WITH_CONTEXT(requireNextToken(TokenType::LineBreak, u8"\n"));
+        WITH_CONTEXT(requireNextToken(TokenType::Indentation, u8"    "));
+        WITH_CONTEXT(requireNextToken(TokenType::MultiLineBytesClose, u8">>>"));
+        WITH_CONTEXT(requireNextToken(TokenType::LineBreak, u8"\n"));
+        WITH_CONTEXT(requireEndOfData());
+
+        // Each line must contain complete groups.
+        for (const auto &line : {"TWF", "TWFuT", "TW=u", "TQ==TWFu", "TW-u"}) {
+            setupTokenIterator(String{std::format("[section]\nvalue: <<<base64\n    {}\n    >>>\n", line)});
+            WITH_CONTEXT(verifyPrefix(PrefixFormat::SameLine));
+            WITH_CONTEXT(requireNextToken(TokenType::MultiLineBytesOpen, u8"<<<"));
+            WITH_CONTEXT(requireNextToken(TokenType::MultiLineBytesFormat, u8"base64"));
+            WITH_CONTEXT(requireNextToken(TokenType::LineBreak, u8"\n"));
+            WITH_CONTEXT(requireNextToken(TokenType::Indentation, u8"    "));
+            WITH_CONTEXT(requireError(ErrorCategory::Syntax));
+        }
+
+        // A group with padding must be the last group of the block.
+        setupTokenIterator("[section]\nvalue: <<<base64\n    SGVsbG8=\n\n    TWFu\n    >>>\n");
+        WITH_CONTEXT(verifyPrefix(PrefixFormat::SameLine));
+        WITH_CONTEXT(requireNextToken(TokenType::MultiLineBytesOpen, u8"<<<"));
+        WITH_CONTEXT(requireNextToken(TokenType::MultiLineBytesFormat, u8"base64"));
+        WITH_CONTEXT(requireNextToken(TokenType::LineBreak, u8"\n"));
+        WITH_CONTEXT(requireNextToken(TokenType::Indentation, u8"    "));
+        WITH_CONTEXT(requireNextBytesToken(TokenType::MultiLineBytes, Bytes::fromHex("48656c6c6f"), u8"SGVsbG8="));
+        WITH_CONTEXT(requireNextToken(TokenType::LineBreak, u8"\n"));
+        WITH_CONTEXT(requireNextToken(TokenType::LineBreak, u8"\n"));
+        WITH_CONTEXT(requireNextToken(TokenType::Indentation, u8"    "));
+        WITH_CONTEXT(requireError(ErrorCategory::Syntax));
+    }
+
     void testInvalidAndIncomplete() {
         setupTokenIterator("[section]\nvalue: <<<");
         WITH_CONTEXT(verifyPrefix(PrefixFormat::SameLine));
@@ -280,12 +323,12 @@ public:
         WITH_CONTEXT(requireNextToken(TokenType::Spacing, u8"    "));
         WITH_CONTEXT(requireError(ErrorCategory::UnexpectedEnd));
 
-        setupTokenIterator("[section]\nvalue: <<<base64\n    >>>");
+        setupTokenIterator("[section]\nvalue: <<<base32\n    >>>");
         WITH_CONTEXT(verifyPrefix(PrefixFormat::SameLine));
         WITH_CONTEXT(requireNextToken(TokenType::MultiLineBytesOpen, u8"<<<"));
         WITH_CONTEXT(requireError(ErrorCategory::Unsupported));
 
-        setupTokenIterator("[section]\nvalue: <<<$base64\n    >>>");
+        setupTokenIterator("[section]\nvalue: <<<$base32\n    >>>");
         WITH_CONTEXT(verifyPrefix(PrefixFormat::SameLine));
         WITH_CONTEXT(requireNextToken(TokenType::MultiLineBytesOpen, u8"<<<"));
         WITH_CONTEXT(requireError(ErrorCategory::Syntax));
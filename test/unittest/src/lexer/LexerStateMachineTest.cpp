@@ -0,0 +1,139 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "LexerTestHelper.hpp"
+
+#include <erbsland/conf/impl/lexer/TokenQueue.hpp>
+#include <erbsland/conf/impl/parser/Parser.hpp>
+
+
+using impl::LexerEngine;
+using impl::ParserSettings;
+using impl::TokenQueue;
+
+
+TESTED_TARGETS(Lexer LexerStateMachine TokenQueue)
+class LexerStateMachineTest final : public UNITTEST_SUBCLASS(LexerTestHelper) {
+public:
+    /// Read all token types from the lexer using `nextToken()`.
+    auto readTokenTypes() -> std::vector<TokenType> {
+        std::vector<TokenType> result;
+        while (lexer->nextToken(token)) {
+            result.emplace_back(token.type());
+        }
+        return result;
+    }
+
+    void testTokenQueue() {
+        TokenQueue queue;
+        REQUIRE(queue.empty());
+        REQUIRE_FALSE(queue.pop(token));
+        queue.push(LexerToken{TokenType::Error});
+        queue.push(std::optional<LexerToken>{});
+        queue.push(std::optional<LexerToken>{LexerToken{TokenType::EndOfData}});
+        REQUIRE_FALSE(queue.empty());
+        REQUIRE(queue.pop(token));
+        REQUIRE_EQUAL(token.type(), TokenType::Error);
+        REQUIRE(queue.pop(token));
+        REQUIRE_EQUAL(token.type(), TokenType::EndOfData);
+        REQUIRE(queue.empty());
+        REQUIRE_FALSE(queue.pop(token));
+        queue.push(LexerToken{TokenType::Error});
+        queue.clear();
+        REQUIRE(queue.empty());
+    }
+
+    void testMultiLineDocument() {
+        setupLexer(String{
+            u8"[main]\n"
+            u8"text: \"\"\"\n"
+            u8"    first\n"
+            u8"\n"
+            u8"    second\n"
+            u8"    \"\"\"\n"
+            u8"list:\n"
+            u8"    * 1, 2\n"
+            u8"    * 3\n"});
+        const auto tokenTypes = readTokenTypes();
+        const auto expected = std::vector<TokenType>{
+            TokenType::SectionMapOpen, TokenType::RegularName, TokenType::SectionMapClose, TokenType::LineBreak,
+            TokenType::RegularName, TokenType::NameValueSeparator, TokenType::Spacing,
+            TokenType::MultiLineTextOpen, TokenType::LineBreak,
+            TokenType::Indentation, TokenType::MultiLineText, TokenType::LineBreak,
+            TokenType::LineBreak,
+            TokenType::Indentation, TokenType::MultiLineText, TokenType::LineBreak,
+            TokenType::Indentation, TokenType::MultiLineTextClose, TokenType::LineBreak,
+            TokenType::RegularName, TokenType::NameValueSeparator, TokenType::LineBreak,
+            TokenType::Indentation, TokenType::MultiLineValueListSeparator, TokenType::Spacing,
+            TokenType::Integer, TokenType::ValueListSeparator, TokenType::Spacing, TokenType::Integer,
+            TokenType::LineBreak,
+            TokenType::Indentation, TokenType::MultiLineValueListSeparator, TokenType::Spacing,
+            TokenType::Integer, TokenType::LineBreak,
+            TokenType::EndOfData,
+        };
+        REQUIRE(tokenTypes == expected);
+        // After the end, no more tokens are returned, and the slot is unchanged.
+        REQUIRE_FALSE(lexer->nextToken(token));
+        REQUIRE_EQUAL(token.type(), TokenType::EndOfData);
+    }
+
+    void testTokensBeforeErrorAreReturned() {
+        setupLexer(String{u8"[main] x\n"});
+        const auto expected = std::vector<TokenType>{
+            TokenType::SectionMapOpen, TokenType::RegularName, TokenType::SectionMapClose, TokenType::Spacing,
+        };
+        std::vector<TokenType> tokenTypes;
+        try {
+            while (lexer->nextToken(token)) {
+                tokenTypes.emplace_back(token.type());
+            }
+            REQUIRE(false);
+        } catch (const Error &error) {
+            REQUIRE_EQUAL(error.category(), ErrorCategory::Syntax);
+            REQUIRE(error.location().position() == Position(1, 8));
+        }
+        REQUIRE(tokenTypes == expected);
+        // The lexer is closed after an error.
+        REQUIRE_FALSE(lexer->nextToken(token));
+    }
+
+    void testClosedLexer() {
+        setupLexer(String{u8"value: 123\n"});
+        lexer->close();
+        try {
+            static_cast<void>(lexer->nextToken(token));
+            REQUIRE(false);
+        } catch (const Error &error) {
+            REQUIRE_EQUAL(error.category(), ErrorCategory::Internal);
+        }
+    }
+
+    void testParserEngines() {
+        const auto content = String{
+            u8"@version: \"1.0\"\n"
+            u8"[main]\n"
+            u8"value: 123  # comment\n"
+            u8"text: \"\"\"\n"
+            u8"    line\n"
+            u8"    \"\"\"\n"
+            u8"*[list]\n"
+            u8"bytes: <<<\n"
+            u8"    01 02 03\n"
+            u8"    >>>\n"
+            u8"*[list]\n"
+            u8"values:\n"
+            u8"    * 1, 2\n"
+            u8"    * \"a\"\n"};
+        const auto parseWithEngine = [&](const LexerEngine engine) -> String {
+            ParserSettings settings;
+            settings.lexerEngine = engine;
+            impl::Parser parser{Source::fromString(content), settings};
+            return parser.parse()->toTestValueTree();
+        };
+        const auto stateMachineTree = parseWithEngine(LexerEngine::StateMachine);
+        REQUIRE_FALSE(stateMachineTree.empty());
+        REQUIRE_EQUAL(stateMachineTree, parseWithEngine(LexerEngine::Generator));
+    }
+};
+
@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
@@ -11,7 +11,9 @@
 #include <erbsland/conf/Source.hpp>
 #include <erbsland/conf/impl/source/FileSource.hpp>
 
+#include <optional>
 #include <sstream>
+#include <vector>
 
 
 using namespace el::conf;
@@ -108,9 +110,59 @@ public:
     }
 
 
+    /// The tokens and the error read by one of the lexer engines.
+    struct EngineResult {
+        std::vector<String> tokens;
+        std::optional<String> error;
+    };
+
+    /// Lex the tested content again, using the generator or the state machine.
+    auto readWithEngine(const bool useStateMachine) -> EngineResult {
+        SourcePtr engineSource;
+        if (std::holds_alternative<std::filesystem::path>(testContentSource)) {
+            engineSource = Source::fromFile(std::get<std::filesystem::path>(testContentSource));
+        } else {
+            engineSource = Source::fromString(std::get<String>(testContentSource));
+        }
+        EngineResult result;
+        try {
+            engineSource->open();
+            auto engineLexer = Lexer::create(CharStream::create(engineSource));
+            if (useStateMachine) {
+                LexerToken engineToken;
+                while (engineLexer->nextToken(engineToken)) {
+                    result.tokens.emplace_back(internalView(engineToken)->toString());
+                }
+            } else {
+                for (const auto &engineToken : engineLexer->tokens()) {
+                    result.tokens.emplace_back(internalView(engineToken)->toString());
+                }
+            }
+        } catch (const Error &error) {
+            result.error = error.toText();
+        }
+        return result;
+    }
+
+    /// Require that the state machine produces exactly the same tokens and error as the generator.
+    void requireSameTokensFromStateMachine() {
+        const auto generatorResult = readWithEngine(false);
+        const auto stateMachineResult = readWithEngine(true);
+        REQUIRE_EQUAL(stateMachineResult.tokens.size(), generatorResult.tokens.size());
+        for (std::size_t i = 0; i < generatorResult.tokens.size(); ++i) {
+            runWithContext(SOURCE_LOCATION(), [&]() {
+                REQUIRE_EQUAL(stateMachineResult.tokens[i], generatorResult.tokens[i]);
+            }, [&]() -> std::string {
+                return std::format("Token index: {}", i);
+            });
+        }
+        REQUIRE(stateMachineResult.error == generatorResult.error);
+    }
+
     template<typename T>
     void setupTokenIterator(const T &content) {
         setupLexer(content);
+        WITH_CONTEXT(requireSameTokensFromStateMachine());
         tokenGenerator = lexer->tokens();
         tokenIterator = tokenGenerator.begin();
         tokenIteratorEnd = tokenGenerator.end();
@@ -0,0 +1,207 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "ParserTestHelper.hpp"
+
+#include <erbsland/conf/ParserCache.hpp>
+
+#include <chrono>
+#include <format>
+
+
+TESTED_TARGETS(Parser ParserCache)
+class ParserCacheTest final : public UNITTEST_SUBCLASS(ParserTestHelper) {
+public:
+    constexpr static std::size_t cPartCount = 8;
+
+    std::filesystem::path mainFile;
+    ParserCachePtr cache;
+
+    void tearDown() override {
+        cleanUpTestFileDirectory();
+        doc = {};
+        cache = {};
+    }
+
+    void createDocuments() {
+        mainFile = createTestFile(
+            "config/main.elcl",
+            u8"*[block]\n"
+            u8"value = \"main\"\n"
+            u8"@include: \"parts/*.elcl\"\n"
+            u8"[last]\n"
+            u8"value = 1\n");
+        for (std::size_t i = 0; i < cPartCount; ++i) {
+            createTestFile(std::format("config/parts/part_{:02}.elcl", i), partContent(i));
+        }
+        cache = ParserCache::create();
+    }
+
+    static auto partContent(const std::size_t i, const std::string_view value = "part") -> String {
+        return String::fromCharString(std::format(
+            "*[block]\n"
+            "value = \"{} {:02}\"\n"
+            "list = {}, {}, {}\n"
+            "matrix:\n"
+            "    * 1, 2\n"
+            "    * 3, 4\n"
+            "text = \"\"\"\n"
+            "    Text in part {}\n"
+            "    \"\"\"\n",
+            value, i, i, i + 1, i + 2, i));
+    }
+
+    auto parseDocument(const ParserCachePtr &parserCache, const std::size_t threadCount = 0) -> DocumentPtr {
+        Parser parser;
+        parser.setCache(parserCache);
+        parser.setParallelIncludes(threadCount);
+        return parser.parseOrThrow(Source::fromFile(mainFile));
+    }
+
+    /// Move the modification time of a file, to make sure a change is detected independent of the timer resolution.
+    static void moveModificationTime(const std::filesystem::path &path) {
+        std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::hours{1});
+    }
+
+    void testSameDocumentAsWithoutCache() {
+        createDocuments();
+        const auto expected = parseDocument({})->toTestValueTree(TestFormat{TestFormat::ShowPosition});
+        for (std::size_t run = 0; run < 3; ++run) {
+            runWithContext(SOURCE_LOCATION(), [&]() {
+                doc = parseDocument(cache);
+                REQUIRE(doc != nullptr);
+                REQUIRE_EQUAL(doc->toTestValueTree(TestFormat{TestFormat::ShowPosition}), expected);
+            }, [&]() -> std::string {
+                return std::format("run = {}", run);
+            });
+        }
+        REQUIRE_EQUAL(cache->size(), cPartCount + 1);
+        REQUIRE_EQUAL(cache->parsedSourceCount(), cPartCount + 1);
+        REQUIRE_EQUAL(cache->reusedSourceCount(), (cPartCount + 1) * 2);
+    }
+
+    void testParallelIncludes() {
+        createDocuments();
+        const auto expected = parseDocument({})->toTestValueTree(TestFormat{TestFormat::ShowPosition});
+        doc = parseDocument(cache, 4);
+        REQUIRE_EQUAL(doc->toTestValueTree(TestFormat{TestFormat::ShowPosition}), expected);
+        REQUIRE_EQUAL(cache->parsedSourceCount(), cPartCount + 1);
+        doc = parseDocument(cache, 4);
+        REQUIRE_EQUAL(doc->toTestValueTree(TestFormat{TestFormat::ShowPosition}), expected);
+        REQUIRE_EQUAL(cache->reusedSourceCount(), cPartCount + 1);
+    }
+
+    void testDocumentsAreIndependent() {
+        createDocuments();
+        const auto firstDoc = parseDocument(cache);
+        doc = parseDocument(cache);
+        REQUIRE(firstDoc->valueOrThrow(u8"block[1].value") != doc->valueOrThrow(u8"block[1].value"));
+        REQUIRE_EQUAL(doc->getTextOrThrow(u8"block[1].value"), String{u8"part 00"});
+        REQUIRE_EQUAL(doc->valueOrThrow(u8"block[1].matrix[1]")->parent(), doc->valueOrThrow(u8"block[1].matrix"));
+        REQUIRE_EQUAL(doc->valueOrThrow(u8"block[1].matrix")->parent(), doc->valueOrThrow(u8"block[1]"));
+        REQUIRE_EQUAL(doc->getIntegerOrThrow(u8"block[1].matrix[1][0]"), 3);
+    }
+
+    void testModifiedFileIsParsed() {
+        createDocuments();
+        doc = parseDocument(cache);
+        // Same size, different content.
+        const auto path = createTestFile("config/parts/part_03.elcl", partContent(3, "PART"));
+        moveModificationTime(path);
+        doc = parseDocument(cache);
+        REQUIRE_EQUAL(doc->getTextOrThrow(u8"block[4].value"), String{u8"PART 03"});
+        REQUIRE_EQUAL(cache->parsedSourceCount(), cPartCount + 2);
+        REQUIRE_EQUAL(cache->reusedSourceCount(), cPartCount);
+        // Different size.
+        createTestFile("config/parts/part_03.elcl", partContent(3, "changed"));
+        doc = parseDocument(cache);
+        REQUIRE_EQUAL(doc->getTextOrThrow(u8"block[4].value"), String{u8"changed 03"});
+        REQUIRE_EQUAL(cache->parsedSourceCount(), cPartCount + 3);
+        REQUIRE_EQUAL(cache->size(), cPartCount + 1);
+    }
+
+    void testRewriteWithSameSizeAndTimeIsParsed() {
+        createDocuments();
+        doc = parseDocument(cache);
+        // Rewrite a file in the same time-stamp interval, so neither its size nor its modification time change.
+        const auto path = mainFile.parent_path() / "parts" / "part_04.elcl";
+        const auto modificationTime = std::filesystem::last_write_time(path);
+        createTestFile("config/parts/part_04.elcl", partContent(4, "PART"));
+        std::filesystem::last_write_time(path, modificationTime);
+        doc = parseDocument(cache);
+        REQUIRE_EQUAL(doc->getTextOrThrow(u8"block[5].value"), String{u8"PART 04"});
+        REQUIRE_EQUAL(cache->parsedSourceCount(), cPartCount + 2);
+        REQUIRE_EQUAL(cache->reusedSourceCount(), cPartCount);
+        // The unchanged contents are reused on the next run.
+        doc = parseDocument(cache);
+        REQUIRE_EQUAL(doc->getTextOrThrow(u8"block[5].value"), String{u8"PART 04"});
+        REQUIRE_EQUAL(cache->parsedSourceCount(), cPartCount + 2);
+        REQUIRE_EQUAL(cache->reusedSourceCount(), cPartCount * 2 + 1);
+    }
+
+    void testTouchedFileIsReused() {
+        createDocuments();
+        doc = parseDocument(cache);
+        const auto path = createTestFile("config/parts/part_05.elcl", partContent(5));
+        moveModificationTime(path);
+        doc = parseDocument(cache);
+        REQUIRE_EQUAL(doc->getTextOrThrow(u8"block[6].value"), String{u8"part 05"});
+        REQUIRE_EQUAL(cache->parsedSourceCount(), cPartCount + 1);
+        REQUIRE_EQUAL(cache->reusedSourceCount(), cPartCount + 1);
+    }
+
+    void testNewAndRemovedFiles() {
+        createDocuments();
+        doc = parseDocument(cache);
+        createTestFile("config/parts/part_99.elcl", partContent(99));
+        std::filesystem::remove(mainFile.parent_path() / "parts" / "part_00.elcl");
+        doc = parseDocument(cache);
+        REQUIRE_EQUAL(doc->valueOrThrow(u8"block")->size(), cPartCount + 1);
+        REQUIRE_EQUAL(doc->getTextOrThrow(u8"block[1].value"), String{u8"part 01"});
+        REQUIRE_EQUAL(doc->getTextOrThrow(u8"block[8].value"), String{u8"part 99"});
+        REQUIRE_EQUAL(cache->parsedSourceCount(), cPartCount + 2);
+    }
+
+    void testErrorsAreNotCached() {
+        createDocuments();
+        createTestFile("config/parts/part_02.elcl", u8"*[block]\nvalue = \"part 02\"\nbroken\n");
+        REQUIRE_THROWS_AS(Error, doc = parseDocument(cache));
+        // The sources before the error are cached, the broken one and all following are not.
+        REQUIRE_EQUAL(cache->size(), 2);
+        const auto expected = [&]() -> Error {
+            try {
+                static_cast<void>(parseDocument(cache));
+            } catch (const Error &error) {
+                return error;
+            }
+            return Error{ErrorCategory::Internal, u8"No error."};
+        }();
+        REQUIRE_EQUAL(expected.category(), ErrorCategory::Syntax);
+        REQUIRE(expected.location().sourceIdentifier()->path().contains(u8"part_02"));
+        REQUIRE_EQUAL(cache->reusedSourceCount(), 2);
+    }
+
+    void testTextSourcesAreNotCached() {
+        cache = ParserCache::create();
+        Parser parser;
+        parser.setCache(cache);
+        doc = parser.parseOrThrow(Source::fromString(u8"[main]\nvalue = 1\n"));
+        doc = parser.parseOrThrow(Source::fromString(u8"[main]\nvalue = 1\n"));
+        REQUIRE_EQUAL(doc->getIntegerOrThrow(u8"main.value"), 1);
+        REQUIRE_EQUAL(cache->size(), 0);
+        REQUIRE_EQUAL(cache->parsedSourceCount(), 0);
+        REQUIRE_EQUAL(cache->reusedSourceCount(), 0);
+    }
+
+    void testClear() {
+        createDocuments();
+        doc = parseDocument(cache);
+        cache->clear();
+        REQUIRE_EQUAL(cache->size(), 0);
+        doc = parseDocument(cache);
+        REQUIRE_EQUAL(cache->parsedSourceCount(), (cPartCount + 1) * 2);
+        REQUIRE_EQUAL(cache->reusedSourceCount(), 0);
+    }
+};
+
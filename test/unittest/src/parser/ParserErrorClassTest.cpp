@@ -235,9 +235,9 @@ public:
             {u8"@features: \"core abcde\"\n", ErrorCategory::Unsupported},
             {u8"@features: `core`\n", ErrorCategory::Syntax},
             {u8"@features: \"\"\"\n    core\n    \"\"\"\n", ErrorCategory::Syntax},
-            {u8"[main]\nvalue: <base64: 01234>\n", ErrorCategory::Unsupported},
+            {u8"[main]\nvalue: <base32: 01234>\n", ErrorCategory::Unsupported},
             {u8"[main]\nvalue: <none$: 01234>\n", ErrorCategory::Syntax},
-            {u8"[main]\nvalue: <<<base64\n    01234\n    >>>\n", ErrorCategory::Unsupported},
+            {u8"[main]\nvalue: <<<base32\n    01234\n    >>>\n", ErrorCategory::Unsupported},
             {u8"[main]\nvalue: <<<none$\n    01234>\n    >>>\n", ErrorCategory::Syntax},
         };
         WITH_CONTEXT(verifyTestCases(testCases));
@@ -0,0 +1,183 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "ParserTestHelper.hpp"
+
+#include <erbsland/conf/FileAccessCheck.hpp>
+
+#include <format>
+#include <set>
+#include <thread>
+
+
+TESTED_TARGETS(Parser)
+class ParserParallelIncludeTest final : public UNITTEST_SUBCLASS(ParserTestHelper) {
+public:
+    /// An access check that records all checked sources and denies a single file.
+    class RecordingAccessCheck final : public AccessCheck {
+    public:
+        auto check(const AccessSources &sources) -> AccessCheckResult override {
+            checkedPaths.emplace_back(sources.source->path());
+            threadIds.insert(std::this_thread::get_id());
+            if (!deniedName.empty() && sources.source->path().contains(deniedName.raw())) {
+                return AccessCheckResult::Denied;
+            }
+            return fileAccessCheck.check(sources);
+        }
+
+        FileAccessCheck fileAccessCheck;
+        String deniedName;
+        std::vector<String> checkedPaths;
+        std::set<std::thread::id> threadIds;
+    };
+
+    constexpr static std::size_t cPartCount = 24;
+
+    std::filesystem::path mainFile;
+
+    void tearDown() override {
+        cleanUpTestFileDirectory();
+        doc = {};
+    }
+
+    void createDocuments() {
+        mainFile = createTestFile(
+            "config/main.elcl",
+            u8"*[block]\n"
+            u8"value = \"main\"\n"
+            u8"@include: \"parts/*.elcl\"\n"
+            u8"[last]\n"
+            u8"value = 1\n");
+        for (std::size_t i = 0; i < cPartCount; ++i) {
+            auto content = String::fromCharString(std::format(
+                "*[block]\n"
+                "value = \"part {:02}\"\n"
+                "list = {}, {}, {}\n"
+                "text = \"\"\"\n"
+                "    Text in part {}\n"
+                "    \"\"\"\n",
+                i, i, i + 1, i + 2, i));
+            if (i == 5) {
+                content.append(u8"@include: \"nested/**/*.elcl\"\n");
+            }
+            createTestFile(std::format("config/parts/part_{:02}.elcl", i), content);
+        }
+        for (std::size_t i = 0; i < 3; ++i) {
+            createTestFile(
+                std::format("config/parts/nested/n{}/nested.elcl", i),
+                String::fromCharString(std::format("*[block]\nvalue = \"nested {}\"\n", i)));
+        }
+    }
+
+    auto parseDocument(const std::size_t threadCount, const AccessCheckPtr &accessCheck = {}) -> DocumentPtr {
+        Parser parser;
+        parser.setParallelIncludes(threadCount);
+        if (accessCheck != nullptr) {
+            parser.setAccessCheck(accessCheck);
+        }
+        return parser.parseOrThrow(Source::fromFile(mainFile));
+    }
+
+    auto parseError(const std::size_t threadCount, const AccessCheckPtr &accessCheck = {}) -> Error {
+        try {
+            static_cast<void>(parseDocument(threadCount, accessCheck));
+        } catch (const Error &error) {
+            return error;
+        }
+        REQUIRE(false);
+        return Error{ErrorCategory::Internal, u8"No error."};
+    }
+
+    void testSameDocumentAsSequential() {
+        createDocuments();
+        const auto sequentialDoc = parseDocument(0);
+        REQUIRE(sequentialDoc != nullptr);
+        REQUIRE_EQUAL(sequentialDoc->valueOrThrow(u8"block")->size(), cPartCount + 4);
+        REQUIRE_EQUAL(sequentialDoc->getTextOrThrow(u8"block[7].value"), String{u8"nested 0"});
+        const auto expected = sequentialDoc->toTestValueTree(TestFormat{TestFormat::ShowPosition});
+        for (const std::size_t threadCount : {1U, 2U, 8U}) {
+            runWithContext(SOURCE_LOCATION(), [&]() {
+                doc = parseDocument(threadCount);
+                REQUIRE(doc != nullptr);
+                REQUIRE_EQUAL(doc->toTestValueTree(TestFormat{TestFormat::ShowPosition}), expected);
+            }, [&]() -> std::string {
+                return std::format("threadCount = {}", threadCount);
+            });
+        }
+    }
+
+    void testArenaAllocation() {
+        createDocuments();
+        const auto expected = parseDocument(0)->toTestValueTree();
+        Parser parser;
+        parser.setParallelIncludes(4);
+        parser.setArenaAllocation(true);
+        doc = parser.parseOrThrow(Source::fromFile(mainFile));
+        REQUIRE(doc != nullptr);
+        REQUIRE_EQUAL(doc->toTestValueTree(), expected);
+    }
+
+    void testFirstErrorIsReported() {
+        createDocuments();
+        // Two broken documents, the first one in include order must be reported.
+        createTestFile("config/parts/part_03.elcl", u8"*[block]\nvalue = \"part 03\"\nbroken\n");
+        createTestFile("config/parts/part_15.elcl", u8"*[block]\nvalue = \"part 15\"\n[[[\n");
+        const auto expected = parseError(0);
+        REQUIRE_EQUAL(expected.category(), ErrorCategory::Syntax);
+        REQUIRE(expected.location().sourceIdentifier()->path().contains(u8"part_03"));
+        const auto actual = parseError(4);
+        REQUIRE_EQUAL(actual.toText(), expected.toText());
+    }
+
+    void testErrorInDocumentBuilder() {
+        createDocuments();
+        // The builder error in part 02 is raised before the syntax error in part 10 is reached.
+        createTestFile("config/parts/part_02.elcl", u8"[block]\nvalue = 2\n");
+        createTestFile("config/parts/part_10.elcl", u8"broken\n");
+        const auto expected = parseError(0);
+        REQUIRE(expected.location().sourceIdentifier()->path().contains(u8"part_02"));
+        const auto actual = parseError(4);
+        REQUIRE_EQUAL(actual.toText(), expected.toText());
+    }
+
+    void testAccessCheck() {
+        createDocuments();
+        const auto sequentialCheck = std::make_shared<RecordingAccessCheck>();
+        REQUIRE_NOTHROW(static_cast<void>(parseDocument(0, sequentialCheck)));
+        const auto parallelCheck = std::make_shared<RecordingAccessCheck>();
+        REQUIRE_NOTHROW(static_cast<void>(parseDocument(4, parallelCheck)));
+        // Every source is checked exactly once, from the thread that called the parser.
+        auto sequentialPaths = sequentialCheck->checkedPaths;
+        auto parallelPaths = parallelCheck->checkedPaths;
+        REQUIRE_EQUAL(parallelPaths.size(), cPartCount + 4);
+        std::ranges::sort(sequentialPaths);
+        std::ranges::sort(parallelPaths);
+        REQUIRE(parallelPaths == sequentialPaths);
+        REQUIRE_EQUAL(parallelCheck->threadIds.size(), 1U);
+        REQUIRE(parallelCheck->threadIds.contains(std::this_thread::get_id()));
+    }
+
+    void testAccessDenied() {
+        createDocuments();
+        createTestFile("config/parts/part_20.elcl", u8"broken\n");
+        const auto sequentialCheck = std::make_shared<RecordingAccessCheck>();
+        sequentialCheck->deniedName = u8"part_08";
+        const auto expected = parseError(0, sequentialCheck);
+        REQUIRE_EQUAL(expected.category(), ErrorCategory::Access);
+        const auto parallelCheck = std::make_shared<RecordingAccessCheck>();
+        parallelCheck->deniedName = u8"part_08";
+        const auto actual = parseError(4, parallelCheck);
+        REQUIRE_EQUAL(actual.toText(), expected.toText());
+    }
+
+    void testIncludeLoop() {
+        createDocuments();
+        createTestFile("config/parts/part_12.elcl", u8"@include: \"../main.elcl\"\n");
+        const auto expected = parseError(0);
+        const auto actual = parseError(4);
+        REQUIRE_EQUAL(actual.category(), ErrorCategory::Syntax);
+        REQUIRE_EQUAL(actual.toText(), expected.toText());
+    }
+};
+
@@ -0,0 +1,243 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "ValueTestHelper.hpp"
+
+#include <erbsland/conf/DocumentDiff.hpp>
+
+
+TESTED_TARGETS(DocumentDiff)
+class DocumentDiffTest final : public UNITTEST_SUBCLASS(ValueTestHelper) {
+public:
+    using Change = DocumentDiff::Change;
+
+    DocumentPtr oldDoc;
+    DocumentDiff diff;
+
+    auto additionalErrorMessages() -> std::string override {
+        std::string result = "diff:\n";
+        for (const auto &entry : diff) {
+            result += std::format("  {} {}\n", changeText(entry.change), entry.namePath.toText().toCharString());
+        }
+        return result;
+    }
+
+    void tearDown() override {
+        oldDoc = {};
+        doc = {};
+        diff = {};
+    }
+
+    static auto changeText(const Change change) -> std::string {
+        switch (change) {
+        case Change::Added: return "added";
+        case Change::Removed: return "removed";
+        case Change::Changed: return "changed";
+        }
+        return "unknown";
+    }
+
+    static auto parse(const std::string &text) -> DocumentPtr {
+        Parser parser;
+        return parser.parseOrThrow(Source::fromString(String{text}));
+    }
+
+    void compare(const std::string &oldText, const std::string &newText) {
+        oldDoc = parse(oldText);
+        doc = parse(newText);
+        diff = DocumentDiff::compare(oldDoc, doc);
+    }
+
+    void requireEntry(const std::size_t index, const Change change, const std::string_view namePath) {
+        REQUIRE(index < diff.size());
+        const auto &entry = diff.entries()[index];
+        REQUIRE_EQUAL(entry.change, change);
+        REQUIRE_EQUAL(entry.namePath, NamePath::fromText(String{namePath}));
+        if (change == Change::Added) {
+            REQUIRE(entry.oldValue == nullptr);
+            REQUIRE(entry.newValue != nullptr);
+            REQUIRE_EQUAL(entry.newValue->namePath(), entry.namePath);
+        } else if (change == Change::Removed) {
+            REQUIRE(entry.oldValue != nullptr);
+            REQUIRE(entry.newValue == nullptr);
+            REQUIRE_EQUAL(entry.oldValue->namePath(), entry.namePath);
+        } else {
+            REQUIRE(entry.oldValue != nullptr);
+            REQUIRE(entry.newValue != nullptr);
+        }
+    }
+
+    void testEqualDocuments() {
+        const std::string text =
+            "[main]\n"
+            "integer: 42\n"
+            "float: 1.5\n"
+            "nan: NaN\n"
+            "text: \"text\"\n"
+            "bytes: <01 02 03>\n"
+            "date: 2026-01-02\n"
+            "time: 10:00:00+01:00\n"
+            "date_time: 2026-01-02 10:00:00z\n"
+            "time_delta: 10 minutes\n"
+            "regex: /[a-z]+/\n"
+            "list: 1, 2, 3\n"
+            "[main.sub.section]\n"
+            "value: yes\n"
+            "*[server]*\n"
+            "name: \"one\"\n"
+            "*[server]*\n"
+            "name: \"two\"\n"
+            "[text.\"First Text\"]\n"
+            "value: 1\n";
+        compare(text, text);
+        REQUIRE(diff.empty());
+        REQUIRE_EQUAL(diff.size(), 0U);
+        REQUIRE_FALSE(diff.affects(u8"main"));
+        diff = DocumentDiff::compare(doc, doc);
+        REQUIRE(diff.empty());
+    }
+
+    void testChangedValues() {
+        compare(
+            "[main]\n"
+            "a: 1\n"
+            "b: \"text\"\n"
+            "c: 1, 2, 3\n"
+            "d: 10:00:00+01:00\n"
+            "e: 60 minutes\n"
+            "f: 1\n"
+            "g: 2\n",
+            "[main]\n"
+            "a: 2\n"
+            "b: \"text\"\n"
+            "c: 1, 2, 4\n"
+            "d: 09:00:00z\n"
+            "e: 1 hour\n"
+            "f: 1.0\n"
+            "g: 2\n");
+        REQUIRE_EQUAL(diff.size(), 5U);
+        requireEntry(0, Change::Changed, "main.a");
+        REQUIRE_EQUAL(diff.entries()[0].oldValue->asInteger(), 1);
+        REQUIRE_EQUAL(diff.entries()[0].newValue->asInteger(), 2);
+        requireEntry(1, Change::Changed, "main.c");
+        requireEntry(2, Change::Changed, "main.d");
+        requireEntry(3, Change::Changed, "main.e");
+        requireEntry(4, Change::Changed, "main.f");
+        REQUIRE_EQUAL(diff.entries()[4].newValue->type(), ValueType::Float);
+    }
+
+    void testAddedAndRemovedValues() {
+        compare(
+            "[main]\n"
+            "a: 1\n"
+            "b: 2\n"
+            "[removed]\n"
+            "x: 1\n"
+            "[removed.nested]\n"
+            "y: 2\n",
+            "[main]\n"
+            "b: 2\n"
+            "c: 3\n"
+            "[added.nested]\n"
+            "y: 2\n");
+        REQUIRE_EQUAL(diff.size(), 4U);
+        requireEntry(0, Change::Added, "main.c");
+        requireEntry(1, Change::Removed, "main.a");
+        requireEntry(2, Change::Added, "added");
+        requireEntry(3, Change::Removed, "removed");
+    }
+
+    void testSectionLists() {
+        compare(
+            "*[server]*\n"
+            "name: \"one\"\n"
+            "*[server]*\n"
+            "name: \"two\"\n"
+            "*[client]*\n"
+            "name: \"one\"\n"
+            "*[client]*\n"
+            "name: \"two\"\n",
+            "*[server]*\n"
+            "name: \"one\"\n"
+            "*[server]*\n"
+            "name: \"TWO\"\n"
+            "*[server]*\n"
+            "name: \"three\"\n"
+            "*[client]*\n"
+            "name: \"one\"\n");
+        REQUIRE_EQUAL(diff.size(), 3U);
+        requireEntry(0, Change::Changed, "server[1].name");
+        requireEntry(1, Change::Added, "server[2]");
+        requireEntry(2, Change::Removed, "client[1]");
+    }
+
+    void testChangedType() {
+        compare(
+            "[main]\n"
+            "value: 1\n"
+            "[main.section]\n"
+            "value: 1\n",
+            "[main]\n"
+            "section: 1\n"
+            "[main.value]\n"
+            "value: 1\n");
+        REQUIRE_EQUAL(diff.size(), 2U);
+        requireEntry(0, Change::Changed, "main.section");
+        requireEntry(1, Change::Changed, "main.value");
+        REQUIRE_EQUAL(diff.entries()[1].oldValue->type(), ValueType::Integer);
+        REQUIRE_EQUAL(diff.entries()[1].newValue->type(), ValueType::SectionWithNames);
+    }
+
+    void testIntermediateSectionsAreMatched() {
+        compare(
+            "[main.sub]\n"
+            "value: 1\n",
+            "[main]\n"
+            "[main.sub]\n"
+            "value: 2\n");
+        REQUIRE_EQUAL(oldDoc->value(u8"main")->type(), ValueType::IntermediateSection);
+        REQUIRE_EQUAL(doc->value(u8"main")->type(), ValueType::SectionWithNames);
+        REQUIRE_EQUAL(diff.size(), 1U);
+        requireEntry(0, Change::Changed, "main.sub.value");
+    }
+
+    void testEmptyDocuments() {
+        doc = parse("[main]\nvalue: 1\n[other]\nvalue: 2\n");
+        diff = DocumentDiff::compare({}, doc);
+        REQUIRE_EQUAL(diff.size(), 2U);
+        requireEntry(0, Change::Added, "main");
+        requireEntry(1, Change::Added, "other");
+        diff = DocumentDiff::compare(doc, nullptr);
+        REQUIRE_EQUAL(diff.size(), 2U);
+        requireEntry(0, Change::Removed, "main");
+        requireEntry(1, Change::Removed, "other");
+        diff = DocumentDiff::compare({}, {});
+        REQUIRE(diff.empty());
+    }
+
+    void testCompareSections() {
+        compare(
+            "[main.one]\nvalue: 1\n[main.two]\nvalue: 2\n",
+            "[main.one]\nvalue: 1\n[main.two]\nvalue: 3\n");
+        diff = DocumentDiff::compare(oldDoc->value(u8"main.one"), doc->value(u8"main.one"));
+        REQUIRE(diff.empty());
+        diff = DocumentDiff::compare(oldDoc->value(u8"main.two"), doc->value(u8"main.two"));
+        REQUIRE_EQUAL(diff.size(), 1U);
+        requireEntry(0, Change::Changed, "main.two.value");
+    }
+
+    void testAffects() {
+        compare(
+            "[server.network]\nport: 80\n[server.storage]\npath: \"/tmp\"\n[client]\nname: \"a\"\n",
+            "[server.network]\nport: 8080\n[server.storage]\npath: \"/tmp\"\n[client]\nname: \"a\"\n");
+        REQUIRE_EQUAL(diff.size(), 1U);
+        REQUIRE(diff.affects(u8"server"));
+        REQUIRE(diff.affects(u8"server.network"));
+        REQUIRE(diff.affects(u8"server.network.port"));
+        REQUIRE_FALSE(diff.affects(u8"server.storage"));
+        REQUIRE_FALSE(diff.affects(u8"client"));
+        REQUIRE_FALSE(diff.affects(u8"server.network.host"));
+    }
+};
+
@@ -0,0 +1,220 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "TestHelper.hpp"
+
+#include <erbsland/conf/DocumentDiff.hpp>
+#include <erbsland/conf/DocumentSnapshot.hpp>
+#include <erbsland/conf/Parser.hpp>
+#include <erbsland/conf/vr/Rules.hpp>
+
+#include <fstream>
+
+
+using namespace el::conf;
+
+
+TESTED_TARGETS(DocumentSnapshot)
+class DocumentSnapshotTest final : public UNITTEST_SUBCLASS(TestHelper) {
+public:
+    DocumentPtr doc;
+    DocumentPtr loadedDoc;
+
+    void tearDown() override {
+        cleanUpTestFileDirectory();
+        doc = {};
+        loadedDoc = {};
+    }
+
+    auto additionalErrorMessages() -> std::string override {
+        try {
+            std::string result;
+            if (doc != nullptr) {
+                result += "doc:\n";
+                result += doc->toTestValueTree(testFormat()).toCharString();
+            }
+            if (loadedDoc != nullptr) {
+                result += "loadedDoc:\n";
+                result += loadedDoc->toTestValueTree(testFormat()).toCharString();
+            }
+            return result;
+        } catch (...) {
+            return "Exception while creating additional error messages.";
+        }
+    }
+
+    static auto testFormat() -> TestFormat {
+        return TestFormat{TestFormat::ShowContainerSize, TestFormat::ShowPosition, TestFormat::ShowSourceIdentifier};
+    }
+
+    static auto parse(const std::string &text) -> DocumentPtr {
+        Parser parser;
+        return parser.parseOrThrow(Source::fromString(String{text}));
+    }
+
+    static auto fullDocumentText() -> std::string {
+        return
+            "@version: \"1.0\"\n"
+            "[main]\n"
+            "integer: -12345678901\n"
+            "boolean: yes\n"
+            "float: -1.5e10\n"
+            "not_a_number: NaN\n"
+            "text: \"Text with 😀 and \\n escapes\"\n"
+            "bytes: <01 02 fe ff>\n"
+            "date: 2026-01-02\n"
+            "time: 10:11:12.123456+01:30\n"
+            "local_time: 23:59:59\n"
+            "date_time: 2026-01-02 10:00:00z\n"
+            "time_delta: 10 minutes\n"
+            "regex: /[a-z]+\\d/\n"
+            "list: 1, \"two\", 3.0\n"
+            "matrix:\n"
+            "    * 1, 2\n"
+            "    * 3, 4\n"
+            "[main.sub.section]\n"
+            "value: 1\n"
+            "*[server]*\n"
+            "name: \"one\"\n"
+            "*[server]*\n"
+            "name: \"two\"\n"
+            "[texts]\n"
+            "\"first text\": 1\n"
+            "[texts.\"second text\"]\n"
+            "value: 2\n";
+    }
+
+    void requireEqualDocuments() {
+        REQUIRE(loadedDoc != nullptr);
+        REQUIRE_EQUAL(loadedDoc->toTestValueTree(testFormat()), doc->toTestValueTree(testFormat()));
+        REQUIRE(DocumentDiff::compare(doc, loadedDoc).empty());
+        REQUIRE_EQUAL(loadedDoc->contentHash(), doc->contentHash());
+    }
+
+    template<typename Fn>
+    void requireError(const ErrorCategory expectedCategory, Fn fn) {
+        try {
+            fn();
+            REQUIRE(false);
+        } catch (const Error &error) {
+            REQUIRE_EQUAL(error.category(), expectedCategory);
+        }
+    }
+
+    void testRoundTrip() {
+        doc = parse(fullDocumentText());
+        const auto digest = Bytes::fromHex("0102030405060708");
+        const auto data = DocumentSnapshot::toBytes(doc, digest);
+        DocumentSnapshot snapshot;
+        REQUIRE_NOTHROW(snapshot = DocumentSnapshot::fromBytes(data.raw()));
+        REQUIRE_EQUAL(snapshot.sourceDigest(), digest);
+        loadedDoc = snapshot.document();
+        requireEqualDocuments();
+        // The loaded document is fully functional.
+        REQUIRE_EQUAL(loadedDoc->getInteger(u8"main.integer"), -12345678901);
+        REQUIRE_EQUAL(loadedDoc->getText(u8"server[1].name"), String{u8"two"});
+        REQUIRE_EQUAL(loadedDoc->valueOrThrow(u8"main.list[1]")->namePath(), NamePath::fromText(u8"main.list[1]"));
+        REQUIRE(loadedDoc->valueOrThrow(u8"main.sub")->parent() == loadedDoc->valueOrThrow(u8"main"));
+        // Writing the loaded document results in the same data.
+        REQUIRE_EQUAL(DocumentSnapshot::toBytes(loadedDoc, digest), data);
+    }
+
+    void testEmptyDocument() {
+        doc = parse("");
+        const auto data = DocumentSnapshot::toBytes(doc);
+        loadedDoc = DocumentSnapshot::fromBytes(data.raw()).document();
+        REQUIRE_EQUAL(loadedDoc->size(), 0);
+        REQUIRE_THROWS_AS(std::invalid_argument, [[maybe_unused]] auto unused = DocumentSnapshot::toBytes({}));
+    }
+
+    void testDefaultValues() {
+        doc = parse("[server]\n");
+        const auto rules = vr::Rules::createFromDocument(parse(
+            "[server]\n"
+            "type: \"section\"\n"
+            "[server.port]\n"
+            "type: \"integer\"\n"
+            "default: 8080\n"));
+        REQUIRE_NOTHROW(rules->validate(doc, 1));
+        loadedDoc = DocumentSnapshot::fromBytes(DocumentSnapshot::toBytes(doc).raw()).document();
+        requireEqualDocuments();
+        const auto port = loadedDoc->valueOrThrow(u8"server.port");
+        REQUIRE(port->isDefaultValue());
+        REQUIRE_EQUAL(port->asInteger(), 8080);
+        // Validation rules are not part of the snapshot.
+        REQUIRE_FALSE(port->wasValidated());
+        REQUIRE_FALSE(loadedDoc->valueOrThrow(u8"server")->isDefaultValue());
+    }
+
+    void testFileRoundTrip() {
+        const auto configPath = useTestFileDirectory() / "config.elcl";
+        {
+            std::ofstream stream{configPath, std::ios::binary};
+            stream << fullDocumentText();
+        }
+        Parser parser;
+        doc = parser.parseOrThrow(Source::fromFile(configPath));
+        const auto digest = DocumentSnapshot::calculateSourceDigest({configPath});
+        REQUIRE_FALSE(digest.empty());
+        const auto snapshotPath = useTestFileDirectory() / "config.snapshot";
+        REQUIRE_NOTHROW(DocumentSnapshot::writeFile(snapshotPath, doc, digest));
+        REQUIRE(std::filesystem::is_regular_file(snapshotPath));
+        REQUIRE_FALSE(std::filesystem::exists(useTestFileDirectory() / "config.snapshot.tmp"));
+        REQUIRE_EQUAL(DocumentSnapshot::readSourceDigest(snapshotPath), digest);
+        DocumentSnapshot snapshot;
+        REQUIRE_NOTHROW(snapshot = DocumentSnapshot::fromFile(snapshotPath));
+        REQUIRE_EQUAL(snapshot.sourceDigest(), digest);
+        loadedDoc = snapshot.document();
+        requireEqualDocuments();
+        // The source identifiers point to the original file.
+        REQUIRE_EQUAL(
+            loadedDoc->valueOrThrow(u8"main.integer")->location().sourceIdentifier()->name(),
+            String{u8"file"});
+        // Changing the source changes the digest.
+        {
+            std::ofstream stream{configPath, std::ios::binary};
+            stream << "[main]\nvalue: 1\n";
+        }
+        REQUIRE_NOT_EQUAL(DocumentSnapshot::calculateSourceDigest({configPath}), digest);
+        requireError(ErrorCategory::IO, [&]() {
+            [[maybe_unused]] auto unused = DocumentSnapshot::calculateSourceDigest({useTestFileDirectory() / "missing"});
+        });
+        requireError(ErrorCategory::IO, [&]() {
+            [[maybe_unused]] auto unused = DocumentSnapshot::fromFile(useTestFileDirectory() / "missing");
+        });
+    }
+
+    void testInvalidData() {
+        doc = parse(fullDocumentText());
+        const auto data = DocumentSnapshot::toBytes(doc, Bytes::fromHex("aabbccdd"));
+        requireError(ErrorCategory::Unsupported, [&]() {
+            [[maybe_unused]] auto unused = DocumentSnapshot::fromBytes({});
+        });
+        auto modified = data;
+        modified[0] = std::byte{'X'};
+        requireError(ErrorCategory::Unsupported, [&]() {
+            [[maybe_unused]] auto unused = DocumentSnapshot::fromBytes(modified.raw());
+        });
+        modified = data;
+        modified[8] = std::byte{2}; // the version.
+        requireError(ErrorCategory::Unsupported, [&]() {
+            [[maybe_unused]] auto unused = DocumentSnapshot::fromBytes(modified.raw());
+        });
+        // Every changed byte after the header is detected.
+        for (std::size_t i = 20; i < data.size(); i += 7) {
+            modified = data;
+            modified[i] ^= std::byte{0x10};
+            requireError(ErrorCategory::Syntax, [&]() {
+                [[maybe_unused]] auto unused = DocumentSnapshot::fromBytes(modified.raw());
+            });
+        }
+        // Truncated data.
+        for (std::size_t size = 20; size < data.size(); size += 11) {
+            requireError(ErrorCategory::Syntax, [&]() {
+                [[maybe_unused]] auto unused = DocumentSnapshot::fromBytes(std::span{data.raw()}.first(size));
+            });
+        }
+    }
+};
+
@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Tobias Erbsland - https://erbsland.dev
+// Copyright (c) 2025-2026 Tobias Erbsland - https://erbsland.dev
 // SPDX-License-Identifier: Apache-2.0
 
 
@@ -119,6 +119,29 @@ public:
         REQUIRE(names.contains(Name::createIndex(32)));
     }
 
+    void testCachedHash() {
+        // The hash is calculated when a name is created and copied or moved with the name.
+        const auto original = Name::createText(u8"A longer text name that does not fit into a small string");
+        auto copy = original;
+        REQUIRE_EQUAL(copy.hash(), original.hash());
+        REQUIRE(copy == original);
+        auto moved = std::move(copy);
+        REQUIRE_EQUAL(moved.hash(), original.hash());
+        REQUIRE(moved == original);
+        copy = Name::createRegular(u8"server");
+        REQUIRE_EQUAL(copy.hash(), Name::createRegular(u8"Server").hash());
+        // The empty name has a valid hash too.
+        REQUIRE_EQUAL(Name{}.hash(), Name::emptyInstance().hash());
+        REQUIRE(Name{} == Name::emptyInstance());
+        // Names with the same value, but a different type, are never equal.
+        REQUIRE(Name::createIndex(1) != Name::createTextIndex(1));
+        REQUIRE(Name::createRegular(u8"value") != Name::createText(u8"value"));
+        // The order does not depend on the hash.
+        REQUIRE(Name::createRegular(u8"a") < Name::createRegular(u8"b"));
+        REQUIRE(Name::createRegular(u8"b") < Name::createRegular(u8"c"));
+        REQUIRE(Name::createIndex(2) < Name::createIndex(10));
+    }
+
     void testFormat() {
         name = Name::createRegular(u8"server");
         auto text = std::format("*{}*", name);
@@ -0,0 +1,81 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "ValueTestHelper.hpp"
+
+
+TESTED_TARGETS(Value)
+class ValueBorrowedAccessTest final : public UNITTEST_SUBCLASS(ValueTestHelper) {
+public:
+    static auto parse(const std::string &text) -> DocumentPtr {
+        Parser parser;
+        return parser.parseOrThrow(Source::fromString(String{text}));
+    }
+
+    void requireNamePathElements(const ConstValuePtr &testedValue) {
+        NameList names;
+        testedValue->forEachNamePathElement([&](const Name &name) {
+            names.push_back(name);
+        });
+        REQUIRE_EQUAL(NamePath{names}, testedValue->namePath());
+    }
+
+    TESTED_TARGETS(nameRef locationRef)
+    void testNameAndLocation() {
+        setupTemplate1("1");
+        REQUIRE(doc->nameRef().empty());
+        REQUIRE_EQUAL(doc->locationRef(), doc->location());
+        for (const auto &[namePath, flatValue] : doc->toFlatValueMap()) {
+            REQUIRE_EQUAL(flatValue->nameRef(), flatValue->name());
+            REQUIRE_EQUAL(flatValue->locationRef(), flatValue->location());
+            // The reference points to the storage of the value.
+            REQUIRE_EQUAL(&flatValue->nameRef(), &flatValue->nameRef());
+        }
+        value = doc->value("main.text.\"second\"");
+        REQUIRE(value != nullptr);
+        REQUIRE_EQUAL(value->nameRef(), Name::createText(u8"second"));
+        REQUIRE_EQUAL(value->locationRef().position().line(), value->location().position().line());
+    }
+
+    TESTED_TARGETS(textView bytesView)
+    void testTextAndBytes() {
+        doc = parse(
+            "[main]\n"
+            "text: \"Text with 😀\"\n"
+            "empty_text: \"\"\n"
+            "bytes: <01 02 fe>\n"
+            "integer: 123\n");
+        value = doc->valueOrThrow(u8"main.text");
+        REQUIRE(value->textView() == std::u8string_view{u8"Text with 😀"});
+        REQUIRE(value->textView().data() == value->textView().data());
+        REQUIRE(value->bytesView().empty());
+        REQUIRE(doc->valueOrThrow(u8"main.empty_text")->textView().empty());
+        value = doc->valueOrThrow(u8"main.bytes");
+        const auto bytes = value->bytesView();
+        REQUIRE_EQUAL(bytes.size(), 3);
+        REQUIRE(bytes[0] == std::byte{0x01});
+        REQUIRE(bytes[2] == std::byte{0xfe});
+        REQUIRE(value->textView().empty());
+        value = doc->valueOrThrow(u8"main.integer");
+        REQUIRE(value->textView().empty());
+        REQUIRE(value->bytesView().empty());
+        REQUIRE(doc->textView().empty());
+        REQUIRE(doc->bytesView().empty());
+    }
+
+    TESTED_TARGETS(forEachNamePathElement)
+    void testForEachNamePathElement() {
+        setupTemplate1("1");
+        requireNamePathElements(doc);
+        for (const auto &[namePath, flatValue] : doc->toFlatValueMap()) {
+            requireNamePathElements(flatValue);
+        }
+        value = doc->value("main.value_matrix");
+        REQUIRE(value != nullptr);
+        REQUIRE_NOTHROW(value = value->asValueList().at(2));
+        REQUIRE_NOTHROW(value = value->asValueList().at(1));
+        requireNamePathElements(value);
+    }
+};
+
@@ -0,0 +1,175 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "ValueTestHelper.hpp"
+
+#include <erbsland/conf/impl/value/ValueTreeGeneration.hpp>
+#include <erbsland/conf/vr/Rules.hpp>
+
+#include <thread>
+
+
+TESTED_TARGETS(Value)
+class ValueContentHashTest final : public UNITTEST_SUBCLASS(ValueTestHelper) {
+public:
+    DocumentPtr otherDoc;
+
+    void tearDown() override {
+        doc = {};
+        otherDoc = {};
+    }
+
+    static auto parse(const std::string &text) -> DocumentPtr {
+        Parser parser;
+        return parser.parseOrThrow(Source::fromString(String{text}));
+    }
+
+    void requireEqualHash(const std::string_view namePath) {
+        REQUIRE_EQUAL(
+            doc->valueOrThrow(String{namePath})->contentHash(),
+            otherDoc->valueOrThrow(String{namePath})->contentHash());
+    }
+
+    void requireDifferentHash(const std::string_view namePath) {
+        REQUIRE_NOT_EQUAL(
+            doc->valueOrThrow(String{namePath})->contentHash(),
+            otherDoc->valueOrThrow(String{namePath})->contentHash());
+    }
+
+    void testEqualDocuments() {
+        const std::string text =
+            "[main]\n"
+            "integer: 42\n"
+            "float: 1.5\n"
+            "text: \"text\"\n"
+            "bytes: <01 02 03>\n"
+            "date: 2026-01-02\n"
+            "time: 10:00:00+01:00\n"
+            "date_time: 2026-01-02 10:00:00z\n"
+            "time_delta: 10 minutes\n"
+            "regex: /[a-z]+/\n"
+            "list: 1, 2, 3\n"
+            "*[main.server]*\n"
+            "name: \"one\"\n";
+        doc = parse(text);
+        // Locations are not part of the hash.
+        otherDoc = parse("\n\n" + text);
+        REQUIRE_EQUAL(doc->contentHash(), otherDoc->contentHash());
+        for (const auto &[namePath, value] : doc->toFlatValueMap()) {
+            REQUIRE_EQUAL(value->contentHash(), otherDoc->valueOrThrow(namePath)->contentHash());
+        }
+        // The cached hash is returned on the next call.
+        REQUIRE_EQUAL(doc->contentHash(), otherDoc->contentHash());
+    }
+
+    void testChangedValueChangesParents() {
+        doc = parse("[main.a]\nvalue: 1\n[main.b]\nvalue: 2\n");
+        otherDoc = parse("[main.a]\nvalue: 1\n[main.b]\nvalue: 3\n");
+        requireEqualHash("main.a");
+        requireEqualHash("main.a.value");
+        requireDifferentHash("main.b.value");
+        requireDifferentHash("main.b");
+        requireDifferentHash("main");
+        REQUIRE_NOT_EQUAL(doc->contentHash(), otherDoc->contentHash());
+    }
+
+    void testTypeAndNameArePartOfTheHash() {
+        doc = parse("[main]\na: 1\nb: 1\nc: \"1\"\nd: 1.0\n");
+        REQUIRE_NOT_EQUAL(doc->valueOrThrow(u8"main.a")->contentHash(), doc->valueOrThrow(u8"main.b")->contentHash());
+        otherDoc = parse("[main]\na: \"1\"\nb: 1.0\n");
+        requireDifferentHash("main.a");
+        requireDifferentHash("main.b");
+    }
+
+    void testSectionOrderDoesNotMatter() {
+        doc = parse("[main]\na: 1\nb: 2\n[other]\nx: 1\n");
+        otherDoc = parse("[other]\nx: 1\n[main]\nb: 2\na: 1\n");
+        requireEqualHash("main");
+        REQUIRE_EQUAL(doc->contentHash(), otherDoc->contentHash());
+        // The order of list elements matters.
+        doc = parse("[main]\nlist: 1, 2\n");
+        otherDoc = parse("[main]\nlist: 2, 1\n");
+        requireDifferentHash("main.list");
+    }
+
+    void testFloatEdgeCases() {
+        doc = parse("[main]\na: 0.0\nb: NaN\n");
+        otherDoc = parse("[main]\na: -0.0\nb: -NaN\n");
+        requireEqualHash("main.a");
+        requireEqualHash("main.b");
+    }
+
+    void testTimeOffsetsAndUnits() {
+        doc = parse("[main]\na: 10:00:00+01:00\nb: 60 minutes\n");
+        otherDoc = parse("[main]\na: 09:00:00z\nb: 1 hour\n");
+        requireDifferentHash("main.a");
+        requireDifferentHash("main.b");
+    }
+
+    void testHashIsUpdatedAfterValidation() {
+        doc = parse("[server]\n");
+        const auto hashBefore = doc->contentHash();
+        const auto sectionHashBefore = doc->valueOrThrow(u8"server")->contentHash();
+        const auto rules = vr::Rules::createFromDocument(parse(
+            "[server]\n"
+            "type: \"section\"\n"
+            "[server.port]\n"
+            "type: \"integer\"\n"
+            "default: 8080\n"));
+        REQUIRE_NOTHROW(rules->validate(doc, 1));
+        REQUIRE_NOT_EQUAL(doc->contentHash(), hashBefore);
+        REQUIRE_NOT_EQUAL(doc->valueOrThrow(u8"server")->contentHash(), sectionHashBefore);
+        otherDoc = parse("[server]\nport: 8080\n");
+        REQUIRE_EQUAL(doc->contentHash(), otherDoc->contentHash());
+    }
+
+    void testValidationKeepsOtherDocuments() {
+        using impl::ValueTreeGeneration;
+        doc = parse("[server]\n");
+        otherDoc = parse("[server]\nport: 8080\n");
+        const auto otherHash = otherDoc->contentHash();
+        const auto docGeneration = ValueTreeGeneration::currentFor(*doc);
+        const auto otherGeneration = ValueTreeGeneration::currentFor(*otherDoc);
+        REQUIRE_NOT_EQUAL(docGeneration, otherGeneration);
+        // All values in a tree share the generation of their document.
+        REQUIRE_EQUAL(ValueTreeGeneration::currentFor(*doc->valueOrThrow(u8"server")), docGeneration);
+        const auto rules = vr::Rules::createFromDocument(parse(
+            "[server]\n"
+            "type: \"section\"\n"
+            "[server.port]\n"
+            "type: \"integer\"\n"
+            "default: 8080\n"));
+        REQUIRE_NOTHROW(rules->validate(doc, 1));
+        REQUIRE_NOT_EQUAL(ValueTreeGeneration::currentFor(*doc), docGeneration);
+        REQUIRE_EQUAL(
+            ValueTreeGeneration::currentFor(*doc->valueOrThrow(u8"server.port")),
+            ValueTreeGeneration::currentFor(*doc));
+        // Validating one document does not discard the caches of other documents.
+        REQUIRE_EQUAL(ValueTreeGeneration::currentFor(*otherDoc), otherGeneration);
+        REQUIRE_EQUAL(otherDoc->contentHash(), otherHash);
+        REQUIRE_EQUAL(doc->contentHash(), otherHash);
+    }
+
+    void testConcurrentAccess() {
+        std::string text;
+        for (int i = 0; i < 100; ++i) {
+            text += std::format("[section_{}]\nvalue: {}\ntext: \"text {}\"\n", i, i, i);
+        }
+        doc = parse(text);
+        otherDoc = parse(text);
+        const auto expected = otherDoc->contentHash();
+        std::vector<uint64_t> results(4);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            threads.emplace_back([&, i]() { results[i] = doc->contentHash(); });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        for (const auto result : results) {
+            REQUIRE_EQUAL(result, expected);
+        }
+    }
+};
+
@@ -0,0 +1,182 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "ValueTestHelper.hpp"
+
+#include <erbsland/conf/ValueHandle.hpp>
+#include <erbsland/conf/vr/Rules.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+TESTED_TARGETS(ValueHandle Value)
+class ValueHandleTest final : public UNITTEST_SUBCLASS(ValueTestHelper) {
+public:
+    void parseDocument(const std::string &text) {
+        Parser parser;
+        REQUIRE_NOTHROW(doc = parser.parseOrThrow(Source::fromString(String{text})));
+        REQUIRE(doc != nullptr);
+    }
+
+    void setUp() override {
+        parseDocument(
+            "[server]\n"
+            "name: \"example\"\n"
+            "[server.pool]\n"
+            "size: 12\n"
+            "factor: 1.5\n");
+    }
+
+    void tearDown() override {
+        doc = {};
+    }
+
+    void testConstruction() {
+        const auto handle = ValueHandle{u8"server.pool.size"};
+        REQUIRE_EQUAL(handle.namePath(), NamePath::fromText(u8"server.pool.size"));
+        REQUIRE_EQUAL(ValueHandle{Name::createRegular(u8"server")}.namePath().size(), 1U);
+        REQUIRE_EQUAL(ValueHandle{std::size_t{0}}.namePath().size(), 1U);
+        try {
+            const auto invalid = ValueHandle{u8"server..size"};
+            REQUIRE(false);
+        } catch (const Error &error) {
+            REQUIRE_EQUAL(error.category(), ErrorCategory::Syntax);
+        }
+    }
+
+    void testResolveAndCache() {
+        const auto handle = ValueHandle{u8"server.pool.size"};
+        const auto first = doc->value(handle);
+        REQUIRE(first != nullptr);
+        REQUIRE_EQUAL(first->asInteger(), 12);
+        // The second lookup returns the same value instance.
+        const auto second = doc->value(handle);
+        REQUIRE(first == second);
+        REQUIRE(handle.resolve(*doc) == first);
+        // A different base value resolves the path relative to the new base.
+        const auto server = doc->valueOrThrow(u8"server");
+        REQUIRE(server->value(handle) == nullptr);
+        const auto relative = ValueHandle{u8"pool.size"};
+        REQUIRE(server->value(relative) == first);
+        REQUIRE(doc->value(relative) == nullptr);
+        REQUIRE(server->value(relative) == first);
+    }
+
+    void testMissingValue() {
+        const auto handle = ValueHandle{u8"server.pool.missing"};
+        REQUIRE(doc->value(handle) == nullptr);
+        REQUIRE(doc->value(handle) == nullptr);
+        try {
+            static_cast<void>(doc->valueOrThrow(handle));
+            REQUIRE(false);
+        } catch (const Error &error) {
+            REQUIRE_EQUAL(error.category(), ErrorCategory::ValueNotFound);
+            REQUIRE_EQUAL(error.namePath(), NamePath::fromText(u8"server.pool.missing"));
+        }
+    }
+
+    void testNewDocument() {
+        auto handle = ValueHandle{u8"server.pool.size"};
+        REQUIRE_EQUAL(doc->get<int>(handle), 12);
+        parseDocument(
+            "[server.pool]\n"
+            "size: 99\n");
+        REQUIRE_EQUAL(doc->get<int>(handle), 99);
+        handle.reset();
+        REQUIRE_EQUAL(doc->get<int>(handle), 99);
+    }
+
+    void testConcurrentUse() {
+        // One shared handle, used from several threads with alternating base values.
+        const auto handle = ValueHandle{u8"pool.size"};
+        const auto server = doc->valueOrThrow(u8"server");
+        const auto pool = doc->valueOrThrow(u8"server.pool");
+        const auto expected = doc->valueOrThrow(u8"server.pool.size");
+        std::atomic<int> failureCount{0};
+        std::vector<std::thread> threads;
+        for (int threadIndex = 0; threadIndex < 8; ++threadIndex) {
+            threads.emplace_back([&, threadIndex]() -> void {
+                for (int i = 0; i < 2000; ++i) {
+                    if ((i + threadIndex) % 3 == 0) {
+                        if (pool->value(handle) != nullptr) {
+                            failureCount.fetch_add(1);
+                        }
+                    } else if (server->value(handle) != expected) {
+                        failureCount.fetch_add(1);
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        REQUIRE_EQUAL(failureCount.load(), 0);
+        // Copies keep the cached value of the original handle.
+        const auto copy = handle;
+        REQUIRE(copy.resolve(*server) == expected);
+        auto moved = ValueHandle{u8"server"};
+        moved = ValueHandle{handle};
+        REQUIRE(moved.resolve(*server) == expected);
+    }
+
+    void testGet() {
+        const auto size = ValueHandle{u8"server.pool.size"};
+        const auto factor = ValueHandle{u8"server.pool.factor"};
+        const auto name = ValueHandle{u8"server.name"};
+        const auto missing = ValueHandle{u8"server.missing"};
+        REQUIRE_EQUAL(doc->get<Integer>(size), 12);
+        REQUIRE_EQUAL(doc->get<int>(size, 5), 12);
+        REQUIRE_EQUAL(doc->get<uint8_t>(size, 5), 12);
+        REQUIRE_EQUAL(doc->get<double>(factor), 1.5);
+        REQUIRE_EQUAL(doc->get<String>(name), String{u8"example"});
+        REQUIRE_EQUAL(doc->get<std::string>(name), std::string{"example"});
+        REQUIRE_EQUAL(doc->get<int>(missing, 8), 8);
+        REQUIRE_EQUAL(doc->get<String>(missing, u8"default"), String{u8"default"});
+        // A type mismatch returns the default value.
+        REQUIRE_EQUAL(doc->get<int>(name, 8), 8);
+        REQUIRE_EQUAL(doc->get<bool>(size, true), true);
+        REQUIRE_EQUAL(doc->get<String>(size, u8"default"), String{u8"default"});
+    }
+
+    void testGetOrThrow() {
+        const auto size = ValueHandle{u8"server.pool.size"};
+        const auto name = ValueHandle{u8"server.name"};
+        const auto missing = ValueHandle{u8"server.missing"};
+        REQUIRE_EQUAL(doc->getOrThrow<int>(size), 12);
+        REQUIRE_EQUAL(doc->getOrThrow<String>(name), String{u8"example"});
+        try {
+            static_cast<void>(doc->getOrThrow<int>(missing));
+            REQUIRE(false);
+        } catch (const Error &error) {
+            REQUIRE_EQUAL(error.category(), ErrorCategory::ValueNotFound);
+        }
+        try {
+            static_cast<void>(doc->getOrThrow<int>(name));
+            REQUIRE(false);
+        } catch (const Error &error) {
+            REQUIRE_EQUAL(error.category(), ErrorCategory::TypeMismatch);
+            REQUIRE_EQUAL(error.namePath(), NamePath::fromText(u8"server.name"));
+        }
+    }
+
+    void testValidationAddsDefaults() {
+        parseDocument("[server]\n");
+        const auto port = ValueHandle{u8"server.port"};
+        REQUIRE(doc->value(port) == nullptr);
+        Parser parser;
+        const auto rulesDocument = parser.parseOrThrow(Source::fromString(String{
+            u8"[server]\n"
+            u8"type: \"section\"\n"
+            u8"[server.port]\n"
+            u8"type: \"integer\"\n"
+            u8"default: 8080\n"}));
+        const auto rules = vr::Rules::createFromDocument(rulesDocument);
+        REQUIRE_NOTHROW(rules->validate(doc, 1));
+        // The validation added a default value, which must not be hidden by the cached missing value.
+        REQUIRE_EQUAL(doc->get<int>(port), 8080);
+    }
+};
+
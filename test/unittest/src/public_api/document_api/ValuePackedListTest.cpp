@@ -0,0 +1,199 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "ValueTestHelper.hpp"
+
+#include <thread>
+
+
+TESTED_TARGETS(Value ListView MatrixView)
+class ValuePackedListTest final : public UNITTEST_SUBCLASS(ValueTestHelper) {
+public:
+    static auto parse(const std::string &text) -> DocumentPtr {
+        Parser parser;
+        return parser.parseOrThrow(Source::fromString(String{text}));
+    }
+
+    template<typename T>
+    void requireMatrix(const MatrixView<T> &view, const std::vector<std::vector<T>> &expected) {
+        REQUIRE_EQUAL(view.rowCount(), expected.size());
+        std::size_t columnCount = 0;
+        for (std::size_t row = 0; row < expected.size(); ++row) {
+            REQUIRE_EQUAL(view.actualColumnCount(row), expected[row].size());
+            REQUIRE(std::ranges::equal(view.row(row), expected[row]));
+            for (std::size_t column = 0; column < expected[row].size(); ++column) {
+                REQUIRE(view.isDefined(row, column));
+                REQUIRE_EQUAL(view.value(row, column), expected[row][column]);
+            }
+            REQUIRE_FALSE(view.isDefined(row, expected[row].size()));
+            columnCount = std::max(columnCount, expected[row].size());
+        }
+        REQUIRE_EQUAL(view.columnCount(), columnCount);
+        REQUIRE(view.row(expected.size()).empty());
+        // The view has the same layout as the converted matrix.
+        const auto matrix = view.toMatrix();
+        REQUIRE_EQUAL(matrix.rowCount(), view.rowCount());
+        REQUIRE_EQUAL(matrix.columnCount(), view.columnCount());
+        for (std::size_t row = 0; row < expected.size(); ++row) {
+            REQUIRE_EQUAL(matrix.actualColumnCount(row), view.actualColumnCount(row));
+        }
+    }
+
+    TESTED_TARGETS(asSpan asSpanOrThrow)
+    void testIntegerList() {
+        doc = parse(
+            "[main]\n"
+            "list: 1, -2, 3, 0x10\n");
+        value = doc->valueOrThrow(u8"main.list");
+        const auto view = value->asSpanOrThrow<Integer>();
+        REQUIRE(view.isBorrowed());
+        REQUIRE(view.toVector() == std::vector<Integer>({1, -2, 3, 16}));
+        REQUIRE(view.toVector() == value->asListOrThrow<Integer>());
+        // The view points to the storage of the list.
+        REQUIRE(value->asSpanOrThrow<Integer>().data() == view.data());
+        // Copies of borrowed views borrow the same data.
+        const auto copy = view;
+        REQUIRE(copy.isBorrowed());
+        REQUIRE(copy.data() == view.data());
+        // A list with another type.
+        REQUIRE_THROWS_AS(Error, [[maybe_unused]] auto unused = value->asSpanOrThrow<Float>());
+        REQUIRE(value->asSpan<Float>().empty());
+    }
+
+    TESTED_TARGETS(asSpan asSpanOrThrow)
+    void testFloatList() {
+        doc = parse(
+            "[main]\n"
+            "list: 1.5, -2.0, 3e2\n");
+        value = doc->valueOrThrow(u8"main.list");
+        const auto view = value->asSpan<Float>();
+        REQUIRE(view.isBorrowed());
+        REQUIRE_EQUAL(view.size(), 3);
+        REQUIRE_EQUAL(view[0], 1.5);
+        REQUIRE_EQUAL(view[1], -2.0);
+        REQUIRE_EQUAL(view[2], 300.0);
+        Float sum = 0.0;
+        for (const auto element : view) {
+            sum += element;
+        }
+        REQUIRE_EQUAL(sum, 299.5);
+        REQUIRE(value->asSpan<Integer>().empty());
+    }
+
+    TESTED_TARGETS(asSpan asSpanOrThrow)
+    void testConversions() {
+        doc = parse(
+            "[main]\n"
+            "single: 42\n"
+            "mixed: 1, 2.0, 3\n"
+            "text: \"text\"\n"
+            "matrix:\n"
+            "    * 1, 2\n"
+            "    * 3, 4\n");
+        // A single value is converted into a list with one element.
+        auto view = doc->valueOrThrow(u8"main.single")->asSpanOrThrow<Integer>();
+        REQUIRE_FALSE(view.isBorrowed());
+        REQUIRE(view.toVector() == std::vector<Integer>({42}));
+        // Moving an owning view keeps the values valid.
+        const auto movedView = std::move(view);
+        REQUIRE_FALSE(movedView.isBorrowed());
+        REQUIRE(movedView.toVector() == std::vector<Integer>({42}));
+        // Mixed lists are not packed, and fail with the same error as `asList()`.
+        value = doc->valueOrThrow(u8"main.mixed");
+        REQUIRE(value->packedValues() != nullptr);
+        REQUIRE_FALSE(value->packedValues()->isPacked<Integer>());
+        REQUIRE_FALSE(value->packedValues()->isPacked<Float>());
+        try {
+            [[maybe_unused]] auto unused = value->asSpanOrThrow<Integer>();
+            REQUIRE(false);
+        } catch (const Error &error) {
+            REQUIRE_EQUAL(error.category(), ErrorCategory::TypeMismatch);
+        }
+        REQUIRE(value->asSpan<Integer>().empty());
+        REQUIRE(doc->valueOrThrow(u8"main.text")->asSpan<Integer>().empty());
+        REQUIRE(doc->valueOrThrow(u8"main.matrix")->asSpan<Integer>().empty());
+        REQUIRE(doc->asSpan<Integer>().empty());
+        REQUIRE(doc->packedValues() == nullptr);
+    }
+
+    TESTED_TARGETS(asMatrixView asMatrixViewOrThrow)
+    void testMatrix() {
+        doc = parse(
+            "[main]\n"
+            "matrix:\n"
+            "    * 1, 2, 3\n"
+            "    * 4\n"
+            "    * 5, 6\n"
+            "float_matrix:\n"
+            "    * 1.0, 2.5\n"
+            "    * 3.5, 4.0\n"
+            "list: 7, 8, 9\n"
+            "single: 10\n"
+            "mixed_matrix:\n"
+            "    * 1, 2\n"
+            "    * 3.0, 4.0\n");
+        auto view = doc->valueOrThrow(u8"main.matrix")->asMatrixViewOrThrow<Integer>();
+        REQUIRE(view.isBorrowed());
+        WITH_CONTEXT(requireMatrix<Integer>(view, {{1, 2, 3}, {4}, {5, 6}}));
+        REQUIRE_EQUAL(view.value(1, 2, -1), -1);
+        auto floatView = doc->valueOrThrow(u8"main.float_matrix")->asMatrixView<Float>();
+        REQUIRE(floatView.isBorrowed());
+        WITH_CONTEXT(requireMatrix<Float>(floatView, {{1.0, 2.5}, {3.5, 4.0}}));
+        // A regular list is a matrix with one column.
+        view = doc->valueOrThrow(u8"main.list")->asMatrixViewOrThrow<Integer>();
+        REQUIRE(view.isBorrowed());
+        WITH_CONTEXT(requireMatrix<Integer>(view, {{7}, {8}, {9}}));
+        // A single value is converted into a matrix with one cell.
+        view = doc->valueOrThrow(u8"main.single")->asMatrixViewOrThrow<Integer>();
+        REQUIRE_FALSE(view.isBorrowed());
+        WITH_CONTEXT(requireMatrix<Integer>(view, {{10}}));
+        // Mixed types.
+        value = doc->valueOrThrow(u8"main.mixed_matrix");
+        REQUIRE_THROWS_AS(Error, [[maybe_unused]] auto unused = value->asMatrixViewOrThrow<Integer>());
+        REQUIRE_EQUAL(value->asMatrixView<Float>().rowCount(), 0);
+        REQUIRE_EQUAL(doc->asMatrixView<Integer>().rowCount(), 0);
+    }
+
+    TESTED_TARGETS(asMatrixView asMatrixViewOrThrow)
+    void testMixedRowsMatrix() {
+        doc = parse(
+            "[main]\n"
+            "matrix:\n"
+            "    * 1\n"
+            "    * 2, 3\n");
+        const auto view = doc->valueOrThrow(u8"main.matrix")->asMatrixViewOrThrow<Integer>();
+        REQUIRE(view.isBorrowed());
+        WITH_CONTEXT(requireMatrix<Integer>(view, {{1}, {2, 3}}));
+        REQUIRE(std::ranges::equal(view.values(), std::vector<Integer>{1, 2, 3}));
+    }
+
+    TESTED_TARGETS(asSpan asMatrixView)
+    void testConcurrentFirstAccess() {
+        doc = parse(
+            "[main]\n"
+            "matrix:\n"
+            "    * 1, 2, 3\n"
+            "    * 4, 5, 6\n");
+        value = doc->valueOrThrow(u8"main.matrix");
+        // The values are packed on the first access, which can happen from multiple threads at the same time.
+        std::vector<const Integer*> results(8);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            threads.emplace_back([&, i]() {
+                const auto view = value->asMatrixView<Integer>();
+                results[i] = view.isBorrowed() ? view.row(1).data() : nullptr;
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        for (const auto result : results) {
+            REQUIRE(result != nullptr);
+            REQUIRE(result == value->asMatrixView<Integer>().row(1).data());
+            REQUIRE_EQUAL(*result, 4);
+        }
+        REQUIRE(doc->valueOrThrow(u8"main.matrix[1]")->asSpan<Integer>().toVector() == std::vector<Integer>({4, 5, 6}));
+    }
+};
+
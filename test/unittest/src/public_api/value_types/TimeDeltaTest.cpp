@@ -8,6 +8,8 @@
 
 #include <stdexcept>
 #include <cmath>
+#include <type_traits>
+#include <vector>
 
 
 using namespace erbsland::conf;
@@ -338,5 +340,34 @@ public:
         double expectedSeconds = 315576000.0 + 315360000.0 + 3600.0;
         REQUIRE(std::abs(delta.toSeconds() - expectedSeconds) < 1e-3);
     }
+
+    void testDefinedUnits() {
+        TimeDelta delta;
+        REQUIRE(delta.empty());
+        REQUIRE(delta.isZero());
+        REQUIRE(delta.units().empty());
+        // Units with a zero count are still defined.
+        delta.setHours(0);
+        REQUIRE_FALSE(delta.empty());
+        REQUIRE(delta.isZero());
+        REQUIRE_FALSE(delta.hasMultipleCounts());
+        REQUIRE(delta.units() == std::vector<TimeUnit>{TimeUnit::Hours});
+        // Units are always returned in ascending order.
+        delta.setYears(2);
+        delta.setNanoseconds(5);
+        delta.setHours(3);
+        REQUIRE(delta.hasMultipleCounts());
+        REQUIRE(delta.units() == std::vector<TimeUnit>({TimeUnit::Nanoseconds, TimeUnit::Hours, TimeUnit::Years}));
+        REQUIRE(delta.count(TimeUnit::Hours) == 3);
+        // Copies keep the defined units.
+        const TimeDelta copy = delta;
+        REQUIRE(copy.units() == delta.units());
+        REQUIRE(copy == delta);
+        // Arithmetic results only define units with a non-zero count.
+        const auto sum = delta + TimeDelta{TimeUnit::Hours, -3};
+        REQUIRE(sum.units() == std::vector<TimeUnit>({TimeUnit::Nanoseconds, TimeUnit::Years}));
+        // The counts are stored inline.
+        static_assert(std::is_trivially_copyable_v<TimeDelta>);
+    }
 };
 
@@ -0,0 +1,197 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "TestHelper.hpp"
+
+#include <erbsland/conf/impl/char/CharStream.hpp>
+#include <erbsland/conf/impl/constants/Limits.hpp>
+#include <erbsland/conf/impl/source/MappedFileSource.hpp>
+#include <erbsland/conf/Error.hpp>
+#include <erbsland/conf/Parser.hpp>
+#include <erbsland/conf/Source.hpp>
+
+
+using namespace el::conf;
+using namespace std::filesystem;
+
+
+TESTED_TARGETS(MappedFileSource)
+class MappedFileSourceTest final : public UNITTEST_SUBCLASS(TestHelper) {
+public:
+    SourcePtr source{}; ///< The current source.
+    std::array<std::byte, limits::maxLineLength> lineBuffer{}; ///< The line buffer to read back the lines.
+    std::size_t lineLength{0}; ///< The reported line length.
+
+    void tearDown() override {
+        source.reset();
+        cleanUpTestFileDirectory();
+    }
+
+    void testConstruction() {
+        auto filePath = createTestFile("[main]");
+        source = Source::fromMappedFile(filePath);
+        REQUIRE(source != nullptr);
+        REQUIRE(dynamic_cast<impl::MappedFileSource*>(source.get()) != nullptr);
+        REQUIRE_EQUAL(source->name(), String{u8"file"});
+        REQUIRE_EQUAL(source->path(), String{filePath.string()});
+        REQUIRE_EQUAL(source->identifier()->toText(), Source::fromFile(filePath)->identifier()->toText());
+        REQUIRE(source->supportsLineViews());
+        REQUIRE_FALSE(source->isOpen());
+        REQUIRE_FALSE(source->atEnd());
+        source = Source::fromMappedFile(String{filePath.string()});
+        REQUIRE_EQUAL(source->path(), String{filePath.string()});
+    }
+
+    void testConstructionWithInvalidPath() {
+        REQUIRE_NOTHROW(source = Source::fromMappedFile(path("/this/path/does/not/exist")));
+        try {
+            source->open();
+            REQUIRE(false);
+        } catch (const Error &error) {
+            REQUIRE_EQUAL(error.category(), ErrorCategory::IO);
+        }
+        REQUIRE_FALSE(source->isOpen());
+    }
+
+    void testEmptyFile() {
+        auto filePath = createTestFile(String{});
+        source = Source::fromMappedFile(filePath);
+        REQUIRE_NOTHROW(source->open());
+        REQUIRE(source->isOpen());
+        REQUIRE(source->readLineView().empty());
+        REQUIRE(source->atEnd());
+        REQUIRE_EQUAL(source->readLine(lineBuffer), 0);
+    }
+
+    void requireExactLineViews(const FileLines &lines) {
+        auto filePath = createTestFile(lines);
+        source = Source::fromMappedFile(filePath);
+        REQUIRE_NOTHROW(source->open());
+        std::vector<std::span<const std::byte>> views;
+        for (const auto &line : lines) {
+            if (line.size() > limits::maxLineLength) {
+                REQUIRE_THROWS_AS(Error, source->readLineView());
+                REQUIRE_FALSE(source->isOpen());
+                return;
+            }
+            const auto view = source->readLineView();
+            REQUIRE_EQUAL(view.size(), line.size());
+            REQUIRE(std::ranges::equal(view, line));
+            views.push_back(view);
+        }
+        REQUIRE(source->atEnd());
+        REQUIRE(source->readLineView().empty());
+        // All views must stay valid until the source is closed.
+        for (std::size_t i = 0; i < views.size(); ++i) {
+            REQUIRE(std::ranges::equal(views[i], lines[i]));
+        }
+        source->close();
+        REQUIRE_FALSE(source->isOpen());
+    }
+
+    void testLineViews() {
+        const auto lineLengths = std::vector<std::size_t>{
+            1, 2, 3, 100, 0, 200, 2, 5, 600, 600, 500, 1000, 1023, 0, 0,
+            limits::maxLineLength - 1, limits::maxLineLength - 2, 1, 100, 500, 3049};
+        WITH_CONTEXT(requireExactLineViews(generateLines(lineLengths, LineBreak::LF, LineBreak::None)));
+        WITH_CONTEXT(requireExactLineViews(generateLines(lineLengths, LineBreak::LF, LineBreak::LF)));
+        WITH_CONTEXT(requireExactLineViews(generateLines(lineLengths, LineBreak::CRLF, LineBreak::CRLF)));
+        WITH_CONTEXT(requireExactLineViews(generateLines({limits::maxLineLength}, LineBreak::LF, LineBreak::None)));
+    }
+
+    void testLineLengthExceeded() {
+        WITH_CONTEXT(requireExactLineViews(generateLines({10, limits::maxLineLength}, LineBreak::LF, LineBreak::LF)));
+        WITH_CONTEXT(requireExactLineViews(generateLines({limits::maxLineLength + 1}, LineBreak::LF, LineBreak::None)));
+        WITH_CONTEXT(requireExactLineViews(generateLines({limits::maxLineLength * 3}, LineBreak::LF, LineBreak::LF)));
+    }
+
+    void testReadLineCopiesTheLines() {
+        const auto lines = generateLines({10, 0, 2000, 5}, LineBreak::CRLF, LineBreak::None);
+        auto filePath = createTestFile(lines);
+        source = Source::fromMappedFile(filePath);
+        REQUIRE_NOTHROW(source->open());
+        for (const auto &line : lines) {
+            lineLength = source->readLine(lineBuffer);
+            REQUIRE_EQUAL(lineLength, line.size());
+            REQUIRE(std::equal(line.begin(), line.end(), lineBuffer.begin()));
+        }
+        REQUIRE(source->atEnd());
+        std::array<std::byte, 100> smallBuffer{};
+        source = Source::fromMappedFile(filePath);
+        REQUIRE_NOTHROW(source->open());
+        REQUIRE_THROWS_AS(Error, lineLength = source->readLine(smallBuffer));
+    }
+
+    void testReadFromClosedSource() {
+        auto filePath = createTestFile("[main]\nline1: 12");
+        source = Source::fromMappedFile(filePath);
+        REQUIRE_THROWS_AS(Error, source->readLineView());
+        REQUIRE_NOTHROW(source->open());
+        REQUIRE_THROWS_AS(Error, source->open());
+        REQUIRE_NOTHROW(source->readLineView());
+        source->close();
+        REQUIRE_THROWS_AS(Error, source->readLineView());
+    }
+
+    void testReopenAfterEnd() {
+        auto filePath = createTestFile("[main]\nline1: 12");
+        source = Source::fromMappedFile(filePath);
+        REQUIRE_NOTHROW(source->open());
+        REQUIRE_EQUAL(source->readLineView().size(), 7);
+        REQUIRE_EQUAL(source->readLineView().size(), 9);
+        REQUIRE(source->atEnd());
+        source->close();
+        // A closed source reports that it is not open, even if it was read to the end.
+        REQUIRE_THROWS_AS(Error, source->readLineView());
+        // After opening the source again, the file is read from the start.
+        REQUIRE_NOTHROW(source->open());
+        REQUIRE_FALSE(source->atEnd());
+        REQUIRE_EQUAL(source->readLineView().size(), 7);
+        REQUIRE_EQUAL(source->readLineView().size(), 9);
+        REQUIRE(source->atEnd());
+    }
+
+    void testStreamSourceHasNoLineViews() {
+        auto filePath = createTestFile("[main]\n");
+        source = Source::fromFile(filePath);
+        REQUIRE_FALSE(source->supportsLineViews());
+        REQUIRE_NOTHROW(source->open());
+        REQUIRE_THROWS_AS(Error, source->readLineView());
+    }
+
+    void testSameDocumentAsFileSource() {
+        auto filePath = createTestFile(
+            u8"\xEF\xBB\xBF# Comment\n"
+            u8"[main]\n"
+            u8"value: 123\r\n"
+            u8"text: \"→ Unicode ←\"\n"
+            u8"multi line: \"\"\"\n"
+            u8"    first line\n"
+            u8"    second line\n"
+            u8"    \"\"\"\n"
+            u8"[main.sub]\n"
+            u8"bytes: <01 02 ab cd>\n"
+            u8"list: 1, 2, 3");
+        Parser parser;
+        const auto expected = parser.parseOrThrow(Source::fromFile(filePath));
+        const auto actual = parser.parseOrThrow(Source::fromMappedFile(filePath));
+        REQUIRE_EQUAL(actual->toTestValueTree(), expected->toTestValueTree());
+        REQUIRE_EQUAL(actual->getTextOrThrow(u8"main.text"), String{u8"→ Unicode ←"});
+    }
+
+    void testSameDigestAsFileSource() {
+        auto filePath = createTestFile(
+            "@signature \"...\"\n[main]\nvalue: 123\nanother value: \"example\"\n");
+        auto calculateDigest = [](const SourcePtr &source) -> Bytes {
+            source->open();
+            const auto charStream = impl::CharStream::create(source);
+            while (charStream->next() != impl::Char::EndOfData) {}
+            return charStream->digest();
+        };
+        const auto expected = calculateDigest(Source::fromFile(filePath));
+        REQUIRE_FALSE(expected.empty());
+        REQUIRE_EQUAL(calculateDigest(Source::fromMappedFile(filePath)), expected);
+    }
+};
+
@@ -0,0 +1,70 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+#include <erbsland/conf/impl/utilities/WorkerPool.hpp>
+#include <erbsland/unittest/UnitTest.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace erbsland::conf::impl;
+
+
+TESTED_TARGETS(WorkerPool)
+class WorkerPoolTest final : public el::UnitTest {
+public:
+    void testRunTasks() {
+        WorkerPool pool{4};
+        REQUIRE_EQUAL(pool.threadCount(), 4U);
+        std::atomic<int> counter{0};
+        std::vector<std::future<void>> futures;
+        for (int i = 0; i < 100; ++i) {
+            futures.emplace_back(pool.submit([&counter]() -> void { counter.fetch_add(1); }));
+        }
+        for (auto &future : futures) {
+            future.get();
+        }
+        REQUIRE_EQUAL(counter.load(), 100);
+    }
+
+    void testAtLeastOneThread() {
+        WorkerPool pool{0};
+        REQUIRE_EQUAL(pool.threadCount(), 1U);
+        auto future = pool.submit([]() -> void {});
+        REQUIRE_NOTHROW(future.get());
+    }
+
+    void testExceptionInTask() {
+        WorkerPool pool{2};
+        auto future = pool.submit([]() -> void { throw std::runtime_error{"error"}; });
+        REQUIRE_THROWS_AS(std::runtime_error, future.get());
+        // The pool keeps working after an exception.
+        auto nextFuture = pool.submit([]() -> void {});
+        REQUIRE_NOTHROW(nextFuture.get());
+    }
+
+    void testStop() {
+        WorkerPool pool{1};
+        std::promise<void> started;
+        std::promise<void> release;
+        auto releaseFuture = release.get_future().share();
+        auto blockingFuture = pool.submit([&started, releaseFuture]() -> void {
+            started.set_value();
+            releaseFuture.wait();
+        });
+        auto queuedFuture = pool.submit([]() -> void {});
+        // A running task is completed by `stop()`.
+        started.get_future().wait();
+        release.set_value();
+        pool.stop();
+        REQUIRE_NOTHROW(blockingFuture.get());
+        REQUIRE_THROWS_AS(std::logic_error, pool.submit([]() -> void {}));
+        // The queued task either ran before the stop, or it was discarded.
+        try {
+            queuedFuture.get();
+        } catch (const std::future_error &error) {
+            REQUIRE(error.code() == std::future_errc::broken_promise);
+        }
+    }
+};
+
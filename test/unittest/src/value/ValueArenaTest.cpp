@@ -0,0 +1,97 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <erbsland/conf/impl/parser/Parser.hpp>
+#include <erbsland/conf/impl/value/DocumentBuilder.hpp>
+#include <erbsland/conf/impl/value/ValueArena.hpp>
+#include <erbsland/conf/impl/value/ValueWithNativeType.hpp>
+#include <erbsland/conf/Parser.hpp>
+#include <erbsland/unittest/UnitTest.hpp>
+
+
+using namespace el::conf;
+using impl::DocumentBuilder;
+using impl::ValueArena;
+
+
+TESTED_TARGETS(ValueArena DocumentBuilder Parser)
+class ValueArenaTest final : public el::UnitTest {
+public:
+    void testMakeShared() {
+        auto heapValue = ValueArena::makeShared<impl::IntegerValue>(nullptr, 12);
+        REQUIRE(heapValue != nullptr);
+        REQUIRE_EQUAL(heapValue->asInteger(), 12);
+
+        auto arena = ValueArena::create();
+        REQUIRE_EQUAL(arena->allocatedBytes(), 0);
+        auto value = impl::Value::createInteger(34, arena);
+        REQUIRE_EQUAL(value->asInteger(), 34);
+        const auto bytesAfterFirstValue = arena->allocatedBytes();
+        REQUIRE(bytesAfterFirstValue >= sizeof(impl::IntegerValue));
+        REQUIRE_EQUAL(arena.use_count(), 2);
+        auto text = impl::Value::createText(String{u8"text"}, arena);
+        REQUIRE(arena->allocatedBytes() > bytesAfterFirstValue);
+        REQUIRE_EQUAL(arena.use_count(), 3);
+        value.reset();
+        text.reset();
+        REQUIRE_EQUAL(arena.use_count(), 1);
+    }
+
+    void testValuesOutliveDocument() {
+        std::weak_ptr<ValueArena> weakArena;
+        ValuePtr value;
+        {
+            DocumentBuilder builder;
+            auto arena = ValueArena::create();
+            weakArena = arena;
+            builder.setValueArena(std::move(arena));
+            builder.addSectionMap(NamePath::fromText(u8"main"));
+            builder.addValueT(NamePath::fromText(u8"value"), 42);
+            builder.addSectionList(NamePath::fromText(u8"list"));
+            builder.addValueT(NamePath::fromText(u8"text"), String{u8"example"});
+            auto document = builder.getDocumentAndReset();
+            REQUIRE_FALSE(weakArena.expired());
+            value = document->value(u8"main.value");
+            REQUIRE(value != nullptr);
+            REQUIRE_EQUAL(document->getTextOrThrow(u8"list[0].text"), String{u8"example"});
+        }
+        // The value keeps the arena alive.
+        REQUIRE_FALSE(weakArena.expired());
+        REQUIRE_EQUAL(value->asInteger(), 42);
+        value.reset();
+        REQUIRE(weakArena.expired());
+    }
+
+    void testParserWithArena() {
+        const auto content = String{
+            u8"[main]\n"
+            u8"value: 123\n"
+            u8"list: 1, 2, 3\n"
+            u8"[main.sub.section]\n"
+            u8"text: \"example\"\n"
+            u8"*[items]\n"
+            u8"bytes: <01 02 03>\n"
+            u8"*[items]\n"
+            u8"values:\n"
+            u8"    * 1, 2\n"
+            u8"    * 3, 4\n"};
+        const auto parseTree = [&](const bool arenaAllocation) -> String {
+            impl::ParserSettings settings;
+            settings.arenaAllocation = arenaAllocation;
+            impl::Parser parser{Source::fromString(content), settings};
+            return parser.parse()->toTestValueTree();
+        };
+        const auto arenaTree = parseTree(true);
+        REQUIRE_FALSE(arenaTree.empty());
+        REQUIRE_EQUAL(arenaTree, parseTree(false));
+
+        Parser parser;
+        parser.setArenaAllocation(true);
+        auto document = parser.parseOrThrow(Source::fromString(content));
+        REQUIRE_EQUAL(document->getIntegerOrThrow(u8"main.value"), 123);
+        REQUIRE_EQUAL(document->getTextOrThrow(u8"main.sub.section.text"), String{u8"example"});
+        REQUIRE_EQUAL(document->getSectionListOrThrow(u8"items")->size(), 2);
+    }
+};
+
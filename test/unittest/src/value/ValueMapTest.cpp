@@ -0,0 +1,103 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <erbsland/conf/impl/value/Value.hpp>
+#include <erbsland/conf/impl/value/ValueMap.hpp>
+#include <erbsland/unittest/UnitTest.hpp>
+
+#include <format>
+
+
+using namespace el::conf;
+using impl::ValueMap;
+
+
+TESTED_TARGETS(ValueMap)
+class ValueMapTest final : public el::UnitTest {
+public:
+    static auto nameForIndex(const std::size_t index) -> Name {
+        return Name::createRegular(String::fromCharString(std::format("value_{}", index)));
+    }
+
+    static auto createNamedValue(const std::size_t index) -> impl::ValuePtr {
+        auto value = impl::Value::createInteger(static_cast<Integer>(index));
+        value->setName(nameForIndex(index));
+        return value;
+    }
+
+    void requireAllValues(const ValueMap &map, const std::size_t count) {
+        REQUIRE_EQUAL(map.size(), count);
+        for (std::size_t index = 0; index < count; ++index) {
+            runWithContext(SOURCE_LOCATION(), [&]() {
+                const auto value = map.valueImpl(nameForIndex(index));
+                REQUIRE(value != nullptr);
+                REQUIRE_EQUAL(value->asInteger(), static_cast<Integer>(index));
+                REQUIRE(map.hasValueImpl(nameForIndex(index)));
+            }, [&]() -> std::string {
+                return std::format("index = {}", index);
+            });
+        }
+        REQUIRE(map.valueImpl(nameForIndex(count)) == nullptr);
+        REQUIRE_FALSE(map.hasValueImpl(nameForIndex(count)));
+        REQUIRE(map.valueImpl(Name::createText(String{u8"value_0"})) == nullptr);
+    }
+
+    void testSmallMap() {
+        ValueMap map;
+        REQUIRE(map.empty());
+        REQUIRE(map.valueImpl(nameForIndex(0)) == nullptr);
+        for (std::size_t index = 0; index < ValueMap::cLinearScanLimit; ++index) {
+            map.addValue(createNamedValue(index));
+        }
+        REQUIRE_FALSE(map.hasIndexTable());
+        requireAllValues(map, ValueMap::cLinearScanLimit);
+    }
+
+    void testPromotionToIndexTable() {
+        ValueMap map;
+        for (std::size_t index = 0; index < 1000; ++index) {
+            map.addValue(createNamedValue(index));
+            REQUIRE_EQUAL(map.hasIndexTable(), map.size() > ValueMap::cLinearScanLimit);
+        }
+        requireAllValues(map, 1000);
+        // The list keeps the order of the definition.
+        for (std::size_t index = 0; index < map.valueList().size(); ++index) {
+            REQUIRE_EQUAL(map.valueList()[index]->name(), nameForIndex(index));
+        }
+    }
+
+    void testRemoveDefaultValues() {
+        ValueMap map;
+        for (std::size_t index = 0; index < 40; ++index) {
+            auto value = createNamedValue(index);
+            if (index >= 10) {
+                value->markAsDefaultValue();
+            }
+            map.addValue(value);
+        }
+        REQUIRE(map.hasIndexTable());
+        map.removeDefaultValues();
+        REQUIRE_FALSE(map.hasIndexTable());
+        requireAllValues(map, 10);
+    }
+
+    void testIndexNames() {
+        ValueMap map{impl::ValueMap::List{
+            impl::Value::createInteger(10),
+            impl::Value::createInteger(11),
+            impl::Value::createInteger(12)}};
+        REQUIRE_EQUAL(map.size(), 3);
+        REQUIRE_EQUAL(map.valueImpl(Name::createIndex(1))->asInteger(), 11);
+        REQUIRE_EQUAL(map.valueImpl(std::size_t{2})->asInteger(), 12);
+        REQUIRE(map.valueImpl(Name::createIndex(3)) == nullptr);
+        // Text indexes are only resolved if allowed.
+        REQUIRE(map.valueImpl(Name::createTextIndex(0)) == nullptr);
+        map.setTextIndexesAllowed(true);
+        REQUIRE_EQUAL(map.valueImpl(Name::createTextIndex(0))->asInteger(), 10);
+        // Unnamed values get the next index as name.
+        map.addValue(impl::Value::createInteger(13));
+        REQUIRE_EQUAL(map.valueImpl(Name::createIndex(3))->asInteger(), 13);
+    }
+};
+
@@ -163,6 +163,33 @@ public:
         WITH_CONTEXT(requireError("The text contains a forbidden character at position 1: \"_\""));
     }
 
+    void testLongAsciiPrefixFollowedByUnicode() {
+        WITH_CONTEXT(requireOneConstraintPass("chars: \"letters\", \"[.-é]\"", vr::RuleType::Text));
+        WITH_CONTEXT(requirePassLines({
+            "[app]",
+            "x: \"host-name.example.domain.local\"",
+        }));
+        WITH_CONTEXT(requirePassLines({
+            "[app]",
+            "x: \"host-name.example.domain.café\"",
+        }));
+        WITH_CONTEXT(requireFailLines({
+            "[app]",
+            "x: \"host-name.example.domain.café_\"",
+        }));
+        WITH_CONTEXT(requireError("The text contains a forbidden character at position 29: \"_\""));
+        WITH_CONTEXT(requireFailLines({
+            "[app]",
+            "x: \"host-name.example.domain.local_\"",
+        }));
+        WITH_CONTEXT(requireError("The text contains a forbidden character at position 30: \"_\""));
+        WITH_CONTEXT(requireFailLines({
+            "[app]",
+            "x: \"host-name.example.domain.→\"",
+        }));
+        WITH_CONTEXT(requireError("The text contains a forbidden character at position 25: \"→\""));
+    }
+
     void testSecretValuesHideForbiddenCharacter() {
         WITH_CONTEXT(requireRulesPassLines({
             "[app.x]",
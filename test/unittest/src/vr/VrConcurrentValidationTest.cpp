@@ -0,0 +1,226 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "VrBase.hpp"
+
+#include <erbsland/conf/vr/ValidationReport.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+using namespace el::conf;
+
+
+// This test is meant to run with ThreadSanitizer, see `ERBSLAND_CONFIGURATION_ENABLE_TSAN`.
+TESTED_TARGETS(Rules DocumentValidator ValidationPlan) TAGS(ValidationRules)
+class VrConcurrentValidationTest final : public UNITTEST_SUBCLASS(VrBase) {
+public:
+    using ErrorTexts = std::vector<std::string>;
+
+    constexpr static std::size_t cDocumentCount = 200;
+    constexpr static std::size_t cThreadCount = 8;
+
+    void requireMixedRules() {
+        WITH_CONTEXT(requireRulesPassLines({
+            "[server.port]",
+            "type: \"integer\"",
+            "minimum: 1024",
+            "maximum: 0xffff",
+            "[server.name]",
+            "type: \"text\"",
+            "matches: /[a-z]+\\.local/",
+            "[server.mode]",
+            "type: \"text\"",
+            "in: \"fast\", \"safe\"",
+            "default: \"safe\"",
+            "[server.legacy]",
+            "type: \"boolean\"",
+            "maximum_version: 1",
+            "*[server.limit]*",
+            "type: \"integer\"",
+            "minimum: 1",
+            "*[server.limit]*",
+            "type: \"text\"",
+            "equals: \"unlimited\"",
+            "[server.tags]",
+            "type: \"ValueList\"",
+            "is_optional: yes",
+            "[server.tags.vr_entry]",
+            "type: \"text\"",
+            "minimum: 2",
+            "[client]",
+            "type: \"section_list\"",
+            "is_optional: yes",
+            "[client.vr_entry.name]",
+            "type: \"text\"",
+            "[client.vr_entry.user]",
+            "type: \"text\"",
+            "is_optional: yes",
+            "[client.vr_entry.password]",
+            "type: \"text\"",
+            "is_optional: yes",
+            "*[client.vr_entry.vr_dependency]*",
+            "mode: \"if\"",
+            "source: \"user\"",
+            "target: \"password\"",
+            "*[vr_key]*",
+            "key: \"client.vr_entry.name\"",
+        }));
+    }
+
+    /// Create a document text; documents with some indexes contain errors.
+    [[nodiscard]] static auto documentText(const std::size_t index) -> String {
+        std::string text = "[server]\n";
+        text += std::format("port: {}\n", index % 7 == 0 ? 80 : 8000 + index);
+        text += std::format("name: \"{}\"\n", index % 5 == 0 ? "EXAMPLE" : "host.local");
+        if (index % 3 == 0) {
+            text += std::format("mode: \"{}\"\n", index % 9 == 0 ? "slow" : "fast");
+        }
+        if (index % 4 != 0) {
+            text += "legacy: yes\n";
+        }
+        text += index % 2 == 0 ? "limit: \"unlimited\"\n" : std::format("limit: {}\n", index % 11);
+        text += std::format("tags: \"ab\", \"{}\"\n", index % 13 == 0 ? "x" : "cd");
+        for (std::size_t i = 0; i < index % 4; ++i) {
+            text += std::format("*[client]\nname: \"client{}\"\n", index % 6 == 0 ? 0 : i);
+            if (i % 2 == 1) {
+                text += "user: \"user\"\n";
+            }
+        }
+        return String{text};
+    }
+
+    [[nodiscard]] static auto parseDocuments() -> std::vector<DocumentPtr> {
+        std::vector<DocumentPtr> result;
+        result.reserve(cDocumentCount);
+        Parser parser;
+        for (std::size_t i = 0; i < cDocumentCount; ++i) {
+            result.emplace_back(parser.parseTextOrThrow(documentText(i)));
+        }
+        return result;
+    }
+
+    [[nodiscard]] static auto errorTexts(const vr::ValidationReport &report) -> ErrorTexts {
+        ErrorTexts result;
+        for (const auto &error : report.errors()) {
+            result.emplace_back(error.toText().toCharString());
+        }
+        return result;
+    }
+
+    /// Validate the documents one after the other, to get the expected results.
+    [[nodiscard]] auto expectedErrors(const Integer version) -> std::vector<ErrorTexts> {
+        std::vector<ErrorTexts> result;
+        for (const auto &document : parseDocuments()) {
+            result.emplace_back(errorTexts(rules->validateWithReport(document, version)));
+        }
+        return result;
+    }
+
+    void requireReportsMatch(const vr::ValidationReportList &reports, const std::vector<ErrorTexts> &expected) {
+        REQUIRE_EQUAL(reports.size(), expected.size());
+        for (std::size_t i = 0; i < reports.size(); ++i) {
+            runWithContext(SOURCE_LOCATION(), [&]() -> void {
+                REQUIRE(errorTexts(reports[i]) == expected[i]);
+            }, [&]() -> std::string {
+                return std::format("Failed for document {}.", i);
+            });
+        }
+    }
+
+    void testExpectedErrorsAreMixed() {
+        WITH_CONTEXT(requireMixedRules());
+        const auto expected = expectedErrors(2);
+        std::size_t validCount = 0;
+        for (const auto &errors : expected) {
+            if (errors.empty()) {
+                validCount += 1;
+            }
+        }
+        REQUIRE(validCount > 0);
+        REQUIRE(validCount < cDocumentCount);
+    }
+
+    void testBatchWithInternalPool() {
+        WITH_CONTEXT(requireMixedRules());
+        for (const Integer version : {1, 2}) {
+            const auto expected = expectedErrors(version);
+            for (int round = 0; round < 3; ++round) {
+                const auto documents = parseDocuments();
+                vr::ValidationReportList reports;
+                REQUIRE_NOTHROW(reports = rules->validateBatch(documents, version));
+                WITH_CONTEXT(requireReportsMatch(reports, expected));
+            }
+        }
+    }
+
+    void testBatchWithExecutor() {
+        WITH_CONTEXT(requireMixedRules());
+        const auto expected = expectedErrors(2);
+        std::atomic<std::size_t> executedTasks{0};
+        const vr::BatchExecutor executor = [&](const std::size_t taskCount, const std::function<void()> &task) {
+            std::vector<std::thread> threads;
+            for (std::size_t i = 0; i < taskCount; ++i) {
+                threads.emplace_back([&]() -> void {
+                    task();
+                    executedTasks.fetch_add(1);
+                });
+            }
+            for (auto &thread : threads) {
+                thread.join();
+            }
+        };
+        const auto documents = parseDocuments();
+        vr::ValidationReportList reports;
+        REQUIRE_NOTHROW(reports = rules->validateBatch(documents, 2, executor));
+        REQUIRE(executedTasks.load() > 0);
+        WITH_CONTEXT(requireReportsMatch(reports, expected));
+    }
+
+    void testSharedRulesInThreads() {
+        WITH_CONTEXT(requireMixedRules());
+        const auto expectedV1 = expectedErrors(1);
+        const auto expectedV2 = expectedErrors(2);
+        // Each thread validates its own documents with alternating versions, sharing the rules instance.
+        std::vector<std::vector<DocumentPtr>> documents(cThreadCount);
+        for (auto &threadDocuments : documents) {
+            threadDocuments = parseDocuments();
+        }
+        std::vector<std::vector<ErrorTexts>> results(cThreadCount);
+        std::vector<std::thread> threads;
+        for (std::size_t threadIndex = 0; threadIndex < cThreadCount; ++threadIndex) {
+            threads.emplace_back([&, threadIndex]() -> void {
+                const Integer version = (threadIndex % 2 == 0) ? 1 : 2;
+                rules->compile(version);
+                for (const auto &document : documents[threadIndex]) {
+                    results[threadIndex].emplace_back(errorTexts(rules->validateWithReport(document, version)));
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        for (std::size_t threadIndex = 0; threadIndex < cThreadCount; ++threadIndex) {
+            const auto &expected = (threadIndex % 2 == 0) ? expectedV1 : expectedV2;
+            REQUIRE(results[threadIndex] == expected);
+        }
+    }
+
+    void testBatchEdgeCases() {
+        WITH_CONTEXT(requireMixedRules());
+        vr::ValidationReportList reports;
+        REQUIRE_NOTHROW(reports = rules->validateBatch({}, 1));
+        REQUIRE(reports.empty());
+        auto documents = parseDocuments();
+        documents.resize(3);
+        documents[1] = nullptr;
+        REQUIRE_NOTHROW(reports = rules->validateBatch(documents, 1));
+        REQUIRE_EQUAL(reports.size(), 3);
+        REQUIRE_EQUAL(reports[1].errorCount(), 1);
+        REQUIRE(reports[1].errors().front().message().contains(u8"null value"));
+    }
+};
+
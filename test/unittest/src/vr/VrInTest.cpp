@@ -189,6 +189,72 @@ public:
         WITH_CONTEXT(requireError("ABCDEF"));
     }
 
+    /// Create rules with a long multi-line `in` list.
+    void requireLargeListRules(
+        const std::string &type,
+        const std::string &constraint,
+        const std::vector<std::string> &values,
+        const bool caseSensitive = false) {
+
+        std::vector<std::string> lines{"[app.x]", std::format("type: \"{}\"", type)};
+        if (caseSensitive) {
+            lines.emplace_back("case_sensitive: yes");
+        }
+        lines.emplace_back(std::format("{}:", constraint));
+        for (const auto &value : values) {
+            lines.emplace_back(std::format("    * {}", value));
+        }
+        WITH_CONTEXT(requireRulesPassLines({lines.begin(), lines.end()}));
+    }
+
+    void testLargeTextList() {
+        std::vector<std::string> values;
+        for (int i = 0; i < 2000; ++i) {
+            values.emplace_back(std::format("\"Region-{:04}\"", i));
+        }
+        WITH_CONTEXT(requireLargeListRules("text", "in", values));
+        for (int i = 0; i < 2000; i += 97) {
+            WITH_CONTEXT(requirePassLines({"[app]", std::format("x: \"region-{:04}\"", i)}));
+        }
+        WITH_CONTEXT(requireFailLines({"[app]", "x: \"region-2000\""}));
+        // Only the first values are listed in the error message.
+        WITH_CONTEXT(requireError(
+            "The text must be one of \"Region-0000\" or \"Region-0001\" or \"Region-0002\" or \"Region-0003\" or "
+            "\"Region-0004\" or \"Region-0005\" or \"Region-0006\" or \"Region-0007\" or \"Region-0008\" or "
+            "\"Region-0009\" or one of 1990 more values (case-insensitive)"));
+        WITH_CONTEXT(requireLargeListRules("text", "in", values, true));
+        WITH_CONTEXT(requirePassLines({"[app]", "x: \"Region-1234\""}));
+        WITH_CONTEXT(requireFailLines({"[app]", "x: \"region-1234\""}));
+        WITH_CONTEXT(requireError("or one of 1990 more values (case-sensitive)"));
+    }
+
+    void testLargeIntegerList() {
+        std::vector<std::string> values;
+        for (int i = 0; i < 1000; ++i) {
+            values.emplace_back(std::format("{}", i * 1024));
+        }
+        WITH_CONTEXT(requireLargeListRules("integer", "not_in", values));
+        WITH_CONTEXT(requirePassLines({"[app]", "x: 1025"}));
+        WITH_CONTEXT(requireFailLines({"[app]", "x: 512000"}));
+        WITH_CONTEXT(requireError("The value must not be one of 0 or 1024 or 2048"));
+        WITH_CONTEXT(requireError("or 9216 or one of 990 more values"));
+        values.emplace_back("2048");
+        std::vector<std::string> lines{"[app.x]", "type: \"integer\"", "in:"};
+        for (const auto &value : values) {
+            lines.emplace_back(std::format("    * {}", value));
+        }
+        WITH_CONTEXT(requireRulesFailLines({lines.begin(), lines.end()}));
+        WITH_CONTEXT(requireError("The 'in' list must not contain duplicate values"));
+    }
+
+    void testCaseSensitiveValuesThatOnlyDifferInCase() {
+        WITH_CONTEXT(requireOneConstraintPass("in: \"alpha\", \"ALPHA\", \"Alpha\"", vr::RuleType::Text, true));
+        WITH_CONTEXT(requirePassLines({"[app]", "x: \"alpha\""}));
+        WITH_CONTEXT(requirePassLines({"[app]", "x: \"ALPHA\""}));
+        WITH_CONTEXT(requirePassLines({"[app]", "x: \"Alpha\""}));
+        WITH_CONTEXT(requireFailLines({"[app]", "x: \"aLPHA\""}));
+    }
+
     void testCustomErrorMessage() {
         WITH_CONTEXT(requireRulesPassLines({
             "[app.x]",
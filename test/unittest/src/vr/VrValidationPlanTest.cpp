@@ -0,0 +1,143 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "VrBase.hpp"
+
+#include <erbsland/conf/impl/vr/ValidationPlan.hpp>
+
+
+using namespace el::conf;
+using impl::ValidationPlan;
+
+
+TESTED_TARGETS(ValidationPlan Rules) TAGS(ValidationRules)
+class VrValidationPlanTest final : public UNITTEST_SUBCLASS(VrBase) {
+public:
+    [[nodiscard]] auto rulesImpl() -> impl::RulesPtr {
+        auto result = std::dynamic_pointer_cast<impl::Rules>(rules);
+        REQUIRE(result != nullptr);
+        return result;
+    }
+
+    [[nodiscard]] static auto childWithName(
+        const ValidationPlan &plan,
+        const ValidationPlan::RuleId parentId,
+        const std::string_view name) -> ValidationPlan::RuleId {
+
+        return plan.namedChild(parentId, Name::createRegular(String{std::string{name}}));
+    }
+
+    void testStructure() {
+        WITH_CONTEXT(requireRulesPassLines({
+            "[app.port]",
+            "type: \"integer\"",
+            "[app.name]",
+            "type: \"text\"",
+            "is_optional: yes",
+            "[app.legacy]",
+            "type: \"text\"",
+            "maximum_version: 1",
+            "[app.vr_any]",
+            "type: \"integer\"",
+            "[list]",
+            "type: \"ValueList\"",
+            "[list.vr_entry]",
+            "type: \"integer\"",
+        }));
+        const auto plan = ValidationPlan::create(rulesImpl()->root(), 2);
+        REQUIRE_EQUAL(plan->version(), 2);
+        const auto &root = plan->node(ValidationPlan::cRootRule);
+        REQUIRE(root.rule == rulesImpl()->root());
+        REQUIRE_EQUAL(root.childCount, 2);
+        const auto appId = childWithName(*plan, ValidationPlan::cRootRule, "app");
+        const auto listId = childWithName(*plan, ValidationPlan::cRootRule, "list");
+        REQUIRE_EQUAL(appId, root.firstChild);
+        REQUIRE_EQUAL(listId, root.firstChild + 1);
+        // The children of a rule have consecutive IDs.
+        const auto &app = plan->node(appId);
+        REQUIRE_EQUAL(app.childCount, 4);
+        const auto portId = childWithName(*plan, appId, "port");
+        const auto nameId = childWithName(*plan, appId, "name");
+        REQUIRE_EQUAL(plan->childPosition(appId, portId), 0);
+        REQUIRE_EQUAL(plan->childPosition(appId, nameId), 1);
+        REQUIRE(plan->rule(portId)->targetName() == Name::createRegular(u8"port"));
+        // Inactive rules and the "any" rule are not matched by name.
+        REQUIRE_EQUAL(childWithName(*plan, appId, "legacy"), ValidationPlan::cNoRule);
+        REQUIRE_EQUAL(childWithName(*plan, appId, "vr_any"), ValidationPlan::cNoRule);
+        REQUIRE_EQUAL(childWithName(*plan, appId, "unknown"), ValidationPlan::cNoRule);
+        REQUIRE(app.anyChild != ValidationPlan::cNoRule);
+        REQUIRE(plan->rule(app.anyChild)->ruleName() == Name::createRegular(u8"vr_any"));
+        // Only the port is required for this version.
+        REQUIRE_EQUAL(app.requiredChildren.size(), 1);
+        REQUIRE_EQUAL(app.requiredChildren.front(), portId);
+        REQUIRE_EQUAL(app.activeChildren.size(), 3);
+        // The entry rule of the list.
+        const auto &list = plan->node(listId);
+        REQUIRE(list.entryChild != ValidationPlan::cNoRule);
+        REQUIRE(plan->rule(list.entryChild)->ruleName() == Name::createRegular(u8"vr_entry"));
+        // The legacy rule is active for version 1.
+        const auto planV1 = ValidationPlan::create(rulesImpl()->root(), 1);
+        const auto legacyId = childWithName(*planV1, appId, "legacy");
+        REQUIRE(legacyId != ValidationPlan::cNoRule);
+        REQUIRE_EQUAL(planV1->node(appId).requiredChildren.size(), 2);
+        REQUIRE_EQUAL(planV1->size(), plan->size());
+    }
+
+    void testLargeSection() {
+        std::vector<std::string> ruleLines;
+        std::vector<std::string> documentLines;
+        documentLines.emplace_back("[app]");
+        for (int i = 0; i < 40; ++i) {
+            ruleLines.emplace_back(std::format("[app.value_{}]", i));
+            ruleLines.emplace_back("type: \"integer\"");
+            if (i % 2 == 1) {
+                ruleLines.emplace_back("is_optional: yes");
+            }
+            if (i != 10) {
+                documentLines.emplace_back(std::format("value_{}: {}", i, i));
+            }
+        }
+        WITH_CONTEXT(requireRulesPassLines({ruleLines.begin(), ruleLines.end()}));
+        const auto plan = rulesImpl()->validationPlan(0);
+        const auto appId = childWithName(*plan, ValidationPlan::cRootRule, "app");
+        const auto &app = plan->node(appId);
+        REQUIRE_FALSE(app.namedChildTable.empty());
+        for (int i = 0; i < 40; ++i) {
+            const auto childId = childWithName(*plan, appId, std::format("value_{}", i));
+            REQUIRE(childId != ValidationPlan::cNoRule);
+            REQUIRE_EQUAL(plan->childPosition(appId, childId), static_cast<std::size_t>(i));
+        }
+        REQUIRE_EQUAL(childWithName(*plan, appId, "value_40"), ValidationPlan::cNoRule);
+        WITH_CONTEXT(requireFailLines({documentLines.begin(), documentLines.end()}));
+        WITH_CONTEXT(requireError("expected an integer value with the name 'value_10'"));
+        documentLines.emplace_back("value_10: 10");
+        WITH_CONTEXT(requirePassLines({documentLines.begin(), documentLines.end()}));
+        documentLines.emplace_back("value_40: 40");
+        WITH_CONTEXT(requireFailLines({documentLines.begin(), documentLines.end()}));
+        WITH_CONTEXT(requireError("unexpected integer value"));
+    }
+
+    void testPlansAreCachedPerVersion() {
+        WITH_CONTEXT(requireRulesPassLines({
+            "[app.x]",
+            "type: \"integer\"",
+            "minimum_version: 2",
+        }));
+        const auto planV1 = rulesImpl()->validationPlan(1);
+        REQUIRE(planV1 == rulesImpl()->validationPlan(1));
+        REQUIRE_NOTHROW(rules->compile(2));
+        const auto planV2 = rulesImpl()->validationPlan(2);
+        REQUIRE(planV1 != planV2);
+        REQUIRE_EQUAL(planV2->version(), 2);
+        // The same rules instance validates documents for both versions, in any order.
+        for (int i = 0; i < 3; ++i) {
+            WITH_CONTEXT(requirePassLines({"[app]"}, 1));
+            WITH_CONTEXT(requireFailLines({"[app]"}, 2));
+            WITH_CONTEXT(requireError("expected an integer value with the name 'x'"));
+            WITH_CONTEXT(requirePassLines({"[app]", "x: 1"}, 2));
+        }
+        REQUIRE(planV2 == rulesImpl()->validationPlan(2));
+    }
+};
+
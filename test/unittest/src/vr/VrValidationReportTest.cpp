@@ -0,0 +1,260 @@
+// Copyright (c) 2026 Tobias Erbsland - https://erbsland.dev
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "VrBase.hpp"
+
+#include <erbsland/conf/Parser.hpp>
+#include <erbsland/conf/vr/Rules.hpp>
+#include <erbsland/conf/vr/ValidationReport.hpp>
+
+#include <algorithm>
+
+
+using namespace el::conf;
+
+
+TESTED_TARGETS(Rules ValidationReport) TAGS(ValidationRules)
+class VrValidationReportTest final : public UNITTEST_SUBCLASS(VrBase) {
+public:
+    vr::ValidationReport report;
+
+    void setUp() override {
+        VrBase::setUp();
+        report = {};
+    }
+
+    auto additionalErrorMessages() -> std::string override {
+        auto result = VrBase::additionalErrorMessages();
+        result += std::format("Report with {} errors:\n", report.errorCount());
+        for (const auto &error : report.errors()) {
+            result += std::format("  {}\n", error.toText().toCharString());
+        }
+        return result;
+    }
+
+    void validateWithReport(const std::vector<std::string_view> &lines, const Integer version = 0) {
+        Parser docParser;
+        REQUIRE_NOTHROW(document = docParser.parseTextOrThrow(linesToString(lines)));
+        REQUIRE(document != nullptr);
+        REQUIRE(rules != nullptr);
+        REQUIRE_NOTHROW(report = rules->validateWithReport(document, version));
+    }
+
+    [[nodiscard]] auto hasErrorAt(const NamePath &namePath, const String &partialMatch) const -> bool {
+        return std::ranges::any_of(report.errors(), [&](const Error &error) -> bool {
+            return error.category() == ErrorCategory::Validation
+                && error.namePath() == namePath
+                && error.message().contains(partialMatch, CaseSensitivity::CaseInsensitive);
+        });
+    }
+
+    void requireServerRules() {
+        WITH_CONTEXT(requireRulesPassLines({
+            "[server.port]",
+            "type: \"integer\"",
+            "minimum: 1024",
+            "[server.name]",
+            "type: \"text\"",
+            "ends: \".local\"",
+            "[server.mode]",
+            "type: \"text\"",
+            "in: \"fast\", \"safe\"",
+            "[server.workers]",
+            "type: \"integer\"",
+            "default: 4",
+            "[client.timeout]",
+            "type: \"integer\"",
+            "maximum: 60",
+        }));
+    }
+
+    void testValidDocument() {
+        WITH_CONTEXT(requireServerRules());
+        WITH_CONTEXT(validateWithReport({
+            "[server]",
+            "port: 8080",
+            "name: \"main.local\"",
+            "mode: \"fast\"",
+            "[client]",
+            "timeout: 30",
+        }));
+        REQUIRE(report.isValid());
+        REQUIRE_FALSE(report.hasErrors());
+        REQUIRE_EQUAL(report.errorCount(), 0);
+        REQUIRE_NOTHROW(report.throwIfInvalid());
+        // Defaults are added like with `validate()`.
+        REQUIRE_EQUAL(document->getOrThrow<Integer>(u8"server.workers"), 4);
+    }
+
+    void testAllErrorsAreReported() {
+        WITH_CONTEXT(requireServerRules());
+        WITH_CONTEXT(validateWithReport({
+            "[server]",
+            "port: 80",
+            "name: \"main.example\"",
+            "mode: \"slow\"",
+            "[client]",
+            "timeout: 120",
+        }));
+        REQUIRE(report.hasErrors());
+        REQUIRE_EQUAL(report.errorCount(), 4);
+        REQUIRE(hasErrorAt(NamePath::fromText(u8"server.port"), u8"at least 1024"));
+        REQUIRE(hasErrorAt(NamePath::fromText(u8"server.name"), u8"does not end with"));
+        REQUIRE(hasErrorAt(NamePath::fromText(u8"server.mode"), u8"must be one of"));
+        REQUIRE(hasErrorAt(NamePath::fromText(u8"client.timeout"), u8"at most 60"));
+        for (const auto &error : report.errors()) {
+            REQUIRE_FALSE(error.location().isUndefined());
+        }
+        REQUIRE_THROWS_AS(Error, report.throwIfInvalid());
+    }
+
+    void testMissingAndUnexpectedValues() {
+        WITH_CONTEXT(requireServerRules());
+        WITH_CONTEXT(validateWithReport({
+            "[server]",
+            "port: 8080",
+            "address: \"127.0.0.1\"",
+            "[client]",
+            "timeout: 10",
+            "retries: 3",
+        }));
+        REQUIRE_EQUAL(report.errorCount(), 4);
+        REQUIRE(hasErrorAt(NamePath::fromText(u8"server.address"), u8"unexpected text value"));
+        REQUIRE(hasErrorAt(NamePath::fromText(u8"client.retries"), u8"unexpected integer value"));
+        REQUIRE(hasErrorAt(NamePath::fromText(u8"server"), u8"with the name 'name'"));
+        REQUIRE(hasErrorAt(NamePath::fromText(u8"server"), u8"with the name 'mode'"));
+    }
+
+    void testFailedBranchIsSkipped() {
+        WITH_CONTEXT(requireServerRules());
+        WITH_CONTEXT(validateWithReport({
+            "[server]",
+            "port: 8080",
+            "name: \"main.local\"",
+            "mode: \"fast\"",
+            "[client]",
+            "timeout: \"long\"",
+        }));
+        REQUIRE_EQUAL(report.errorCount(), 1);
+        REQUIRE(hasErrorAt(NamePath::fromText(u8"client.timeout"), u8"expected an integer value"));
+    }
+
+    void testAlternatives() {
+        WITH_CONTEXT(requireRulesPassLines({
+            "*[app.value]*",
+            "type: \"integer\"",
+            "minimum: 10",
+            "error: \"Must be a number from 10 or a text with at least three characters.\"",
+            "*[app.value]*",
+            "type: \"text\"",
+            "minimum: 3",
+            "[app.other]",
+            "type: \"integer\"",
+            "maximum: 5",
+        }));
+        WITH_CONTEXT(validateWithReport({
+            "[app]",
+            "value: 20",
+            "other: 1",
+        }));
+        REQUIRE(report.isValid());
+        WITH_CONTEXT(validateWithReport({
+            "[app]",
+            "value: \"abc\"",
+            "other: 1",
+        }));
+        REQUIRE(report.isValid());
+        WITH_CONTEXT(validateWithReport({
+            "[app]",
+            "value: 5",
+            "other: 6",
+        }));
+        REQUIRE_EQUAL(report.errorCount(), 2);
+        REQUIRE(hasErrorAt(NamePath::fromText(u8"app.value"), u8"must be a number from 10"));
+        REQUIRE(hasErrorAt(NamePath::fromText(u8"app.other"), u8"at most 5"));
+        WITH_CONTEXT(validateWithReport({
+            "[app]",
+            "value: 1.5",
+            "other: 1",
+        }));
+        REQUIRE_EQUAL(report.errorCount(), 1);
+        REQUIRE(hasErrorAt(NamePath::fromText(u8"app.value"), u8"expected an integer value, or a text value"));
+    }
+
+    void testValueListEntries() {
+        WITH_CONTEXT(requireRulesPassLines({
+            "[app.ports]",
+            "type: \"ValueList\"",
+            "[app.ports.vr_entry]",
+            "type: \"integer\"",
+            "minimum: 1024",
+        }));
+        WITH_CONTEXT(validateWithReport({
+            "[app]",
+            "ports: 80, 8080, 443",
+        }));
+        REQUIRE_EQUAL(report.errorCount(), 2);
+    }
+
+    void testKeysAndDependencies() {
+        WITH_CONTEXT(requireRulesPassLines({
+            "[client]",
+            "type: \"section_list\"",
+            "[client.vr_entry.name]",
+            "type: \"text\"",
+            "[client.vr_entry.user]",
+            "type: \"text\"",
+            "is_optional: yes",
+            "[client.vr_entry.password]",
+            "type: \"text\"",
+            "is_optional: yes",
+            "*[client.vr_entry.vr_dependency]*",
+            "mode: \"if\"",
+            "source: \"user\"",
+            "target: \"password\"",
+            "*[vr_key]*",
+            "key: \"client.vr_entry.name\"",
+        }));
+        WITH_CONTEXT(validateWithReport({
+            "*[client]",
+            "name: \"one\"",
+            "user: \"a\"",
+            "*[client]",
+            "name: \"one\"",
+            "*[client]",
+            "name: \"two\"",
+            "*[client]",
+            "name: \"two\"",
+            "user: \"b\"",
+        }));
+        // Two duplicate keys and two missing passwords.
+        REQUIRE_EQUAL(report.errorCount(), 4);
+    }
+
+    void testVersusValidate() {
+        WITH_CONTEXT(requireServerRules());
+        WITH_CONTEXT(validateWithReport({
+            "[server]",
+            "port: 80",
+            "name: \"main.local\"",
+            "mode: \"fast\"",
+            "[client]",
+            "timeout: 30",
+        }));
+        REQUIRE_EQUAL(report.errorCount(), 1);
+        // The same document must raise the same error using `validate()`.
+        try {
+            rules->validate(document, 0);
+            REQUIRE(false);
+        } catch (const Error &error) {
+            REQUIRE_EQUAL(error.message(), report.errors().front().message());
+            REQUIRE_EQUAL(error.namePath(), report.errors().front().namePath());
+        }
+    }
+
+    void testInvalidArguments() {
+        WITH_CONTEXT(requireServerRules());
+        REQUIRE_THROWS_AS(Error, std::ignore = rules->validateWithReport(nullptr, 0));
+    }
+};